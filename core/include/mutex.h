@@ -33,7 +33,7 @@ extern "C" {
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
-typedef struct {
+typedef struct _mutex {
     /**
      * @brief   The process waiting queue of the mutex. **Must never be changed
      *          by the user.**
@@ -63,14 +63,6 @@ typedef struct {
      */
     uinttxtptr_t owner_calling_pc;
 #endif
-#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    /**
-     * @brief   Original priority of the owner
-     * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
-     */
-    uint8_t owner_original_priority;
-#endif
 } mutex_t;
 
 /**
@@ -341,6 +333,23 @@ void mutex_unlock_and_sleep(mutex_t *mutex);
  */
 void mutex_cancel(mutex_cancel_t *mc);
 
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Change the base priority of @p thread, keeping any higher priority
+ *          it inherited via the mutexes it holds
+ *
+ * @note    This function is considered internal, use
+ *          @ref sched_change_priority instead.
+ * @note    Only available if module core_mutex_priority_inheritance is used.
+ *
+ * @pre     IRQs are disabled
+ *
+ * @param[in,out]   thread      thread to change the priority of
+ * @param[in]       priority    new base priority of @p thread
+ */
+void mutex_pi_set_base_priority(thread_t *thread, uint8_t priority);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
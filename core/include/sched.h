@@ -256,6 +256,9 @@ NORETURN void sched_task_exit(void);
  * @brief   Change the priority of the given thread
  *
  * @note    This functions expects interrupts to be disabled when called!
+ * @note    With module `core_mutex_priority_inheritance`, this changes the
+ *          base priority of @p thread. The thread keeps running at any higher
+ *          priority it inherited via a mutex until it releases that mutex.
  *
  * @pre     (thread != NULL)
  * @pre     (priority < SCHED_PRIO_LEVELS)
@@ -265,6 +268,23 @@ NORETURN void sched_task_exit(void);
  */
 void sched_change_priority(thread_t *thread, uint8_t priority);
 
+/**
+ * @brief   Change the priority the given thread currently runs at
+ *
+ * Unlike @ref sched_change_priority, this leaves the base priority used by
+ * `core_mutex_priority_inheritance` untouched.
+ *
+ * @note    This function is considered internal, use
+ *          @ref sched_change_priority instead.
+ *
+ * @pre     (thread != NULL)
+ * @pre     (priority < SCHED_PRIO_LEVELS)
+ *
+ * @param[in,out] thread    target thread
+ * @param[in]     priority  priority @p thread runs at from now on
+ */
+void sched_set_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief  Set CPU to idle mode (CPU dependent)
  *
@@ -177,6 +177,12 @@ struct _thread {
 
     clist_node_t rq_entry;          /**< run queue entry                */
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without inherited
+                                         priorities                     */
+    struct _mutex *mutex_waiting;   /**< mutex this thread is blocked on */
+#endif
+
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
     void *wait_data;                /**< used by msg, mbox and thread
@@ -27,12 +27,180 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "mutex_stats.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #if MAXTHREADS > 1
 
+/**
+ * @brief   Insert @p thread into the wait queue of @p mutex, sorted by priority
+ * @pre     IRQs are disabled
+ * @pre     @p mutex is locked
+ */
+static void _enqueue(mutex_t *mutex, thread_t *thread)
+{
+    if ((mutex->queue.next == MUTEX_LOCKED) || (mutex->queue.next == NULL)) {
+        mutex->queue.next = (list_node_t *)&thread->rq_entry;
+        mutex->queue.next->next = NULL;
+    }
+    else {
+        thread_add_to_list(&mutex->queue, thread);
+    }
+}
+
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Get the priority @p thread should run at: Its base priority or the
+ *          priority of the most important thread waiting for a mutex owned by
+ *          @p thread, whichever is higher
+ * @pre     IRQs are disabled
+ *
+ * Only blocked threads refer to a mutex (via `thread_t::mutex_waiting`), and
+ * a mutex must outlive any thread waiting for it. Hence, the waiters are found
+ * via the thread table and no mutex is ever accessed that is not currently
+ * contended.
+ */
+static uint8_t _pi_priority(const thread_t *thread)
+{
+    uint8_t prio = thread->base_priority;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *waiter = thread_get_unchecked(pid);
+        if ((waiter != NULL) && (waiter->mutex_waiting != NULL)
+            && (waiter->mutex_waiting->owner == thread->pid)
+            && (waiter->priority < prio)) {
+            prio = waiter->priority;
+        }
+    }
+
+    return prio;
+}
+
+/**
+ * @brief   Re-evaluate the priority of @p thread and propagate any change
+ *          along the chain of owners of the mutexes the threads are blocked on
+ * @pre     IRQs are disabled
+ *
+ * The chain length is bounded by the number of threads, so that a deadlock
+ * (a cycle in the chain) does not end up in an endless loop.
+ */
+static void _pi_update(thread_t *thread)
+{
+    for (unsigned i = 0; (thread != NULL) && (i < MAXTHREADS); i++) {
+        uint8_t prio = _pi_priority(thread);
+        if (prio == thread->priority) {
+            return;
+        }
+
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              thread->pid, (unsigned)thread->priority, (unsigned)prio);
+        sched_set_priority(thread, prio);
+
+        mutex_t *mutex = thread->mutex_waiting;
+        if (mutex == NULL) {
+            return;
+        }
+        /* keep the wait queue of the mutex sorted by the new priority */
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        _enqueue(mutex, thread);
+        thread = thread_get(mutex->owner);
+    }
+}
+
+void mutex_pi_set_base_priority(thread_t *thread, uint8_t priority)
+{
+    thread->base_priority = priority;
+    _pi_update(thread);
+}
+#endif
+
+/**
+ * @brief   Make @p thread the owner of @p mutex
+ * @pre     IRQs are disabled
+ */
+static inline void _set_owner(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    || IS_USED(MODULE_CORE_MUTEX_DEBUG)
+    mutex->owner = thread ? thread->pid : KERNEL_PID_UNDEF;
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    if (thread) {
+        thread->mutex_waiting = NULL;
+    }
+#endif
+}
+
+/**
+ * @brief   Release @p mutex on behalf of its owner
+ * @pre     IRQs are disabled
+ * @return  The previous owner, if its priority may need to be restored via
+ *          @ref _restore_priority
+ *
+ * The priority of the previous owner must only be restored once the mutex is
+ * consistent again: Lowering the priority of the running thread may cause a
+ * context switch right away.
+ */
+static inline thread_t *_clear_owner(mutex_t *mutex)
+{
+    thread_t *owner = NULL;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /* The mutex may be unlocked by a different thread or an ISR than the one
+     * that locked it, so don't assume the running thread is the owner */
+    owner = thread_get(mutex->owner);
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    || IS_USED(MODULE_CORE_MUTEX_DEBUG)
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
+    mutex_stats_released(mutex);
+    return owner;
+}
+
+/**
+ * @brief   Drop any priority @p thread inherited via mutexes it no longer holds
+ * @pre     IRQs are disabled
+ */
+static inline void _restore_priority(thread_t *thread)
+{
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /* only a thread running above its base priority inherited anything */
+    if ((thread != NULL) && (thread->priority != thread->base_priority)) {
+        _pi_update(thread);
+    }
+#else
+    (void)thread;
+#endif
+}
+
+/**
+ * @brief   Hand @p mutex over to the first thread in its wait queue
+ * @pre     IRQs are disabled
+ * @pre     At least one thread is waiting for @p mutex
+ * @return  The new owner, already set to pending
+ */
+static thread_t *_handover(mutex_t *mutex)
+{
+    list_node_t *next = list_remove_head(&mutex->queue);
+    thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
+    thread_t *prev = _clear_owner(mutex);
+
+    sched_set_status(process, STATUS_PENDING);
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+    /* the remaining waiters have no higher priority than the new owner, so
+     * there is nothing for it to inherit */
+    _set_owner(mutex, process);
+    _restore_priority(prev);
+
+    return process;
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -65,23 +233,12 @@ void _block(mutex_t *mutex,
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
-    if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = (list_node_t *)&me->rq_entry;
-        mutex->queue.next->next = NULL;
-    }
-    else {
-        thread_add_to_list(&mutex->queue, me);
-    }
+    _enqueue(mutex, me);
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    /* boost the owner and, if that is blocked as well, the owner's owner */
+    me->mutex_waiting = mutex;
+    _pi_update(thread_get(mutex->owner));
 #endif
 
     irq_restore(irq_state);
@@ -106,17 +263,11 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
-        || IS_USED(MODULE_CORE_MUTEX_DEBUG)
-        thread_t *me = thread_get_active();
-        mutex->owner = me ? me->pid : KERNEL_PID_UNDEF;
-#endif
+        _set_owner(mutex, thread_get_active());
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
 #endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
-#endif
+        mutex_stats_acquired(mutex);
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -126,7 +277,9 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
             irq_restore(irq_state);
             return false;
         }
+        uint32_t wait_start = mutex_stats_now();
         _block(mutex, irq_state, pc);
+        mutex_stats_acquired_contended(mutex, wait_start);
     }
 
     return true;
@@ -155,29 +308,26 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
-        || IS_USED(MODULE_CORE_MUTEX_DEBUG)
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-#endif
+        _set_owner(mutex, thread_get_active());
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
 #endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
-#endif
+        mutex_stats_acquired(mutex);
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
         return 0;
     }
     else {
+        uint32_t wait_start = mutex_stats_now();
         _block(mutex, irq_state, pc);
         if (mc->cancelled) {
             DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
                   "cancelled.\n", thread_getpid());
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
+        mutex_stats_acquired_contended(mutex, wait_start);
+        return 0;
     }
 }
 
@@ -197,31 +347,17 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        _restore_priority(_clear_owner(mutex));
         irq_restore(irqstate);
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
-
-    thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
+    thread_t *process = _handover(mutex);
+    (void)process;
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
-    sched_set_status(process, STATUS_PENDING);
-
-    if (!mutex->queue.next) {
-        mutex->queue.next = MUTEX_LOCKED;
-    }
 
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
-#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
 #endif
@@ -239,17 +375,13 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _restore_priority(_clear_owner(mutex));
         }
         else {
-            list_node_t *next = list_remove_head(&mutex->queue);
-            thread_t *process = container_of((clist_node_t *)next, thread_t,
-                                             rq_entry);
+            thread_t *process = _handover(mutex);
+            (void)process;
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
-            sched_set_status(process, STATUS_PENDING);
-            if (!mutex->queue.next) {
-                mutex->queue.next = MUTEX_LOCKED;
-            }
         }
     }
 
@@ -284,6 +416,11 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* the owner no longer inherits the priority of the cancelled thread */
+        thread->mutex_waiting = NULL;
+        _restore_priority(thread_get(mutex->owner));
+#endif
         irq_restore(irq_state);
         sched_switch(thread->priority);
         return;
@@ -25,6 +25,7 @@
 #include "clist.h"
 #include "irq.h"
 #include "log.h"
+#include "mutex.h"
 #include "sched.h"
 #include "thread.h"
 #include "panic.h"
@@ -330,6 +331,19 @@ void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 #endif
 
 void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    assert(thread && (priority < SCHED_PRIO_LEVELS));
+
+    unsigned irq_state = irq_disable();
+    mutex_pi_set_base_priority(thread, priority);
+    irq_restore(irq_state);
+#else
+    sched_set_priority(thread, priority);
+#endif
+}
+
+void sched_set_priority(thread_t *thread, uint8_t priority)
 {
     assert(thread && (priority < SCHED_PRIO_LEVELS));
 
@@ -344,6 +344,10 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->priority = priority;
     thread->status = STATUS_STOPPED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->mutex_waiting = NULL;
+#endif
 
     thread->rq_entry.next = NULL;
 
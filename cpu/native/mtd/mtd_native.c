@@ -15,7 +15,11 @@
 #include <stdio.h>
 
 #include "macros/utils.h"
+#include "modules.h"
 #include "mtd.h"
+#if IS_USED(MODULE_MTD_ASYNC)
+#include "mtd_async.h"
+#endif
 #include "mtd_native.h"
 #include "native_internal.h"
 
@@ -144,10 +148,52 @@ static int _power(mtd_dev_t *dev, enum mtd_power_state power)
     return -ENOTSUP;
 }
 
+#if IS_USED(MODULE_MTD_ASYNC)
+static int _async_step(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    uint32_t sector_size = dev->pages_per_sector * dev->page_size;
+    uint32_t len;
+    int res;
+
+    if (req->size == 0) {
+        return 0;
+    }
+
+    /* handle one page or sector per step, so that requests to other
+     * devices are not delayed */
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        len = MIN(req->size, dev->page_size - req->offset);
+        res = _read(dev, req->buf.dest, req->block * dev->page_size + req->offset, len);
+        break;
+    case MTD_ASYNC_WRITE:
+        res = _write_page(dev, req->buf.src, req->block, req->offset, req->size);
+        len = res;
+        break;
+    case MTD_ASYNC_ERASE:
+        res = _erase(dev, req->block * sector_size, sector_size);
+        len = 1;
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    if (res < 0) {
+        return res;
+    }
+    mtd_async_advance(req, len);
+
+    return req->size ? 1 : 0;
+}
+#endif
+
 const mtd_desc_t native_flash_driver = {
     .read = _read,
     .power = _power,
     .write_page = _write_page,
     .erase = _erase,
     .init = _init,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .async_step = _async_step,
+#endif
 };
@@ -0,0 +1,98 @@
+#! /usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Script to compare two runs of benchmarks using the `benchmark` harness.
+
+Both logs are scanned for the JSON lines printed by `benchmark_print_json()`,
+anything else in the logs is ignored. For each case present in both runs the
+medians are compared. A case is flagged as regression if its median got slower
+by more than the given threshold and the difference is significant compared to
+the noise of both runs (the standard error of the median estimated from the
+reported standard deviation).
+
+Exits with 1 if at least one regression was found.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+
+def parse_log(f):
+    """
+    Returns a dict mapping the case names to their last reported results
+    """
+    results = {}
+    for line in f:
+        start = line.find('{"bench":')
+        if start < 0:
+            continue
+        try:
+            res = json.loads(line[start:])
+        except json.JSONDecodeError:
+            continue
+        if "median" in res:
+            results[res["bench"]] = res
+    return results
+
+
+def median_stderr(res):
+    # standard error of the median of a normal distribution
+    return 1.2533 * res["stddev"] / math.sqrt(max(res["runs"], 1))
+
+
+def compare(old, new, threshold, sigma):
+    """
+    Returns a tuple (verdict, relative change) for the given results
+    """
+    diff = new["median"] - old["median"]
+    rel = diff / old["median"] if old["median"] else 0.0
+    noise = sigma * math.hypot(median_stderr(old), median_stderr(new))
+    if abs(rel) <= threshold or abs(diff) <= noise:
+        return "ok", rel
+    return ("REGRESSION" if diff > 0 else "improved"), rel
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("old", type=argparse.FileType("r"), help="Log of the baseline run")
+    parser.add_argument("new", type=argparse.FileType("r"), help="Log of the run to check")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0,
+                        help="Relative change of the median in percent to tolerate "
+                             "(default: %(default)s)")
+    parser.add_argument("-s", "--sigma", type=float, default=3.0,
+                        help="Number of standard errors a change must exceed to be "
+                             "significant (default: %(default)s)")
+    args = parser.parse_args()
+
+    old = parse_log(args.old)
+    new = parse_log(args.new)
+
+    regressions = 0
+    print("{:<32} {:>12} {:>12} {:>9}  {}".format("case", "old median", "new median",
+                                                  "change", "verdict"))
+    for name in sorted(set(old) | set(new)):
+        if name not in old or name not in new:
+            print("{:<32} {:>12} {:>12} {:>9}  {}".format(
+                name,
+                old[name]["median"] if name in old else "-",
+                new[name]["median"] if name in new else "-",
+                "", "missing in " + ("old" if name not in old else "new")))
+            continue
+        verdict, rel = compare(old[name], new[name], args.threshold / 100, args.sigma)
+        if verdict == "REGRESSION":
+            regressions += 1
+        print("{:<32} {:>10}{:>2} {:>10}{:>2} {:>+8.1f}%  {}".format(
+            name, old[name]["median"], old[name]["unit"],
+            new[name]["median"], new[name]["unit"], 100 * rel, verdict))
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,158 @@
+#! /usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Script to turn the output of the `profiler` shell command (provided by the
+`shell_cmd_profiler` pseudo-module) or `profiler_dump()` into a flat profile.
+
+Samples are symbolized with the symbol table of the given ELF file (via `nm`)
+and aggregated per function and, optionally, per thread. All dumps found in
+the log are accumulated, so a log of repeated `profiler dump` commands gives
+the profile of the whole run.
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import subprocess
+import sys
+
+EM_ARM = 40
+
+DUMP_HEADER = re.compile(
+    r"profiler: rate=(?P<rate>\d+) total=(?P<total>\d+) dropped=(?P<dropped>\d+)")
+DUMP_THREAD = re.compile(r"profiler: thread (?P<pid>\d+) (?P<name>\S+)")
+DUMP_SAMPLE = re.compile(r"profiler: sample (?P<pid>\d+) 0x(?P<pc>[0-9a-fA-F]+)")
+
+ISR_PID = 0
+
+
+class SymbolTable:
+    """
+    Function symbols of an ELF file, sorted by address.
+    """
+
+    def __init__(self, elffile, nm="nm"):
+        with open(elffile, "rb") as f:
+            header = f.read(20)
+        little = header[5] == 1
+        machine = int.from_bytes(header[18:20], "little" if little else "big")
+        # Thumb function symbols have the LSB set, PCs never do
+        mask = ~1 if machine == EM_ARM else ~0
+
+        out = subprocess.check_output([nm, "--defined-only", "-n", "-S", elffile],
+                                      universal_newlines=True)
+        syms = {}
+        for line in out.splitlines():
+            fields = line.split()
+            if len(fields) != 4 or fields[2] not in "tTwW":
+                continue
+            addr = int(fields[0], 16) & mask
+            size = int(fields[1], 16)
+            # keep the biggest of aliased symbols (e.g. weak and strong)
+            if addr not in syms or syms[addr][0] < size:
+                syms[addr] = (size, fields[3])
+        self.addrs = sorted(syms)
+        self.syms = [syms[a] for a in self.addrs]
+
+    def lookup(self, pc):
+        """
+        Returns the name of the function containing pc, or None
+        """
+        idx = bisect.bisect_right(self.addrs, pc) - 1
+        if idx < 0:
+            return None
+        size, name = self.syms[idx]
+        if pc >= self.addrs[idx] + max(size, 1):
+            return None
+        return name
+
+
+def parse_log(lines):
+    """
+    Accumulates all dumps in the given log lines
+
+    Returns a tuple of (total, dropped, threads, samples) with samples being a
+    Counter of (pid, pc) tuples.
+    """
+    total = 0
+    dropped = 0
+    threads = {ISR_PID: "[isr]"}
+    samples = collections.Counter()
+    for line in lines:
+        m = DUMP_SAMPLE.search(line)
+        if m:
+            samples[int(m.group("pid")), int(m.group("pc"), 16)] += 1
+            continue
+        m = DUMP_THREAD.search(line)
+        if m:
+            threads[int(m.group("pid"))] = m.group("name")
+            continue
+        m = DUMP_HEADER.search(line)
+        if m:
+            # counters are not reset by dumping, so only the last one counts
+            total = int(m.group("total"))
+            dropped = int(m.group("dropped"))
+    return total, dropped, threads, samples
+
+
+def print_profile(title, counter, limit, what="function"):
+    n = sum(counter.values())
+    print(title)
+    print("{:>9}  {:>6}  {}".format("samples", "%", what))
+    for name, count in counter.most_common(limit):
+        print("{:>9}  {:>6.2f}  {}".format(count, 100.0 * count / n, name))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elffile", help="ELF file of the profiled application")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="Log containing the profiler dumps (default: stdin)")
+    parser.add_argument("--nm", default="nm",
+                        help="nm binary to use, e.g. arm-none-eabi-nm")
+    parser.add_argument("-t", "--per-thread", action="store_true",
+                        help="Additionally print a flat profile per thread")
+    parser.add_argument("-n", "--limit", type=int, default=30,
+                        help="Number of functions to list per profile")
+    args = parser.parse_args()
+
+    symtab = SymbolTable(args.elffile, args.nm)
+    total, dropped, threads, samples = parse_log(args.log)
+    if not samples:
+        print("No profiler samples found", file=sys.stderr)
+        return 1
+
+    flat = collections.Counter()
+    per_thread = collections.defaultdict(collections.Counter)
+    for (pid, pc), count in samples.items():
+        if pid == ISR_PID and pc == 0:
+            name = "[isr]"
+        else:
+            name = symtab.lookup(pc) or "[0x{:08x}]".format(pc)
+        flat[name] += count
+        per_thread[pid][name] += count
+
+    print("{} samples, {} taken, {} dropped".format(sum(samples.values()),
+                                                   total, dropped))
+    print()
+    print_profile("Flat profile:", flat, args.limit)
+
+    thread_counts = collections.Counter({threads.get(pid, str(pid)): sum(c.values())
+                                         for pid, c in per_thread.items()})
+    print_profile("Samples per thread:", thread_counts, None, "thread")
+
+    if args.per_thread:
+        for pid in sorted(per_thread):
+            print_profile("Thread {} ({}):".format(pid, threads.get(pid, "?")),
+                          per_thread[pid], args.limit)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -12,6 +12,8 @@
 import argparse
 import json
 import os
+import subprocess
+import sys
 import uuid
 
 
@@ -35,11 +37,49 @@ def parse_arguments():
                         help='Manifest vendor uuid')
     parser.add_argument('--uuid-class', '-C', default="native",
                         help='Manifest class uuid')
+    parser.add_argument('--delta', '-d', action='append', default=[],
+                        help='Slot file of the running version, once per '
+                             'slot in the same order as the slot files. '
+                             'Each slot is then fetched as a VCDIFF delta '
+                             'against the other slot of the running version')
+    parser.add_argument('--vcdiff', default="vcdiff",
+                        help='open-vcdiff command used to create the deltas')
+    parser.add_argument('--compress', '-z', action='store_true',
+                        help='Compress the payloads with heatshrink')
+    parser.add_argument('--heatshrink', default="heatshrink",
+                        help='heatshrink command used to compress')
+    parser.add_argument('--window-bits', '-w', default=8, type=int,
+                        help='heatshrink window size, has to match '
+                             'HEATSHRINK_STATIC_WINDOW_BITS of the device')
+    parser.add_argument('--lookahead-bits', '-l', default=4, type=int,
+                        help='heatshrink lookahead size, has to match '
+                             'HEATSHRINK_STATIC_LOOKAHEAD_BITS of the device')
     parser.add_argument('slotfiles', nargs="+",
                         help='The list of slot file paths')
     return parser.parse_args()
 
 
+def create_delta(vcdiff, source, target):
+    delta = target + ".delta"
+    with open(target, 'rb') as target_fd, open(delta, 'wb') as delta_fd:
+        subprocess.run([vcdiff, "delta", "-interleaved",
+                        "-dictionary", source],
+                       stdin=target_fd, stdout=delta_fd, check=True)
+    return delta
+
+
+def compress(args, payload):
+    compressed = payload + ".hs"
+    subprocess.run([args.heatshrink, "-e",
+                    "-w", str(args.window_bits),
+                    "-l", str(args.lookahead_bits),
+                    payload, compressed], check=True)
+    before, after = os.path.getsize(payload), os.path.getsize(compressed)
+    print("{}: {} -> {} bytes ({} bytes saved)".format(
+        os.path.basename(payload), before, after, before - after))
+    return compressed
+
+
 def main(args):
     uuid_vendor = uuid.uuid5(uuid.NAMESPACE_DNS, args.uuid_vendor)
     uuid_class = uuid.uuid5(uuid_vendor, args.uuid_class)
@@ -62,12 +102,24 @@ def main(args):
 
         images.append((filename, offset, comp_name))
 
+    if args.delta and (len(args.delta) != 2 or len(images) != 2):
+        sys.exit("error: deltas need exactly two slot files and two "
+                 "slot files of the running version")
+
     template["components"] = []
 
     for slot, image in enumerate(images):
         filename, offset, comp_name = image
 
-        uri = os.path.join(args.urlroot, os.path.basename(filename))
+        payload = filename
+        if args.delta:
+            # the update is written to the slot that is not running, so the
+            # delta is created against the image of the other slot
+            payload = create_delta(args.vcdiff, args.delta[1 - slot], filename)
+        if args.compress:
+            payload = compress(args, payload)
+
+        uri = os.path.join(args.urlroot, os.path.basename(payload))
 
         component = {
             "install-id": comp_name,
@@ -81,6 +133,13 @@ def main(args):
         if offset:
             component.update({"offset": offset})
 
+        if args.delta:
+            # digest and size still describe the reconstructed image
+            component.update({"unpack-info": "delta"})
+
+        if args.compress:
+            component.update({"compression-info": "heatshrink"})
+
         template["components"].append(component)
 
     with open(args.output, 'w') as f:
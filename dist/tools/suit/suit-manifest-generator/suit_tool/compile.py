@@ -269,9 +269,10 @@ def compile_manifest(options, m):
             InstParams = {
                 'uri' : lambda cid, data: ('uri', data['uri']),
                 'offset' : lambda cid, data: ('offset', data['offset']),
+                'unpack-info' : lambda cid, data: ('unpack-info', data['unpack-info']),
             }
             if any(['compression-info' in c and not c.get('decompress-on-load', False) for c in choices]):
-                InstParams['compression-info'] = lambda cid, data: data.get('compression-info')
+                InstParams['compression-info'] = lambda cid, data: ('compression-info', data['compression-info'])
             InstCmds = {
                 'offset': lambda cid, data: mkCommand(
                     cid, 'condition-component-offset', None)
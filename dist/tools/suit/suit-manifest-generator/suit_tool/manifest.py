@@ -443,7 +443,13 @@ class SUITCompressionInfo(SUITKeyMap):
         'bzip2' : 2,
         'deflate' : 3,
         'lz4' : 4,
-        'lzma' : 7
+        'lzma' : 7,
+        'heatshrink' : -1
+    })
+
+class SUITUnpackInfo(SUITKeyMap):
+    rkeymap, keymap = SUITKeyMap.mkKeyMaps({
+        'delta' : 1
     })
 
 class SUITParameters(SUITManifestDict):
@@ -455,6 +461,7 @@ class SUITParameters(SUITManifestDict):
         'uri' : ('uri', 21, SUITTStr),
         'src' : ('source-component', 22, SUITComponentIndex),
         'compress' : ('compression-info', 19, SUITCompressionInfo),
+        'unpack' : ('unpack-info', 20, SUITUnpackInfo),
         'offset' : ('offset', 5, SUITPosInt)
     })
     def from_json(self, j):
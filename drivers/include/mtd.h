@@ -99,6 +99,11 @@ enum mtd_power_state {
  */
 typedef struct mtd_desc mtd_desc_t;
 
+/**
+ * @brief   Asynchronous MTD request forward declaration
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
 /**
  * @brief   MTD device descriptor
  *
@@ -310,6 +315,41 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write back data buffered by the driver (optional)
+     *
+     * Only needed by drivers that do not write data to the memory right away,
+     * such as @ref drivers_mtd_cache.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+    /**
+     * @brief   Perform the next step of an asynchronous request (optional)
+     *
+     * Must not block for long. A driver that has started an operation and
+     * has to wait for the device to become ready returns the time to wait
+     * instead. It is called again with the same request afterwards and
+     * can use @ref mtd_async_req_t::state to keep track of its progress.
+     *
+     * If not implemented, the request is processed with the blocking
+     * functions.
+     *
+     * @param[in]       dev     Pointer to the selected driver
+     * @param[in,out]   req     request to advance, see @ref drivers_mtd_async
+     *
+     * @retval 0 request completed successfully
+     * @retval >0 microseconds to wait before calling again
+     * @retval <0 request failed
+     */
+    int (*async_step)(mtd_dev_t *dev, mtd_async_req_t *req);
+#endif
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -520,6 +560,20 @@ int mtd_write_sector(mtd_dev_t *mtd, const void *src, uint32_t sector, uint32_t
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write back all data buffered by the driver of a MTD device
+ *
+ * File systems call this when they are synced, so that the data is persistent
+ * once e.g. @ref vfs_fsync returns.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @retval 0 on success, or if the driver does not buffer data
+ * @retval -ENODEV if @p mtd is not a valid device
+ * @retval <0 if an error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 /**
  * @brief   Get an MTD device by index
  *
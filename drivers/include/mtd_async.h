@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_async Asynchronous MTD access
+ * @ingroup     drivers_mtd
+ * @brief       Queued MTD read, program and erase requests with completion
+ *              events
+ *
+ * All @ref drivers_mtd functions block the calling thread until the
+ * operation is complete. For a sector erase of a SPI NOR flash, this is
+ * 50 to 400 ms. This module lets a thread submit read, program and erase
+ * requests instead. It gets an @ref event_t posted to an event queue of its
+ * choice once a request is complete.
+ *
+ * Requests are handled by a single worker thread. Requests to the same device
+ * are handled in the order they were submitted. Requests to different
+ * devices are interleaved.
+ *
+ * Drivers can implement @ref mtd_desc_t::async_step to split requests into
+ * non-blocking steps. A driver that only has to wait for the memory to become
+ * ready returns the time to wait instead of polling. The worker handles other
+ * devices in the meantime and sleeps when there is nothing to do. For all
+ * other drivers, the worker thread calls the blocking @ref drivers_mtd
+ * functions. This still frees the submitting thread, but a long operation
+ * delays requests to other devices.
+ *
+ * A device must not be accessed with the blocking @ref drivers_mtd functions
+ * while asynchronous requests to it are pending. Drivers implementing
+ * @ref mtd_desc_t::async_step may reject such access with `-EBUSY` while
+ * the device carries out a program or erase command, e.g. `mtd_spi_nor`.
+ *
+ * Usage:
+ *
+ * ```C
+ * static void _erased(event_t *event)
+ * {
+ *     mtd_async_req_t *req = container_of(event, mtd_async_req_t, event);
+ *     printf("erase done: %d\n", mtd_async_result(req));
+ * }
+ *
+ * static mtd_async_req_t req;
+ *
+ * mtd_async_req_init(&req, EVENT_PRIO_MEDIUM, _erased);
+ * mtd_async_erase_sector(&req, mtd0, 0, 1);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD access
+ */
+
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    drivers_mtd_async_conf Asynchronous MTD configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Priority of the worker thread
+ */
+#ifndef CONFIG_MTD_ASYNC_PRIO
+#  define CONFIG_MTD_ASYNC_PRIO         (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Stack size of the worker thread
+ */
+#ifndef CONFIG_MTD_ASYNC_STACKSIZE
+#  define CONFIG_MTD_ASYNC_STACKSIZE    (THREAD_STACKSIZE_DEFAULT)
+#endif
+/** @} */
+
+/**
+ * @brief   Operations of an asynchronous request
+ */
+typedef enum {
+    MTD_ASYNC_READ,         /**< read, see @ref mtd_read_page */
+    MTD_ASYNC_WRITE,        /**< program, see @ref mtd_write_page_raw */
+    MTD_ASYNC_ERASE,        /**< erase, see @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Asynchronous MTD request
+ *
+ * The fields other than @ref mtd_async_req_t::event must not be accessed
+ * while the request is pending. Drivers implementing
+ * @ref mtd_desc_t::async_step advance @ref mtd_async_req_t::buf,
+ * @ref mtd_async_req_t::block, @ref mtd_async_req_t::offset and
+ * @ref mtd_async_req_t::size while they process the request.
+ */
+struct mtd_async_req {
+    event_t event;                  /**< posted once the request is complete */
+    struct mtd_async_req *next;     /**< next pending request */
+    event_queue_t *queue;           /**< queue to post @ref event to */
+    mtd_dev_t *mtd;                 /**< device to operate on */
+    union {
+        void *dest;                 /**< destination of a read */
+        const void *src;            /**< source of a write */
+    } buf;                          /**< data buffer, unused for erase */
+    uint32_t block;                 /**< page (read, write) or sector (erase) */
+    uint32_t offset;                /**< byte offset within the page */
+    uint32_t size;                  /**< bytes (read, write) or sectors (erase) */
+    uint32_t resume;                /**< time stamp of the next step in us */
+    uint32_t state;                 /**< driver private, 0 on submission */
+    int res;                        /**< result once complete */
+    uint8_t op;                     /**< operation, see @ref mtd_async_op_t */
+};
+
+/**
+ * @brief   Start the worker thread
+ *
+ * Called by auto_init.
+ */
+void mtd_async_init(void);
+
+/**
+ * @brief   Initialize a request
+ *
+ * @param[out]  req     request to initialize
+ * @param[in]   queue   event queue to post the completion event to
+ * @param[in]   handler handler of the completion event
+ */
+void mtd_async_req_init(mtd_async_req_t *req, event_queue_t *queue,
+                        event_handler_t handler);
+
+/**
+ * @brief   Submit an asynchronous read
+ *
+ * Same as @ref mtd_read_page, but returns right away. @p dest must stay valid
+ * until the completion event is handled.
+ *
+ * @param[in,out]   req     initialized request, must not be pending
+ * @param[in]       mtd     device to read from
+ * @param[out]      dest    buffer to fill in
+ * @param[in]       page    page number to start reading from
+ * @param[in]       offset  offset from the start of the page (in bytes)
+ * @param[in]       size    number of bytes to read
+ *
+ * @retval  0           request submitted
+ * @retval  -ENODEV     @p mtd is not a valid device
+ * @retval  -EOVERFLOW  the range is outside of the device
+ */
+int mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t size);
+
+/**
+ * @brief   Submit an asynchronous program operation
+ *
+ * Same as @ref mtd_write_page_raw, but returns right away. @p src must stay
+ * valid until the completion event is handled.
+ *
+ * @param[in,out]   req     initialized request, must not be pending
+ * @param[in]       mtd     device to write to
+ * @param[in]       src     data to write
+ * @param[in]       page    page number to start writing to
+ * @param[in]       offset  byte offset from the start of the page
+ * @param[in]       size    number of bytes to write
+ *
+ * @retval  0           request submitted
+ * @retval  -ENODEV     @p mtd is not a valid device
+ * @retval  -EOVERFLOW  the range is outside of the device
+ */
+int mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t size);
+
+/**
+ * @brief   Submit an asynchronous erase
+ *
+ * Same as @ref mtd_erase_sector, but returns right away.
+ *
+ * @param[in,out]   req     initialized request, must not be pending
+ * @param[in]       mtd     device to erase
+ * @param[in]       sector  first sector to erase
+ * @param[in]       count   number of sectors to erase
+ *
+ * @retval  0           request submitted
+ * @retval  -ENODEV     @p mtd is not a valid device
+ * @retval  -EOVERFLOW  the range is outside of the device
+ */
+int mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t count);
+
+/**
+ * @brief   Get the result of a completed request
+ *
+ * @return  the result of the corresponding synchronous @ref drivers_mtd
+ *          function
+ */
+static inline int mtd_async_result(const mtd_async_req_t *req)
+{
+    return req->res;
+}
+
+/**
+ * @brief   Mark @p len bytes (read, write) or sectors (erase) of @p req as
+ *          done
+ *
+ * For use by drivers implementing @ref mtd_desc_t::async_step.
+ *
+ * @param[in,out]   req     request to advance
+ * @param[in]       len     bytes or sectors done
+ */
+void mtd_async_advance(mtd_async_req_t *req, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
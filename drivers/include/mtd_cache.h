@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_cache MTD write-back sector cache
+ * @ingroup     drivers_mtd
+ * @brief       Keeps recently written sectors of a MTD device in RAM
+ *
+ * Without this module, every write of a few bytes to a MTD device that
+ * requires an erase before it can be written again costs a sector erase and
+ * the programming of a whole sector: @ref mtd_write_page reads the sector,
+ * erases it and writes it back. File systems such as FatFs update the same
+ * sectors (FAT, directory entries) over and over again.
+ *
+ * This module puts a cache of a few sectors in front of such a device. Writes
+ * and erases only modify the copy in RAM. A modified sector is written back
+ * (erased and programmed) when its slot is needed for another sector, with
+ * the least recently used slot being evicted first, when @ref mtd_flush is
+ * called and before the device is powered down. Reads of cached sectors are
+ * served from RAM, all other reads are passed through to the backing device.
+ *
+ * The cache device can be written without erasing it first (it has
+ * @ref MTD_DRIVER_FLAG_DIRECT_WRITE set), so @ref mtd_write_page does not need
+ * the `mtd_write_page` work area.
+ *
+ * Erasing a sector of the cache device fills it with `0xff`, regardless of
+ * the erased state of the backing device.
+ *
+ * @warning Data written to the cache is lost on a power failure or reset until
+ *          it is flushed. The FatFs and littlefs glue code flushes the
+ *          device when a file is synced or closed.
+ *
+ * ## Usage
+ *
+ * ```C
+ * MTD_CACHE_DEV(mtd_cache0, 2, 4096);
+ *
+ * int main(void)
+ * {
+ *     mtd_cache0.parent = MTD_0;
+ *     mtd_init(&mtd_cache0.mtd);
+ *     ...
+ * }
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back sector cache
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sector number of an unused cache slot
+ */
+#define MTD_CACHE_SECTOR_NONE   (UINT32_MAX)
+
+/**
+ * @brief   Define a cache device and its buffers
+ *
+ * The backing device (@ref mtd_cache_t::parent) has to be set before the
+ * cache device is initialized, unless it is a constant expression and can be
+ * given with a designated initializer.
+ *
+ * @param   name        name of the @ref mtd_cache_t variable
+ * @param   n           number of sectors to cache
+ * @param   sector_size size of a sector of the backing device in bytes
+ */
+#define MTD_CACHE_DEV(name, n, sector_size)                             \
+    static uint8_t name ## _buf[(n) * (sector_size)];                   \
+    static mtd_cache_slot_t name ## _slots[n];                          \
+    mtd_cache_t name = {                                                \
+        .mtd = { .driver = &mtd_cache_driver },                         \
+        .lock = MUTEX_INIT,                                             \
+        .slots = name ## _slots,                                        \
+        .slots_numof = (n),                                             \
+        .buf = name ## _buf,                                            \
+        .buf_size = sizeof(name ## _buf),                               \
+    }
+
+/**
+ * @brief   A cached sector
+ */
+typedef struct {
+    uint32_t sector;    /**< cached sector, @ref MTD_CACHE_SECTOR_NONE if unused */
+    uint32_t last_use;  /**< value of @ref mtd_cache_t::clock on last access */
+    bool dirty;         /**< sector was modified and has to be written back */
+} mtd_cache_slot_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t read_hits;     /**< reads served from the cache */
+    uint32_t read_misses;   /**< reads passed through to the backing device */
+    uint32_t write_hits;    /**< writes and erases to a cached sector */
+    uint32_t write_misses;  /**< writes and erases that had to load a sector */
+    uint32_t write_backs;   /**< sectors erased and programmed on the backing
+                                 device */
+    uint32_t erases_saved;  /**< writes and erases to an already modified
+                                 sector, each would have cost an erase
+                                 without the cache */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   Cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context, geometry is taken from
+                                     @ref mtd_cache_t::parent on init */
+    mtd_dev_t *parent;          /**< backing device */
+    mutex_t lock;               /**< protects the cache */
+    mtd_cache_slot_t *slots;    /**< slot descriptors */
+    uint8_t *buf;               /**< sector buffers of all slots */
+    uint32_t buf_size;          /**< size of @ref mtd_cache_t::buf in bytes */
+    uint32_t clock;             /**< access counter for LRU eviction */
+    uint8_t slots_numof;        /**< number of slots */
+    mtd_cache_stats_t stats;    /**< statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Get a copy of the statistics of a cache device
+ *
+ * @param[in]   cache   cache device
+ * @param[out]  stats   statistics
+ */
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+/**
+ * @brief   Clear the statistics of a cache device
+ *
+ * @param[in]   cache   cache device
+ */
+void mtd_cache_reset_stats(mtd_cache_t *cache);
+
+/**
+ * @brief   Print the statistics of a cache device
+ *
+ * @param[in]   cache   cache device
+ */
+void mtd_cache_print_stats(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
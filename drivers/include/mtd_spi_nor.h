@@ -20,6 +20,7 @@
  * @author      Vincent Dupont <vincent@otakeys.com>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "periph_conf.h"
@@ -151,6 +152,14 @@ typedef struct {
      * Computed by mtd_spi_nor_init, no need to touch outside the driver.
      */
     uint8_t addr_width;
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+    /**
+     * @brief   an asynchronous program or erase command is in progress
+     *
+     * Synchronous access fails with -EBUSY until the command completed.
+     */
+    bool async_busy;
+#endif
 } mtd_spi_nor_t;
 
 /**
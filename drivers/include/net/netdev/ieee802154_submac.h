@@ -27,6 +27,9 @@ extern "C" {
 #include "net/netdev/ieee802154.h"
 #include "net/ieee802154/submac.h"
 #include "net/ieee802154/radio.h"
+#if IS_USED(MODULE_IEEE802154_TSCH)
+#include "net/ieee802154/tsch.h"
+#endif
 #include "ztimer.h"
 
 #include "od.h"
@@ -38,6 +41,7 @@ extern "C" {
 #define NETDEV_SUBMAC_FLAGS_RX_DONE     (1 << 2)    /**< Flag for RX Done event */
 #define NETDEV_SUBMAC_FLAGS_CRC_ERROR   (1 << 3)    /**< Flag for CRC ERROR event */
 #define NETDEV_SUBMAC_FLAGS_BH_REQUEST  (1 << 4)    /**< Flag for Bottom Half request event */
+#define NETDEV_SUBMAC_FLAGS_TSCH        (1 << 5)    /**< Flag for TSCH Bottom Half request event */
 
 /**
  * @brief IEEE 802.15.4 SubMAC netdev descriptor
@@ -51,6 +55,9 @@ typedef struct {
     int8_t retrans;                     /**< number of frame retransmissions of the last TX */
     bool dispatch;                      /**< whether an event should be dispatched or not */
     netdev_event_t ev;                  /**< event to be dispatched */
+#if IS_USED(MODULE_IEEE802154_TSCH) || defined(DOXYGEN)
+    ieee802154_tsch_t tsch;             /**< TSCH MAC driving the radio */
+#endif
 } netdev_ieee802154_submac_t;
 
 /**
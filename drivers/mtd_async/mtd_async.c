@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD access implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "bitarithm.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Thread flag signaling a new request to the worker
+ */
+#define FLAG_SUBMIT     (0x1)
+
+static char _stack[CONFIG_MTD_ASYNC_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+/* FIFO of pending requests, protected by _lock */
+static mtd_async_req_t *_reqs;
+static mutex_t _lock = MUTEX_INIT;
+
+/**
+ * @brief   Check whether @p req is the oldest pending request of its device
+ */
+static bool _is_head(const mtd_async_req_t *req)
+{
+    for (const mtd_async_req_t *r = _reqs; r != req; r = r->next) {
+        if (r->mtd == req->mtd) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _remove(mtd_async_req_t *req)
+{
+    mtd_async_req_t **r = &_reqs;
+
+    while (*r != req) {
+        r = &(*r)->next;
+    }
+    *r = req->next;
+}
+
+/**
+ * @brief   Process a request with the blocking MTD functions
+ */
+static int _step_blocking(mtd_async_req_t *req)
+{
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        return mtd_read_page(req->mtd, req->buf.dest, req->block, req->offset,
+                             req->size);
+    case MTD_ASYNC_WRITE:
+        return mtd_write_page_raw(req->mtd, req->buf.src, req->block,
+                                  req->offset, req->size);
+    case MTD_ASYNC_ERASE:
+        return mtd_erase_sector(req->mtd, req->block, req->size);
+    default:
+        return -EINVAL;
+    }
+}
+
+static int _step(mtd_async_req_t *req)
+{
+    if (req->mtd->driver->async_step) {
+        return req->mtd->driver->async_step(req->mtd, req);
+    }
+    return _step_blocking(req);
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    ztimer_t timeout = { 0 };
+
+    while (1) {
+        uint32_t wait = UINT32_MAX;
+
+        mutex_lock(&_lock);
+        mtd_async_req_t *req = _reqs;
+        /* give the oldest request of each device one step per pass */
+        while (req) {
+            int32_t until = (int32_t)(req->resume - ztimer_now(ZTIMER_USEC));
+
+            if (!_is_head(req)) {
+                req = req->next;
+                continue;
+            }
+            if (until > 0) {
+                wait = ((uint32_t)until < wait) ? (uint32_t)until : wait;
+                req = req->next;
+                continue;
+            }
+
+            /* new requests may be submitted while this one is processed */
+            mutex_unlock(&_lock);
+            int res = _step(req);
+            mutex_lock(&_lock);
+
+            mtd_async_req_t *next = req->next;
+            if (res > 0) {
+                DEBUG("mtd_async: %p waits %d us\n", (void *)req, res);
+                req->resume = ztimer_now(ZTIMER_USEC) + res;
+                wait = ((uint32_t)res < wait) ? (uint32_t)res : wait;
+            }
+            else {
+                DEBUG("mtd_async: %p done: %d\n", (void *)req, res);
+                _remove(req);
+                req->next = NULL;
+                req->res = res;
+                event_post(req->queue, &req->event);
+            }
+            req = next;
+        }
+        mutex_unlock(&_lock);
+
+        if (wait == UINT32_MAX) {
+            thread_flags_wait_any(FLAG_SUBMIT);
+        }
+        else {
+            ztimer_set_timeout_flag(ZTIMER_USEC, &timeout, wait);
+            thread_flags_wait_any(FLAG_SUBMIT | THREAD_FLAG_TIMEOUT);
+            ztimer_remove(ZTIMER_USEC, &timeout);
+        }
+    }
+
+    return NULL;
+}
+
+void mtd_async_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    _pid = thread_create(_stack, sizeof(_stack), CONFIG_MTD_ASYNC_PRIO, 0,
+                         _worker, NULL, "mtd_async");
+}
+
+void mtd_async_req_init(mtd_async_req_t *req, event_queue_t *queue,
+                        event_handler_t handler)
+{
+    *req = (mtd_async_req_t) {
+        .event = { .handler = handler },
+        .queue = queue,
+    };
+}
+
+static int _submit(mtd_async_req_t *req, mtd_dev_t *mtd, uint8_t op)
+{
+    assert(_pid != KERNEL_PID_UNDEF);
+
+    req->mtd = mtd;
+    req->op = op;
+    req->next = NULL;
+    req->state = 0;
+    req->res = 0;
+    req->resume = ztimer_now(ZTIMER_USEC);
+
+    mutex_lock(&_lock);
+    mtd_async_req_t **r = &_reqs;
+    while (*r) {
+        assert(*r != req);
+        r = &(*r)->next;
+    }
+    *r = req;
+    mutex_unlock(&_lock);
+
+    thread_flags_set(thread_get(_pid), FLAG_SUBMIT);
+    return 0;
+}
+
+/**
+ * @brief   Check a byte range and normalize @p offset to be within the page
+ */
+static int _check_range(mtd_dev_t *mtd, uint32_t *page, uint32_t *offset,
+                        uint32_t size)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    const uint32_t page_shift = bitarithm_msb(mtd->page_size);
+    const uint32_t pages_numof = mtd->sector_count * mtd->pages_per_sector;
+
+    *page += *offset >> page_shift;
+    *offset &= mtd->page_size - 1;
+
+    if ((*page >= pages_numof) ||
+        (size && (*page + ((*offset + size - 1) >> page_shift) >= pages_numof))) {
+        return -EOVERFLOW;
+    }
+    return 0;
+}
+
+int mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t size)
+{
+    int res = _check_range(mtd, &page, &offset, size);
+
+    if (res < 0) {
+        return res;
+    }
+
+    req->buf.dest = dest;
+    req->block = page;
+    req->offset = offset;
+    req->size = size;
+    return _submit(req, mtd, MTD_ASYNC_READ);
+}
+
+int mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t size)
+{
+    int res = _check_range(mtd, &page, &offset, size);
+
+    if (res < 0) {
+        return res;
+    }
+
+    req->buf.src = src;
+    req->block = page;
+    req->offset = offset;
+    req->size = size;
+    return _submit(req, mtd, MTD_ASYNC_WRITE);
+}
+
+int mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t count)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+    if ((sector + count > mtd->sector_count) || (sector + count < sector)) {
+        return -EOVERFLOW;
+    }
+
+    req->buf.dest = NULL;
+    req->block = sector;
+    req->offset = 0;
+    req->size = count;
+    return _submit(req, mtd, MTD_ASYNC_ERASE);
+}
+
+void mtd_async_advance(mtd_async_req_t *req, uint32_t len)
+{
+    assert(len <= req->size);
+
+    req->size -= len;
+    if (req->op == MTD_ASYNC_ERASE) {
+        req->block += len;
+        return;
+    }
+
+    const uint32_t page_shift = bitarithm_msb(req->mtd->page_size);
+
+    req->buf.src = (const uint8_t *)req->buf.src + len;
+    req->offset += len;
+    req->block += req->offset >> page_shift;
+    req->offset &= req->mtd->page_size - 1;
+}
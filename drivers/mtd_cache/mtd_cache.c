@@ -0,0 +1,295 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back sector cache implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/utils.h"
+#include "mtd_cache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Content of an erased sector
+ */
+#define ERASED_BYTE     (0xff)
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_slot_buf(const mtd_cache_t *cache, const mtd_cache_slot_t *slot)
+{
+    return cache->buf + (slot - cache->slots) * _sector_size(cache);
+}
+
+static mtd_cache_slot_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        if (cache->slots[i].sector == sector) {
+            cache->slots[i].last_use = ++cache->clock;
+            return &cache->slots[i];
+        }
+    }
+    return NULL;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_slot_t *slot)
+{
+    if (!slot->dirty) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 "\n", slot->sector);
+
+    int res = mtd_write_sector(cache->parent, _slot_buf(cache, slot),
+                               slot->sector, 1);
+    if (res < 0) {
+        return res;
+    }
+
+    slot->dirty = false;
+    cache->stats.write_backs++;
+    return 0;
+}
+
+/**
+ * @brief   Get the slot of @p sector, evicting the least recently used slot
+ *          if it is not cached
+ *
+ * @param[in]   cache   cache device
+ * @param[in]   sector  sector to look up
+ * @param[in]   load    whether to read the sector from the backing device
+ *                      if it is not cached yet
+ * @param[out]  res     error code if `NULL` is returned
+ */
+static mtd_cache_slot_t *_get(mtd_cache_t *cache, uint32_t sector, bool load,
+                              int *res)
+{
+    mtd_cache_slot_t *slot = _find(cache, sector);
+
+    if (slot) {
+        cache->stats.write_hits++;
+        if (slot->dirty) {
+            cache->stats.erases_saved++;
+        }
+        return slot;
+    }
+
+    cache->stats.write_misses++;
+
+    /* use a free slot or evict the least recently used one */
+    slot = &cache->slots[0];
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        mtd_cache_slot_t *s = &cache->slots[i];
+        if (s->sector == MTD_CACHE_SECTOR_NONE) {
+            slot = s;
+            break;
+        }
+        if ((int32_t)(s->last_use - slot->last_use) < 0) {
+            slot = s;
+        }
+    }
+
+    *res = _write_back(cache, slot);
+    if (*res < 0) {
+        return NULL;
+    }
+
+    slot->sector = MTD_CACHE_SECTOR_NONE;
+    if (load) {
+        *res = mtd_read_page(cache->parent, _slot_buf(cache, slot),
+                             sector * cache->mtd.pages_per_sector, 0,
+                             _sector_size(cache));
+        if (*res < 0) {
+            return NULL;
+        }
+    }
+
+    slot->sector = sector;
+    slot->last_use = ++cache->clock;
+    return slot;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = 1;
+
+    if (cache->slots_numof * _sector_size(cache) > cache->buf_size) {
+        return -ENOMEM;
+    }
+
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        cache->slots[i] = (mtd_cache_slot_t) { .sector = MTD_CACHE_SECTOR_NONE };
+    }
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    offset += (page - sector * mtd->pages_per_sector) * mtd->page_size;
+    size = MIN(size, _sector_size(cache) - offset);
+
+    mutex_lock(&cache->lock);
+
+    int res = 0;
+    mtd_cache_slot_t *slot = _find(cache, sector);
+    if (slot) {
+        cache->stats.read_hits++;
+        memcpy(dest, _slot_buf(cache, slot) + offset, size);
+    }
+    else {
+        cache->stats.read_misses++;
+        res = mtd_read_page(cache->parent, dest,
+                            sector * mtd->pages_per_sector, offset, size);
+    }
+
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)size;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    offset += (page - sector * mtd->pages_per_sector) * mtd->page_size;
+    size = MIN(size, _sector_size(cache) - offset);
+
+    mutex_lock(&cache->lock);
+
+    int res = 0;
+    /* no need to read the old content if all of it is overwritten */
+    bool load = (offset != 0) || (size != _sector_size(cache));
+    mtd_cache_slot_t *slot = _get(cache, sector, load, &res);
+    if (slot) {
+        memcpy(_slot_buf(cache, slot) + offset, src, size);
+        slot->dirty = true;
+    }
+
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)size;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+
+    for (; count; count--, sector++) {
+        mtd_cache_slot_t *slot = _get(cache, sector, false, &res);
+        if (!slot) {
+            break;
+        }
+        memset(_slot_buf(cache, slot), ERASED_BYTE, _sector_size(cache));
+        slot->dirty = true;
+    }
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+
+    for (unsigned i = 0; (i < cache->slots_numof) && (res == 0); i++) {
+        res = _write_back(cache, &cache->slots[i]);
+    }
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_power(cache->parent, power);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
+
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+void mtd_cache_reset_stats(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+}
+
+void mtd_cache_print_stats(mtd_cache_t *cache)
+{
+    mtd_cache_stats_t stats;
+    mtd_cache_get_stats(cache, &stats);
+
+    uint32_t reads = stats.read_hits + stats.read_misses;
+    uint32_t writes = stats.write_hits + stats.write_misses;
+
+    printf("read hits:    %" PRIu32 "/%" PRIu32 " (%" PRIu32 "%%)\n",
+           stats.read_hits, reads, reads ? (100 * stats.read_hits / reads) : 0);
+    printf("write hits:   %" PRIu32 "/%" PRIu32 " (%" PRIu32 "%%)\n",
+           stats.write_hits, writes,
+           writes ? (100 * stats.write_hits / writes) : 0);
+    printf("write backs:  %" PRIu32 "\n", stats.write_backs);
+    printf("erases saved: %" PRIu32 "\n", stats.erases_saved);
+}
@@ -19,6 +19,9 @@
 #include "kernel_defines.h"
 #include "macros/utils.h"
 #include "mtd.h"
+#if IS_USED(MODULE_MTD_ASYNC)
+#include "mtd_async.h"
+#endif
 #include "mtd_sdcard.h"
 #include "sdcard_spi.h"
 #include "sdcard_spi_internal.h"
@@ -194,6 +197,44 @@ static int mtd_sdcard_read(mtd_dev_t *dev, void *buff, uint32_t addr,
     return -EOVERFLOW;
 }
 
+#if IS_USED(MODULE_MTD_ASYNC)
+static int mtd_sdcard_async_step(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    uint32_t len;
+    int res;
+
+    if (req->size == 0) {
+        return 0;
+    }
+
+    /* transfer one block per step, so that requests to other devices on the
+     * same bus are not delayed by long transfers */
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        len = MIN(req->size, SD_HC_BLOCK_SIZE - req->offset);
+        res = mtd_sdcard_read_page(dev, req->buf.dest, req->block, req->offset, len);
+        break;
+    case MTD_ASYNC_WRITE:
+        len = MIN(req->size, SD_HC_BLOCK_SIZE - req->offset);
+        res = mtd_sdcard_write_page(dev, req->buf.src, req->block, req->offset, len);
+        break;
+    case MTD_ASYNC_ERASE:
+        len = 1;
+        res = mtd_sdcard_erase_sector(dev, req->block, len);
+        break;
+    default:
+        return -EINVAL;
+    }
+
+    if (res < 0) {
+        return res;
+    }
+    mtd_async_advance(req, len);
+
+    return req->size ? 1 : 0;
+}
+#endif
+
 const mtd_desc_t mtd_sdcard_driver = {
     .init = mtd_sdcard_init,
     .read = mtd_sdcard_read,
@@ -201,6 +242,9 @@ const mtd_desc_t mtd_sdcard_driver = {
     .write_page = mtd_sdcard_write_page,
     .erase_sector = mtd_sdcard_erase_sector,
     .power = mtd_sdcard_power,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .async_step = mtd_sdcard_async_step,
+#endif
 };
 
 #if IS_USED(MODULE_MTD_SDCARD_DEFAULT)
@@ -27,6 +27,9 @@
 #include "macros/math.h"
 #include "macros/utils.h"
 #include "mtd.h"
+#if IS_USED(MODULE_MTD_ASYNC)
+#include "mtd_async.h"
+#endif
 #include "mtd_spi_nor.h"
 #include "time_units.h"
 #include "thread.h"
@@ -62,6 +65,11 @@
 
 #define MBIT_AS_BYTES       ((1024 * 1024) / 8)
 
+/**
+ * @brief   Interval to poll the status register at in asynchronous mode
+ */
+#define MTD_SPI_NOR_ASYNC_POLL_US   (100U)
+
 /**
  * @brief   JEDEC memory manufacturer ID codes.
  *
@@ -398,6 +406,22 @@ static inline void wait_for_write_complete(const mtd_spi_nor_t *dev, uint32_t us
     DEBUG("\n");
 }
 
+/**
+ * @brief   Check whether an asynchronous command still occupies the device
+ *
+ * The SPI bus must be acquired. The device does not accept any command but
+ * the status read while a program or erase command is in progress.
+ */
+static inline bool _async_busy(const mtd_spi_nor_t *dev)
+{
+#if IS_USED(MODULE_MTD_ASYNC)
+    return dev->async_busy;
+#else
+    (void)dev;
+    return false;
+#endif
+}
+
 static void _init_pins(mtd_spi_nor_t *dev)
 {
     DEBUG("mtd_spi_nor_init: init pins\n");
@@ -429,6 +453,10 @@ static int mtd_spi_nor_power(mtd_dev_t *mtd, enum mtd_power_state power)
     mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
 
     mtd_spi_acquire(dev);
+    if (_async_busy(dev)) {
+        mtd_spi_release(dev);
+        return -EBUSY;
+    }
     switch (power) {
         case MTD_POWER_UP:
             mtd_spi_cmd(dev, dev->params->opcode->wake);
@@ -488,6 +516,10 @@ static int mtd_spi_nor_init(mtd_dev_t *mtd)
     /* CS, WP, Hold */
     _init_pins(dev);
 
+#if IS_USED(MODULE_MTD_ASYNC)
+    dev->async_busy = false;
+#endif
+
     /* power up the MTD device*/
     DEBUG_PUTS("mtd_spi_nor_init: power up MTD device");
     if (mtd_spi_nor_power(mtd, MTD_POWER_UP)) {
@@ -594,6 +626,10 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
     }
 
     mtd_spi_acquire(dev);
+    if (_async_busy(dev)) {
+        mtd_spi_release(dev);
+        return -EBUSY;
+    }
     mtd_spi_cmd_addr_read(dev, dev->params->opcode->read, addr, dest, size);
     mtd_spi_release(dev);
 
@@ -614,6 +650,10 @@ static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page
     uint32_t addr = page * mtd->page_size + offset;
 
     mtd_spi_acquire(dev);
+    if (_async_busy(dev)) {
+        mtd_spi_release(dev);
+        return -EBUSY;
+    }
 
     /* write enable */
     mtd_spi_cmd(dev, dev->params->opcode->wren);
@@ -629,6 +669,54 @@ static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page
     return size;
 }
 
+/**
+ * @brief   Issue the largest erase command that fits @p addr and @p size
+ *
+ * Write enable must have been sent before.
+ *
+ * @param[in]   dev     device to erase
+ * @param[in]   addr    start address of the remaining range to erase
+ * @param[in]   size    size of the remaining range to erase
+ * @param[out]  us      typical duration of the erase command
+ *
+ * @return  number of bytes erased by the command, 0 if no command fits
+ */
+static uint32_t mtd_spi_erase_cmd(const mtd_spi_nor_t *dev, uint32_t addr,
+                                  uint32_t size, uint32_t *us)
+{
+    const mtd_dev_t *mtd = &dev->base;
+    uint32_t total_size = mtd->page_size * mtd->pages_per_sector * mtd->sector_count;
+
+    if (size == total_size) {
+        mtd_spi_cmd(dev, dev->params->opcode->chip_erase);
+        *us = dev->params->wait_chip_erase;
+        return total_size;
+    }
+    else if ((dev->params->flag & SPI_NOR_F_SECT_64K) && (size >= MTD_64K) &&
+             ((addr & MTD_64K_ADDR_MASK) == 0)) {
+        /* 64 KiB blocks can be erased with block erase command */
+        mtd_spi_cmd_addr_write(dev, dev->params->opcode->block_erase_64k, addr, NULL, 0);
+        *us = dev->params->wait_64k_erase;
+        return MTD_64K;
+    }
+    else if ((dev->params->flag & SPI_NOR_F_SECT_32K) && (size >= MTD_32K) &&
+             ((addr & MTD_32K_ADDR_MASK) == 0)) {
+        /* 32 KiB blocks can be erased with block erase command */
+        mtd_spi_cmd_addr_write(dev, dev->params->opcode->block_erase_32k, addr, NULL, 0);
+        *us = dev->params->wait_32k_erase;
+        return MTD_32K;
+    }
+    else if ((dev->params->flag & SPI_NOR_F_SECT_4K) && (size >= MTD_4K) &&
+             ((addr & MTD_4K_ADDR_MASK) == 0)) {
+        /* 4 KiB sectors can be erased with sector erase command */
+        mtd_spi_cmd_addr_write(dev, dev->params->opcode->sector_erase, addr, NULL, 0);
+        *us = dev->params->wait_sector_erase;
+        return MTD_4K;
+    }
+
+    return 0;
+}
+
 static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
 {
     DEBUG("mtd_spi_nor_erase: %p, 0x%" PRIx32 ", 0x%" PRIx32 "\n",
@@ -654,48 +742,26 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
     }
 
     mtd_spi_acquire(dev);
+    if (_async_busy(dev)) {
+        mtd_spi_release(dev);
+        return -EBUSY;
+    }
     while (size) {
         uint32_t us;
 
         /* write enable */
         mtd_spi_cmd(dev, dev->params->opcode->wren);
 
-        if (size == total_size) {
-            mtd_spi_cmd(dev, dev->params->opcode->chip_erase);
-            size -= total_size;
-            us = dev->params->wait_chip_erase;
-        }
-        else if ((dev->params->flag & SPI_NOR_F_SECT_64K) && (size >= MTD_64K) &&
-                 ((addr & MTD_64K_ADDR_MASK) == 0)) {
-            /* 64 KiB blocks can be erased with block erase command */
-            mtd_spi_cmd_addr_write(dev, dev->params->opcode->block_erase_64k, addr, NULL, 0);
-            addr += MTD_64K;
-            size -= MTD_64K;
-            us = dev->params->wait_64k_erase;
-        }
-        else if ((dev->params->flag & SPI_NOR_F_SECT_32K) && (size >= MTD_32K) &&
-                 ((addr & MTD_32K_ADDR_MASK) == 0)) {
-            /* 32 KiB blocks can be erased with block erase command */
-            mtd_spi_cmd_addr_write(dev, dev->params->opcode->block_erase_32k, addr, NULL, 0);
-            addr += MTD_32K;
-            size -= MTD_32K;
-            us = dev->params->wait_32k_erase;
-        }
-        else if ((dev->params->flag & SPI_NOR_F_SECT_4K) && (size >= MTD_4K) &&
-                 ((addr & MTD_4K_ADDR_MASK) == 0)) {
-            /* 4 KiB sectors can be erased with sector erase command */
-            mtd_spi_cmd_addr_write(dev, dev->params->opcode->sector_erase, addr, NULL, 0);
-            addr += MTD_4K;
-            size -= MTD_4K;
-            us = dev->params->wait_sector_erase;
-        }
-        else {
+        uint32_t erased = mtd_spi_erase_cmd(dev, addr, size, &us);
+        if (erased == 0) {
             /* no suitable erase block found */
             assert(0);
 
             mtd_spi_release(dev);
             return -EINVAL;
         }
+        addr += erased;
+        size -= erased;
 
         /* waiting for the command to complete before continuing */
         wait_for_write_complete(dev, us);
@@ -705,10 +771,86 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
     return 0;
 }
 
+#if IS_USED(MODULE_MTD_ASYNC)
+static int mtd_spi_nor_async_step(mtd_dev_t *mtd, mtd_async_req_t *req)
+{
+    mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint32_t sector_size = mtd->page_size * mtd->pages_per_sector;
+    int res = 0;
+
+    mtd_spi_acquire(dev);
+
+    /* req->state holds the poll interval while a command is in progress */
+    if (req->state) {
+        uint8_t status;
+        mtd_spi_cmd_read(dev, dev->params->opcode->rdsr, &status, sizeof(status));
+        if (status & 1) {
+            res = req->state;
+            goto out;
+        }
+        req->state = 0;
+        dev->async_busy = false;
+    }
+
+    if (req->size == 0) {
+        goto out;
+    }
+
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        mtd_spi_cmd_addr_read(dev, dev->params->opcode->read,
+                              req->block * mtd->page_size + req->offset,
+                              req->buf.dest, req->size);
+        mtd_async_advance(req, req->size);
+        break;
+    case MTD_ASYNC_WRITE: {
+        uint32_t size = MIN(req->size, mtd->page_size - req->offset);
+
+        mtd_spi_cmd(dev, dev->params->opcode->wren);
+        mtd_spi_cmd_addr_write(dev, dev->params->opcode->page_program,
+                               req->block * mtd->page_size + req->offset,
+                               req->buf.src, size);
+        mtd_async_advance(req, size);
+        dev->async_busy = true;
+        req->state = MTD_SPI_NOR_ASYNC_POLL_US;
+        res = req->state;
+        break;
+    }
+    case MTD_ASYNC_ERASE: {
+        uint32_t us;
+
+        mtd_spi_cmd(dev, dev->params->opcode->wren);
+        uint32_t erased = mtd_spi_erase_cmd(dev, req->block * sector_size,
+                                            req->size * sector_size, &us);
+        if (erased == 0) {
+            res = -EINVAL;
+            break;
+        }
+        mtd_async_advance(req, erased / sector_size);
+        dev->async_busy = true;
+        /* first wait for the typical erase time, then poll more often */
+        req->state = MAX(us / 8, MTD_SPI_NOR_ASYNC_POLL_US);
+        res = MAX(us, req->state);
+        break;
+    }
+    default:
+        res = -EINVAL;
+    }
+
+out:
+    mtd_spi_release(dev);
+
+    return res;
+}
+#endif
+
 const mtd_desc_t mtd_spi_nor_driver = {
     .init = mtd_spi_nor_init,
     .read = mtd_spi_nor_read,
     .write_page = mtd_spi_nor_write_page,
     .erase = mtd_spi_nor_erase,
     .power = mtd_spi_nor_power,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .async_step = mtd_spi_nor_async_step,
+#endif
 };
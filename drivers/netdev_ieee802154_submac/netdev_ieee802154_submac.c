@@ -83,6 +83,12 @@ static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
         case NETOPT_TX_POWER:
             *((int16_t *)value) = netdev_submac->dev.txpower;
             return sizeof(int16_t);
+#if IS_USED(MODULE_IEEE802154_TSCH)
+        case NETOPT_PAN_COORD:
+            *((netopt_enable_t *)value) = netdev_submac->tsch.coordinator ? NETOPT_ENABLE
+                                                                         : NETOPT_DISABLE;
+            return sizeof(netopt_enable_t);
+#endif
         default:
             break;
     }
@@ -117,6 +123,50 @@ static int _set(netdev_t *netdev, netopt_t opt, const void *value,
     int res;
     int16_t tx_power;
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    switch (opt) {
+    case NETOPT_PAN_COORD:
+        if (*((const netopt_enable_t *)value)) {
+            ieee802154_tsch_start(&netdev_submac->tsch);
+        }
+        else {
+            ieee802154_tsch_scan(&netdev_submac->tsch);
+        }
+        return sizeof(netopt_enable_t);
+    case NETOPT_TSCH_SLOTFRAME: {
+        const ieee802154_tsch_slotframe_t *sf = value;
+
+        assert(value_len == sizeof(*sf));
+        if (sf->length == 0) {
+            ieee802154_tsch_slotframe_remove(&netdev_submac->tsch, sf->handle);
+            return sizeof(*sf);
+        }
+        res = ieee802154_tsch_slotframe_add(&netdev_submac->tsch, sf->handle,
+                                            sf->length);
+        return (res < 0) ? res : (int)sizeof(*sf);
+    }
+    case NETOPT_TSCH_CELL: {
+        const ieee802154_tsch_cell_t *cell = value;
+
+        assert(value_len == sizeof(*cell));
+        if (cell->options == 0) {
+            ieee802154_tsch_cell_remove(&netdev_submac->tsch, cell->slotframe,
+                                        cell->slot_offset);
+            return sizeof(*cell);
+        }
+        res = ieee802154_tsch_cell_add(&netdev_submac->tsch, cell);
+        return (res < 0) ? res : (int)sizeof(*cell);
+    }
+    case NETOPT_CHANNEL:
+    case NETOPT_STATE:
+    case NETOPT_PROMISCUOUSMODE:
+        /* the radio is driven by TSCH */
+        return -ENOTSUP;
+    default:
+        break;
+    }
+#endif
+
     switch (opt) {
     case NETOPT_ADDRESS:
         ieee802154_set_short_addr(submac, value);
@@ -163,6 +213,20 @@ void ieee802154_submac_bh_request(ieee802154_submac_t *submac)
     netdev->event_callback(netdev, NETDEV_EVENT_ISR);
 }
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+void ieee802154_tsch_bh_request(ieee802154_tsch_t *tsch)
+{
+    netdev_ieee802154_submac_t *netdev_submac = container_of(tsch,
+                                                             netdev_ieee802154_submac_t,
+                                                             tsch);
+
+    netdev_t *netdev = &netdev_submac->dev.netdev;
+    _isr_flags_set(netdev_submac, NETDEV_SUBMAC_FLAGS_TSCH);
+    DEBUG("IEEE802154 submac: ieee802154_tsch_bh_request(): post NETDEV_EVENT_ISR\n");
+    netdev->event_callback(netdev, NETDEV_EVENT_ISR);
+}
+#endif
+
 void ieee802154_submac_ack_timer_set(ieee802154_submac_t *submac)
 {
     netdev_ieee802154_submac_t *netdev_submac = container_of(submac,
@@ -190,6 +254,17 @@ static int _send(netdev_t *netdev, const iolist_t *pkt)
     netdev_ieee802154_submac_t *netdev_submac = container_of(netdev_ieee802154,
                                                              netdev_ieee802154_submac_t,
                                                              dev);
+
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    /* the frame is queued for its cell, TX is completed once it was
+     * acknowledged or dropped */
+    int res = ieee802154_tsch_send(&netdev_submac->tsch, pkt);
+    if (res < 0) {
+        return res;
+    }
+    netdev_submac->bytes_tx = res;
+    return 0;
+#else
     ieee802154_submac_t *submac = &netdev_submac->submac;
 
     int res = ieee802154_send(submac, pkt);
@@ -207,7 +282,46 @@ static int _send(netdev_t *netdev, const iolist_t *pkt)
     }
 
     return res;
+#endif
+}
+
+#if IS_USED(MODULE_IEEE802154_TSCH)
+static void _isr_tsch(netdev_ieee802154_submac_t *netdev_submac)
+{
+    netdev_t *netdev = &netdev_submac->dev.netdev;
+    ieee802154_tsch_t *tsch = &netdev_submac->tsch;
+    uint32_t flags;
+
+    while ((flags = _isr_flags_get_clear(netdev_submac,
+                                         NETDEV_SUBMAC_FLAGS_CRC_ERROR
+                                         | NETDEV_SUBMAC_FLAGS_TSCH
+                                         | NETDEV_SUBMAC_FLAGS_RX_DONE
+                                         | NETDEV_SUBMAC_FLAGS_TX_DONE))) {
+        if (flags & NETDEV_SUBMAC_FLAGS_CRC_ERROR) {
+            DEBUG("IEEE802154 submac: _isr_tsch(): NETDEV_SUBMAC_FLAGS_CRC_ERROR\n");
+            ieee802154_tsch_crc_error_cb(tsch);
+        }
+        if (flags & NETDEV_SUBMAC_FLAGS_TSCH) {
+            DEBUG("IEEE802154 submac: _isr_tsch(): NETDEV_SUBMAC_FLAGS_TSCH\n");
+            ieee802154_tsch_bh_process(tsch);
+        }
+        if (flags & NETDEV_SUBMAC_FLAGS_RX_DONE) {
+            DEBUG("IEEE802154 submac: _isr_tsch(): NETDEV_SUBMAC_FLAGS_RX_DONE\n");
+            ieee802154_tsch_rx_done_cb(tsch);
+        }
+        if (flags & NETDEV_SUBMAC_FLAGS_TX_DONE) {
+            DEBUG("IEEE802154 submac: _isr_tsch(): NETDEV_SUBMAC_FLAGS_TX_DONE\n");
+            ieee802154_tsch_tx_done_cb(tsch);
+        }
+        /* TSCH announces sent and received frames at the end of a slot */
+        if (netdev_submac->dispatch) {
+            netdev_submac->dispatch = false;
+            DEBUG("IEEE802154 submac: _isr_tsch(): dispatching %d\n", netdev_submac->ev);
+            netdev->event_callback(netdev, netdev_submac->ev);
+        }
+    }
 }
+#endif
 
 static void _isr(netdev_t *netdev)
 {
@@ -218,6 +332,11 @@ static void _isr(netdev_t *netdev)
     ieee802154_submac_t *submac = &netdev_submac->submac;
     uint32_t flags;
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    _isr_tsch(netdev_submac);
+    return;
+#endif
+
     do {
         flags = _isr_flags_get_clear(netdev_submac,
                                      NETDEV_SUBMAC_FLAGS_CRC_ERROR
@@ -286,11 +405,20 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     ieee802154_submac_t *submac = &netdev_submac->submac;
     ieee802154_rx_info_t rx_info;
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    (void)submac;
+    if (buf == NULL && len == 0) {
+        return ieee802154_tsch_get_frame_length(&netdev_submac->tsch);
+    }
+
+    int res = ieee802154_tsch_read_frame(&netdev_submac->tsch, buf, len, &rx_info);
+#else
     if (buf == NULL && len == 0) {
         return ieee802154_get_frame_length(submac);
     }
 
     int res = ieee802154_read_frame(submac, buf, len, &rx_info);
+#endif
 
     if (info) {
         netdev_ieee802154_rx_info_t *netdev_rx_info = info;
@@ -301,7 +429,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
         netdev_rx_info->lqi = rx_info.lqi;
     }
-#if IS_USED(MODULE_NETDEV_IEEE802154_SUBMAC_SOFT_ACK)
+#if IS_USED(MODULE_NETDEV_IEEE802154_SUBMAC_SOFT_ACK) && !IS_USED(MODULE_IEEE802154_TSCH)
     const uint8_t *mhr = buf;
     if ((mhr[0] & IEEE802154_FCF_TYPE_MASK) == IEEE802154_FCF_TYPE_DATA &&
         (mhr[0] & IEEE802154_FCF_ACK_REQ)) {
@@ -368,9 +496,63 @@ static void submac_rx_done(ieee802154_submac_t *submac)
     netdev_submac->ev = NETDEV_EVENT_RX_COMPLETE;
 }
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+static void tsch_rx_done(ieee802154_tsch_t *tsch)
+{
+    netdev_ieee802154_submac_t *netdev_submac = container_of(tsch,
+                                                             netdev_ieee802154_submac_t,
+                                                             tsch);
+    assert(!netdev_submac->dispatch);
+    netdev_submac->dispatch = true;
+    DEBUG("IEEE802154 submac: NETDEV_EVENT_RX_COMPLETE\n");
+    netdev_submac->ev = NETDEV_EVENT_RX_COMPLETE;
+}
+
+static void tsch_tx_done(ieee802154_tsch_t *tsch, int status,
+                         ieee802154_tx_info_t *info)
+{
+    netdev_ieee802154_submac_t *netdev_submac = container_of(tsch,
+                                                             netdev_ieee802154_submac_t,
+                                                             tsch);
+    netdev_submac->retrans = info->retrans;
+    assert(!netdev_submac->dispatch);
+    netdev_submac->dispatch = true;
+    netdev_submac->ev = NETDEV_EVENT_TX_COMPLETE;
+    if (status == TX_STATUS_NO_ACK) {
+        DEBUG("IEEE802154 submac: NETDEV_EVENT_TX_NOACK\n");
+        netdev_submac->bytes_tx = -EHOSTUNREACH;
+    }
+}
+
+static const ieee802154_tsch_cb_t _tsch_cb = {
+    .rx_done = tsch_rx_done,
+    .tx_done = tsch_tx_done,
+};
+#endif
+
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM)
+static void submac_tx_pending(ieee802154_submac_t *submac)
+{
+    netdev_ieee802154_submac_t *netdev_submac = container_of(submac,
+                                                             netdev_ieee802154_submac_t,
+                                                             submac);
+    netdev_ieee802154_t *netdev_ieee802154 = &netdev_submac->dev;
+
+    /* the radio is busy with CCA and sending, so use the time to prepare
+     * the keystream of the next secured frame */
+    if (netdev_ieee802154->flags & NETDEV_IEEE802154_SECURITY_EN) {
+        ieee802154_sec_precompute(&netdev_ieee802154->sec_ctx,
+                                  netdev_ieee802154->long_addr);
+    }
+}
+#endif
+
 static const ieee802154_submac_cb_t _cb = {
     .rx_done = submac_rx_done,
     .tx_done = submac_tx_done,
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM)
+    .tx_pending = submac_tx_pending,
+#endif
 };
 
 /* Event Notification callback */
@@ -383,6 +565,9 @@ static void _hal_radio_cb(ieee802154_dev_t *dev, ieee802154_trx_ev_t status)
     netdev_t *netdev = &netdev_submac->dev.netdev;
 
     DEBUG("IEEE802154 submac: _hal_radio_cb():\n");
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    ieee802154_tsch_radio_event(&netdev_submac->tsch, status);
+#endif
     switch (status) {
     case IEEE802154_RADIO_CONFIRM_TX_DONE:
         DEBUG("IEEE802154 submac: _hal_radio_cb(): IEEE802154_RADIO_CONFIRM_TX_DONE\n");
@@ -436,6 +621,12 @@ static int _init(netdev_t *netdev)
 
     netdev_submac->dev.txpower = tx_power;
 
+#if IS_USED(MODULE_IEEE802154_TSCH)
+    /* keep the SubMAC idle, TSCH drives the radio with its configuration */
+    ieee802154_set_idle(submac);
+    ieee802154_tsch_init(&netdev_submac->tsch, submac, &_tsch_cb);
+#endif
+
     /* signal link UP */
     netdev->event_callback(netdev, NETDEV_EVENT_LINK_UP);
 
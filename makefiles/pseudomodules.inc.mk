@@ -181,6 +181,7 @@ PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
+PSEUDOMODULES += gnrc_netif_ipv6_index
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
 
@@ -249,6 +250,7 @@ PSEUDOMODULES += gnrc_pktshark_default
 PSEUDOMODULES += gnrc_pktshark_icmpv6
 ## @}
 
+PSEUDOMODULES += gnrc_rpl_mrhof
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -292,7 +294,22 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 ## @}
 ## @}
+## @addtogroup net_gnrc_sixlowpan_frag_sfr_path
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_path
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
+## @defgroup    net_gnrc_sixlowpan_iphc_template gnrc_sixlowpan_iphc_template
+## @ingroup     net_gnrc_sixlowpan_iphc
+## @brief       Reuse the compressed headers of recurring flows
+##
+## The last @ref CONFIG_GNRC_SIXLOWPAN_IPHC_TEMPLATE_NUMOF compressed IPv6 and
+## UDP headers are kept. A packet with the same header fields, link-layer
+## addresses and compression contexts as one of them gets a copy of it with
+## the UDP checksum filled in, instead of being compressed again.
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_iphc_template
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
@@ -300,7 +317,14 @@ PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
 
 PSEUDOMODULES += ieee802154_security
+## @addtogroup net_ieee802154_security
+## @{
+## @defgroup net_ieee802154_security_keystream  ieee802154_security_keystream
+## @brief   Precompute the CCM* keystream of the next frame while the radio is busy
+PSEUDOMODULES += ieee802154_security_keystream
+## @}
 PSEUDOMODULES += ieee802154_submac
+PSEUDOMODULES += ieee802154_tsch
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 
@@ -340,6 +364,7 @@ PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += mpu_noexec_ram
 ## @}
 
+PSEUDOMODULES += mtd_kv_background_gc
 PSEUDOMODULES += mtd_write_page
 
 PSEUDOMODULES += nanocoap_%
@@ -407,6 +432,16 @@ PSEUDOMODULES += pktqueue
 PSEUDOMODULES += pmp_noexec_ram
 ## @}
 
+## @defgroup pseudomodule_pm_layered_residency pm_layered_residency
+## @{
+## @brief Only enter power modes that pay off before the next timer expires
+##
+## The idle path of @ref sys_pm_layered skips power modes whose minimum
+## residency (`PM_MODE_MIN_RESIDENCY_US`) is longer than the time until the
+## next ztimer timer expires.
+PSEUDOMODULES += pm_layered_residency
+## @}
+
 PSEUDOMODULES += posix_headers
 PSEUDOMODULES += printf_float
 PSEUDOMODULES += printf_long_long
@@ -414,6 +449,10 @@ PSEUDOMODULES += prng
 # add all pseudo random number generator variants as pseudomodules
 PSEUDOMODULES += prng_%
 
+# Sampling backends of the profiler module
+PSEUDOMODULES += profiler_cortexm
+PSEUDOMODULES += profiler_native
+
 PSEUDOMODULES += psa_riot_cipher_aes_common
 PSEUDOMODULES += psa_riot_cipher_aes_128_ecb
 PSEUDOMODULES += psa_riot_cipher_aes_128_cbc
@@ -512,6 +551,7 @@ PSEUDOMODULES += shell_cmd_lwip_netif
 PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
 PSEUDOMODULES += shell_cmd_mtd
+PSEUDOMODULES += shell_cmd_mutex_stats
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
 PSEUDOMODULES += shell_cmd_netstats_neighbor
 PSEUDOMODULES += shell_cmd_nice
@@ -521,6 +561,7 @@ PSEUDOMODULES += shell_cmd_opendsme
 PSEUDOMODULES += shell_cmd_openthread
 PSEUDOMODULES += shell_cmd_openwsn
 PSEUDOMODULES += shell_cmd_pm
+PSEUDOMODULES += shell_cmd_profiler
 PSEUDOMODULES += shell_cmd_ps
 PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
@@ -643,6 +684,14 @@ PSEUDOMODULES += vfs_auto_format
 ## some boards if the @ref pseudomodule_vfs_default module is active.
 PSEUDOMODULES += vfs_auto_mount
 
+## @defgroup pseudomodule_vfs_buffered vfs_buffered
+## @brief Optional read-ahead and write-behind buffers for VFS file descriptors
+##
+## When this module is active, buffering can be enabled per file descriptor
+## with the @ref VFS_F_SETBUF command of @ref vfs_fcntl. Many small reads or
+## writes are then passed to the file system as few larger ones.
+PSEUDOMODULES += vfs_buffered
+
 ## @defgroup pseudomodule_vfs_default vfs_default
 ## @brief Enable default assignments of a board's devices to VFS mount points
 ##
@@ -656,6 +705,15 @@ PSEUDOMODULES += vfs_auto_mount
 ## backends.
 PSEUDOMODULES += vfs_default
 
+## @defgroup pseudomodule_vfs_dentry_cache vfs_dentry_cache
+## @brief Remember the mount of recently used directories
+##
+## When this module is active, the VFS keeps a small cache of directories
+## and the mount they belong to, see @ref CONFIG_VFS_DENTRY_CACHE_NUMOF.
+## Opening or stating another file in the same directory skips searching the
+## mount table. Directories with other mount points below them are not cached.
+PSEUDOMODULES += vfs_dentry_cache
+
 PSEUDOMODULES += wakaama_objects_%
 PSEUDOMODULES += walltime_default
 PSEUDOMODULES += walltime_impl_ds1307
@@ -41,12 +41,28 @@ SUIT_MANIFEST_PAYLOADS ?= $(SLOT0_RIOT_BIN) $(SLOT1_RIOT_BIN)
 SUIT_MANIFEST_SLOTFILES ?= $(SLOT0_RIOT_BIN):$(SLOT0_OFFSET) \
                            $(SLOT1_RIOT_BIN):$(SLOT1_OFFSET)
 
+# Slot binaries of the running version (slot 0 first). If set, the manifest
+# references VCDIFF deltas against them instead of the full slot binaries,
+# which requires the suit_transport_delta module on the device and the
+# `vcdiff` tool of open-vcdiff on the host.
+SUIT_DELTA_SLOTFILES ?=
+
+# Set to 1 to compress the payloads with heatshrink, which requires the
+# suit_transport_decompress module on the device and the `heatshrink` tool
+# on the host.
+SUIT_COMPRESS ?= 0
+
+SUIT_PAYLOAD_SUFFIX = $(if $(SUIT_DELTA_SLOTFILES),.delta)$(if $(filter 1,$(SUIT_COMPRESS)),.hs)
+SUIT_GENERATED_PAYLOADS = $(if $(SUIT_PAYLOAD_SUFFIX),$(addsuffix $(SUIT_PAYLOAD_SUFFIX),$(SUIT_MANIFEST_PAYLOADS)))
+
 $(SUIT_MANIFEST): $(SUIT_MANIFEST_PAYLOADS) $(BINDIR_SUIT)
 	$(Q)$(RIOTBASE)/dist/tools/suit/gen_manifest.py \
 	  --urlroot $(SUIT_COAP_ROOT) \
 	  --seqnr $(SUIT_SEQNR) \
 	  --uuid-vendor $(SUIT_VENDOR) \
 	  --uuid-class $(SUIT_CLASS) \
+	  $(addprefix --delta ,$(SUIT_DELTA_SLOTFILES)) \
+	  $(if $(filter 1,$(SUIT_COMPRESS)),--compress) \
 	  -o $@.tmp \
 	  $(SUIT_MANIFEST_SLOTFILES)
 
@@ -54,6 +70,9 @@ $(SUIT_MANIFEST): $(SUIT_MANIFEST_PAYLOADS) $(BINDIR_SUIT)
 
 	$(Q)rm -f $@.tmp
 
+# created by gen_manifest.py together with the manifest
+$(SUIT_GENERATED_PAYLOADS): $(SUIT_MANIFEST)
+
 $(SUIT_MANIFEST_SIGNED): $(SUIT_MANIFEST) $(SUIT_SEC)
 	$(Q)(											\
 	if grep -q ENCRYPTED $(SUIT_SEC_SIGN); then						\
@@ -80,7 +99,7 @@ SUIT_MANIFESTS := $(SUIT_MANIFEST_SIGNED) \
 
 suit/manifest: $(SUIT_MANIFESTS)
 
-suit/publish: $(SUIT_MANIFESTS) $(SUIT_MANIFEST_PAYLOADS)
+suit/publish: $(SUIT_MANIFESTS) $(SUIT_MANIFEST_PAYLOADS) $(SUIT_GENERATED_PAYLOADS)
 	$(Q)mkdir -p $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	$(Q)cp $^ $(SUIT_COAP_FSROOT)/$(SUIT_COAP_BASEPATH)
 	$(Q)for file in $^; do \
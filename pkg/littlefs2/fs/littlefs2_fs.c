@@ -25,6 +25,10 @@
 #include <string.h>
 
 #include "fs/littlefs2_fs.h"
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+#include "container.h"
+#include "event/thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
@@ -83,6 +87,13 @@ static int _dev_write(const struct lfs_config *c, lfs_block_t block,
     DEBUG("lfs_write: c=%p, block=%" PRIu32 ", off=%" PRIu32 ", buf=%p, size=%" PRIu32 "\n",
           (void *)c, block, off, buffer, size);
 
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+    if (block < CONFIG_LITTLEFS2_GC_BLOCKS_MAX) {
+        bf_unset(fs->erased, block);
+    }
+    fs->used_valid = false;
+#endif
+
     uint32_t page = (fs->base_addr + block) * fs->sectors_per_block * mtd->pages_per_sector;
     return mtd_write_page_raw(mtd, buffer, page, off, size);
 }
@@ -94,16 +105,127 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
 
     DEBUG("lfs_erase: c=%p, block=%" PRIu32 "\n", (void *)c, block);
 
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+    fs->used_valid = false;
+    if ((block < CONFIG_LITTLEFS2_GC_BLOCKS_MAX) && bf_isset(fs->erased, block)) {
+        /* erased ahead of time and not written since */
+        bf_unset(fs->erased, block);
+        fs->stats.erases_saved++;
+        return 0;
+    }
+    fs->stats.inline_erases++;
+#endif
+
     uint32_t sector = (fs->base_addr + block) * fs->sectors_per_block;
-    return mtd_erase_sector(mtd, sector, fs->sectors_per_block);}
+    return mtd_erase_sector(mtd, sector, fs->sectors_per_block);
+}
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs2_desc_t *fs = c->context;
+
+    DEBUG("lfs_sync: c=%p\n", (void *)c);
+
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+    /* littlefs syncs after each commit, tidy up in the lowest priority
+     * event thread, i.e. only when all other threads are blocked */
+    if (fs->gc_enabled) {
+        event_post(EVENT_PRIO_LOWEST, &fs->gc_event);
+    }
+#endif
+
+    return mtd_flush(fs->dev);
+}
+
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+static int _used_cb(void *param, lfs_block_t block)
+{
+    uint8_t *used = param;
+
+    if (block < CONFIG_LITTLEFS2_GC_BLOCKS_MAX) {
+        bf_set(used, block);
+    }
 
     return 0;
 }
 
+/* erases up to CONFIG_LITTLEFS2_GC_ERASE_BATCH unused blocks, returns 1 if
+ * more are left */
+static int _pre_erase(littlefs2_desc_t *fs)
+{
+    unsigned budget = CONFIG_LITTLEFS2_GC_ERASE_BATCH;
+    int ret;
+
+    /* the traversal reads all metadata, only repeat it if littlefs wrote
+     * anything since the last batch */
+    if (!fs->used_valid) {
+        memset(fs->used, 0, sizeof(fs->used));
+        ret = lfs_fs_traverse(&fs->fs, _used_cb, fs->used);
+        if (ret < 0) {
+            return ret;
+        }
+        fs->used_valid = true;
+    }
+
+    lfs_block_t blocks = fs->config.block_count;
+    if (blocks > CONFIG_LITTLEFS2_GC_BLOCKS_MAX) {
+        blocks = CONFIG_LITTLEFS2_GC_BLOCKS_MAX;
+    }
+
+    for (lfs_block_t block = 0; block < blocks; block++) {
+        if (bf_isset(fs->used, block) || bf_isset(fs->erased, block)) {
+            continue;
+        }
+        if (budget == 0) {
+            return 1;
+        }
+        uint32_t sector = (fs->base_addr + block) * fs->sectors_per_block;
+        ret = mtd_erase_sector(fs->dev, sector, fs->sectors_per_block);
+        if (ret < 0) {
+            return ret;
+        }
+        DEBUG("littlefs: block %" PRIu32 " erased ahead of time\n", block);
+        bf_set(fs->erased, block);
+        fs->stats.background_erases++;
+        budget--;
+    }
+
+    return 0;
+}
+#endif
+
+static int _maintain_locked(littlefs2_desc_t *fs)
+{
+    /* compacts metadata and refills the lookahead buffer */
+    int ret = lfs_fs_gc(&fs->fs);
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+    if (ret < 0) {
+        return ret;
+    }
+
+    ret = _pre_erase(fs);
+#endif
+    return ret;
+}
+
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+static void _gc_handler(event_t *event)
+{
+    littlefs2_desc_t *fs = container_of(event, littlefs2_desc_t, gc_event);
+    int ret = 0;
+
+    mutex_lock(&fs->lock);
+    if (fs->gc_enabled) {
+        ret = _maintain_locked(fs);
+    }
+    mutex_unlock(&fs->lock);
+
+    if (ret > 0) {
+        event_post(EVENT_PRIO_LOWEST, event);
+    }
+}
+#endif
+
 static int prepare(littlefs2_desc_t *fs)
 {
     mutex_init(&fs->lock);
@@ -116,6 +238,15 @@ static int prepare(littlefs2_desc_t *fs)
     }
 
     memset(&fs->fs, 0, sizeof(fs->fs));
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+    memset(&fs->stats, 0, sizeof(fs->stats));
+    memset(fs->erased, 0, sizeof(fs->erased));
+    fs->used_valid = false;
+#endif
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+    fs->gc_event.handler = _gc_handler;
+    fs->gc_enabled = false;
+#endif
 
     static_assert(0 > CONFIG_LITTLEFS2_MIN_BLOCK_SIZE_EXP ||
                   6 < CONFIG_LITTLEFS2_MIN_BLOCK_SIZE_EXP,
@@ -202,6 +333,12 @@ static int _mount(vfs_mount_t *mountp)
     }
 
     ret = lfs_mount(&fs->fs, &fs->config);
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+    if (ret == LFS_ERR_OK) {
+        fs->gc_enabled = true;
+        event_post(EVENT_PRIO_LOWEST, &fs->gc_event);
+    }
+#endif
     mutex_unlock(&fs->lock);
 
     return littlefs_err_to_errno(ret);
@@ -215,6 +352,10 @@ static int _umount(vfs_mount_t *mountp)
 
     DEBUG("littlefs: umount: mountp=%p\n", (void *)mountp);
 
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+    fs->gc_enabled = false;
+    event_cancel(EVENT_PRIO_LOWEST, &fs->gc_event);
+#endif
     int ret = lfs_unmount(&fs->fs);
     mutex_unlock(&fs->lock);
 
@@ -472,6 +613,29 @@ static int _statvfs(vfs_mount_t *mountp, const char *restrict path, struct statv
     return littlefs_err_to_errno(ret);
 }
 
+static int _maintain(vfs_mount_t *mountp)
+{
+    littlefs2_desc_t *fs = mountp->private_data;
+
+    mutex_lock(&fs->lock);
+
+    DEBUG("littlefs: maintain: mountp=%p\n", (void *)mountp);
+
+    int ret = _maintain_locked(fs);
+    mutex_unlock(&fs->lock);
+
+    return littlefs_err_to_errno(ret);
+}
+
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE)
+void littlefs2_get_stats(littlefs2_desc_t *fs, littlefs2_stats_t *stats)
+{
+    mutex_lock(&fs->lock);
+    *stats = fs->stats;
+    mutex_unlock(&fs->lock);
+}
+#endif
+
 static inline lfs_dir_t * _get_lfs_dir(vfs_DIR *dirp)
 {
     /* The buffer in `private_data` is part of a union that also contains a
@@ -544,6 +708,7 @@ static const vfs_file_system_ops_t littlefs_fs_ops = {
     .rename = _rename,
     .stat = _stat,
     .statvfs = _statvfs,
+    .maintain = _maintain,
 };
 
 static const vfs_file_ops_t littlefs_file_ops = {
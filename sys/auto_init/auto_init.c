@@ -63,6 +63,11 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_MUTEX_STATS)
+extern void mutex_stats_init(void);
+AUTO_INIT(mutex_stats_init,
+          AUTO_INIT_PRIO_MOD_MUTEX_STATS);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
@@ -88,6 +93,11 @@ extern void mci_initialize(void);
 AUTO_INIT(mci_initialize,
           AUTO_INIT_PRIO_MOD_MCI);
 #endif
+#if IS_USED(MODULE_MTD_ASYNC)
+extern void mtd_async_init(void);
+AUTO_INIT(mtd_async_init,
+          AUTO_INIT_PRIO_MOD_MTD_ASYNC);
+#endif
 #if IS_USED(MODULE_PROFILING)
 extern void profiling_init(void);
 AUTO_INIT(profiling_init,
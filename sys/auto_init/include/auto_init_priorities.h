@@ -55,6 +55,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_MUTEX_STATS
+/**
+ * @brief   mutex contention statistics priority
+ */
+#define AUTO_INIT_PRIO_MOD_MUTEX_STATS                  1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -91,6 +97,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_MCI                          1100
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_MTD_ASYNC
+/**
+ * @brief   Asynchronous MTD worker priority
+ */
+#define AUTO_INIT_PRIO_MOD_MTD_ASYNC                    1102
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SLIPDEV
 /**
  * @brief   Slipdev/Slipmux priority
@@ -18,11 +18,20 @@
  * @}
  */
 
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+#include "clk.h"
+#include "matstat.h"
 #include "timex.h"
 
 #include "benchmark.h"
 
+XFA_INIT_CONST(benchmark_case_t, benchmark_cases_xfa);
+
+static uint32_t _samples[CONFIG_BENCHMARK_RUNS_MAX];
+
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
     uint32_t full = (time / runs);
@@ -35,3 +44,153 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+static uint64_t _sqrt64(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+
+    while (bit) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return res;
+}
+
+static int _cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+void benchmark_stats_compute(uint32_t *samples, unsigned runs,
+                             benchmark_stats_t *stats)
+{
+    matstat_state_t state = MATSTAT_STATE_INIT;
+
+    qsort(samples, runs, sizeof(samples[0]), _cmp_u32);
+
+    for (unsigned i = 0; i < runs; i++) {
+        matstat_add(&state, (samples[i] > INT32_MAX) ? INT32_MAX : samples[i]);
+    }
+
+    stats->runs = runs;
+    stats->min = samples[0];
+    stats->max = samples[runs - 1];
+    stats->median = (runs & 1) ? samples[runs / 2]
+                  : (uint32_t)(((uint64_t)samples[runs / 2 - 1] + samples[runs / 2]) / 2);
+    /* nearest rank: ceil(0.99 * runs) - 1 */
+    stats->p99 = samples[(99 * runs + 99) / 100 - 1];
+    stats->mean = matstat_mean(&state);
+    stats->stddev = _sqrt64(matstat_variance(&state));
+}
+
+int benchmark_run(const benchmark_case_t *bench, benchmark_stats_t *stats)
+{
+    unsigned long iterations = bench->iterations;
+    unsigned runs = bench->runs;
+    unsigned warmup = bench->warmup;
+
+    if (iterations == BENCHMARK_DEFAULT) {
+        iterations = CONFIG_BENCHMARK_ITERATIONS_DEFAULT;
+    }
+    if (runs == BENCHMARK_DEFAULT) {
+        runs = CONFIG_BENCHMARK_RUNS_DEFAULT;
+    }
+    if (warmup == BENCHMARK_DEFAULT) {
+        warmup = CONFIG_BENCHMARK_WARMUP_DEFAULT;
+    }
+    else if (warmup == BENCHMARK_NO_WARMUP) {
+        warmup = 0;
+    }
+
+    if ((bench->func == NULL) || (runs > CONFIG_BENCHMARK_RUNS_MAX)) {
+        return -EINVAL;
+    }
+
+    if (bench->setup) {
+        bench->setup(bench->arg);
+    }
+
+    ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC };
+    ztimer_stopwatch_start(&timer);
+
+    for (unsigned run = 0; run < warmup + runs; run++) {
+        ztimer_stopwatch_reset(&timer);
+        for (unsigned long i = 0; i < iterations; i++) {
+            bench->func(bench->arg);
+        }
+        uint32_t time = ztimer_stopwatch_measure(&timer);
+
+        if (run >= warmup) {
+            uint64_t ns = ((uint64_t)time * NS_PER_US) / iterations;
+            _samples[run - warmup] = (ns > UINT32_MAX) ? UINT32_MAX : ns;
+        }
+    }
+
+    ztimer_stopwatch_stop(&timer);
+
+    if (bench->teardown) {
+        bench->teardown(bench->arg);
+    }
+
+    stats->iterations = iterations;
+    benchmark_stats_compute(_samples, runs, stats);
+
+    return 0;
+}
+
+void benchmark_print_json(const char *name, const benchmark_stats_t *stats)
+{
+    printf("{\"bench\":\"%s\",\"iterations\":%lu,\"runs\":%u,\"unit\":\"ns\","
+           "\"min\":%" PRIu32 ",\"median\":%" PRIu32 ",\"p99\":%" PRIu32 ","
+           "\"max\":%" PRIu32 ",\"mean\":%" PRIu32 ",\"stddev\":%" PRIu32 "}\n",
+           name, stats->iterations, stats->runs,
+           stats->min, stats->median, stats->p99,
+           stats->max, stats->mean, stats->stddev);
+}
+
+void benchmark_print_rate_json(const char *name, const benchmark_stats_t *stats)
+{
+    uint32_t median = stats->median ? stats->median : 1;
+
+    printf("{\"bench\":\"%s\",\"per_sec\":%" PRIu32, name,
+           (uint32_t)(NS_PER_SEC / median));
+#ifndef CPU_NATIVE
+    printf(",\"cycles\":%" PRIu32,
+           (uint32_t)(((uint64_t)stats->median * coreclk()) / NS_PER_SEC));
+#endif
+    puts("}");
+}
+
+unsigned benchmark_run_all(void)
+{
+    unsigned failed = 0;
+
+    for (unsigned i = 0; i < XFA_LEN(benchmark_case_t, benchmark_cases_xfa); i++) {
+        const benchmark_case_t *bench = &benchmark_cases_xfa[i];
+        benchmark_stats_t stats;
+
+        if (benchmark_run(bench, &stats) != 0) {
+            printf("{\"bench\":\"%s\",\"error\":\"invalid case\"}\n", bench->name);
+            failed++;
+            continue;
+        }
+        benchmark_print_json(bench->name, &stats);
+    }
+
+    return failed;
+}
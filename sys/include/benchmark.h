@@ -9,6 +9,32 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * Besides the simple @ref BENCHMARK_FUNC, this module provides a harness for
+ * named benchmark cases. Each case is run for a number of warm-up rounds,
+ * followed by @ref benchmark_case_t::runs measured rounds of
+ * @ref benchmark_case_t::iterations calls each. The per-call times of the
+ * rounds are reduced to min/median/p99/max/mean/stddev and printed as one JSON
+ * object per line, e.g.:
+ *
+ *     {"bench":"msg_send","iterations":1000,"runs":32,"unit":"ns","min":2734,...}
+ *
+ * Cases are registered at compile time with @ref BENCHMARK_CASE and run by
+ * @ref benchmark_run_all:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _encode(void *arg) { ... }
+ *
+ * BENCHMARK_CASE(base64_encode, .func = _encode, .iterations = 100);
+ *
+ * int main(void)
+ * {
+ *     return benchmark_run_all();
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Two logs of such runs can be compared with
+ * `dist/tools/benchmark_compare/benchmark_compare.py` to spot regressions.
  * @{
  *
  * @file
@@ -20,6 +46,7 @@
 #include <stdint.h>
 
 #include "irq.h"
+#include "xfa.h"
 #include "ztimer/stopwatch.h"
 
 #ifdef __cplusplus
@@ -57,6 +84,173 @@ extern "C" {
  */
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name);
 
+/**
+ * @defgroup sys_benchmark_config  Benchmark compile time configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Maximum number of measured rounds per benchmark case
+ *
+ * Each round needs 4 bytes of RAM while a case is running.
+ */
+#ifndef CONFIG_BENCHMARK_RUNS_MAX
+#  define CONFIG_BENCHMARK_RUNS_MAX         (64U)
+#endif
+
+/**
+ * @brief   Default number of measured rounds of a case
+ */
+#ifndef CONFIG_BENCHMARK_RUNS_DEFAULT
+#  define CONFIG_BENCHMARK_RUNS_DEFAULT     (32U)
+#endif
+
+/**
+ * @brief   Default number of calls per round of a case
+ */
+#ifndef CONFIG_BENCHMARK_ITERATIONS_DEFAULT
+#  define CONFIG_BENCHMARK_ITERATIONS_DEFAULT   (1000U)
+#endif
+
+/**
+ * @brief   Default number of warm-up rounds of a case
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP_DEFAULT
+#  define CONFIG_BENCHMARK_WARMUP_DEFAULT   (1U)
+#endif
+/** @} */
+
+/**
+ * @brief   Value of @ref benchmark_case_t::iterations,
+ *          @ref benchmark_case_t::runs and @ref benchmark_case_t::warmup
+ *          that selects the default given by
+ *          @ref CONFIG_BENCHMARK_ITERATIONS_DEFAULT and friends
+ *
+ * This is also the value of fields left out in @ref BENCHMARK_CASE.
+ */
+#define BENCHMARK_DEFAULT       (0)
+
+/**
+ * @brief   Value of @ref benchmark_case_t::warmup to measure from the first
+ *          round on
+ */
+#define BENCHMARK_NO_WARMUP     (UINT16_MAX)
+
+/**
+ * @brief   A named benchmark case
+ *
+ * Fields set to @ref BENCHMARK_DEFAULT, including those left out, fall back
+ * to the defaults given by @ref CONFIG_BENCHMARK_RUNS_DEFAULT and friends. As
+ * this is 0, a case without warm-up rounds sets @ref benchmark_case_t::warmup
+ * to @ref BENCHMARK_NO_WARMUP.
+ *
+ * @note    @ref benchmark_case_t::func is called through a function pointer,
+ *          which adds a few cycles to each call compared to
+ *          @ref BENCHMARK_FUNC.
+ */
+typedef struct {
+    const char *name;                   /**< name used in the output */
+    void (*setup)(void *arg);           /**< called before the first round,
+                                             may be NULL */
+    void (*func)(void *arg);            /**< code to benchmark */
+    void (*teardown)(void *arg);        /**< called after the last round,
+                                             may be NULL */
+    void *arg;                          /**< argument passed to the callbacks */
+    unsigned long iterations;           /**< calls of @ref benchmark_case_t::func
+                                             per round */
+    uint16_t runs;                      /**< number of measured rounds */
+    uint16_t warmup;                    /**< number of rounds run before
+                                             measuring, or
+                                             @ref BENCHMARK_NO_WARMUP */
+} benchmark_case_t;
+
+/**
+ * @brief   Results of a benchmark case
+ *
+ * All times are in nanoseconds per call of the benchmarked function.
+ */
+typedef struct {
+    unsigned long iterations;   /**< calls per round */
+    unsigned runs;              /**< number of measured rounds */
+    uint32_t min;               /**< fastest round */
+    uint32_t median;            /**< median of all rounds */
+    uint32_t p99;               /**< 99th percentile (nearest rank) */
+    uint32_t max;               /**< slowest round */
+    uint32_t mean;              /**< arithmetic mean of all rounds */
+    uint32_t stddev;            /**< sample standard deviation */
+} benchmark_stats_t;
+
+#if !defined(__cplusplus) || defined(DOXYGEN)
+/**
+ * @brief   Register a benchmark case to be run by @ref benchmark_run_all
+ *
+ * @param[in]   case_name   name of the case, must be a valid C identifier
+ * @param[in]   ...         further designated initializers of
+ *                          @ref benchmark_case_t, e.g. `.func = _my_func`
+ */
+#define BENCHMARK_CASE(case_name, ...) \
+    XFA_USE_CONST(benchmark_case_t, benchmark_cases_xfa); \
+    XFA_CONST(benchmark_case_t, benchmark_cases_xfa, 0) \
+    _benchmark_case_ ## case_name = { \
+        .name = #case_name, \
+        __VA_ARGS__ \
+    }
+#endif /* __cplusplus */
+
+/**
+ * @brief   Run a single benchmark case
+ *
+ * @param[in]   bench   case to run
+ * @param[out]  stats   results of the case
+ *
+ * @retval  0           Success
+ * @retval  -EINVAL     @p bench has no function or too many runs
+ */
+int benchmark_run(const benchmark_case_t *bench, benchmark_stats_t *stats);
+
+/**
+ * @brief   Reduce the per-call times of a number of rounds to statistics
+ *
+ * @param[in,out]   samples     per-call times of the rounds in ns, will be
+ *                              sorted in place
+ * @param[in]       runs        number of entries in @p samples, must not be 0
+ * @param[out]      stats       statistics of @p samples
+ */
+void benchmark_stats_compute(uint32_t *samples, unsigned runs,
+                             benchmark_stats_t *stats);
+
+/**
+ * @brief   Print the results of a case as single line JSON object on STDIO
+ *
+ * @param[in]   name    name of the case
+ * @param[in]   stats   results to print
+ */
+void benchmark_print_json(const char *name, const benchmark_stats_t *stats);
+
+/**
+ * @brief   Print the rate derived from the median of a case as single line
+ *          JSON object on STDIO
+ *
+ * The object holds the calls per second and the CPU cycles per call, e.g.:
+ *
+ *     {"bench":"gnrc_ipv6_fwd","per_sec":52631,"cycles":1216}
+ *
+ * The cycles are left out on `native`, where the core clock is a nominal
+ * value and not the clock of the CPU.
+ *
+ * @param[in]   name    name of the case
+ * @param[in]   stats   results of the case
+ */
+void benchmark_print_rate_json(const char *name, const benchmark_stats_t *stats);
+
+/**
+ * @brief   Run all cases registered with @ref BENCHMARK_CASE and print their
+ *          results with @ref benchmark_print_json
+ *
+ * @return  number of cases that failed to run
+ */
+unsigned benchmark_run_all(void);
+
 #ifdef __cplusplus
 }
 #endif
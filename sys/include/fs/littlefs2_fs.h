@@ -11,6 +11,27 @@
  * @ingroup     pkg_littlefs2
  * @brief       RIOT integration of littlefs version 2.x.y
  *
+ * Erasing a block can take a long time on flash memory. littlefs erases
+ * blocks right before it writes them, so a @ref vfs_write can stall for the
+ * duration of several erases, and metadata compaction adds to that.
+ *
+ * @ref vfs_maintain moves this work out of the write path. It runs the
+ * littlefs garbage collection, which compacts metadata and scans for free
+ * blocks. With the `littlefs2_pre_erase` module, it also erases a few unused
+ * blocks ahead of time. The integration then remembers which blocks are
+ * erased and skips erasing them again when littlefs allocates them. This
+ * state is kept in RAM only, so it is lost on unmount.
+ *
+ * With the `littlefs2_background_gc` module, which pulls in
+ * `littlefs2_pre_erase`, the maintenance is posted to
+ * @ref EVENT_PRIO_LOWEST whenever the file system was modified. The module
+ * pulls in `event_thread_medium`, so that queue is served by its own thread
+ * at `THREAD_PRIORITY_IDLE - 1` and every other thread preempts the
+ * maintenance. The file system stays locked while a batch of
+ * @ref CONFIG_LITTLEFS2_GC_ERASE_BATCH blocks is erased, so a writer may
+ * still wait for that long. Other users of @ref EVENT_PRIO_LOWEST share the
+ * thread and have to tolerate the delay.
+ *
  * @{
  *
  * @file
@@ -22,10 +43,15 @@
 
 #include <stdalign.h>
 
+#include "bitfield.h"
 #include "vfs.h"
 #include "lfs.h"
+#include "modules.h"
 #include "mtd.h"
 #include "mutex.h"
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC)
+#include "event.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,8 +105,34 @@ extern "C" {
  * The desired block size is not guaranteed to be applicable but will be respected. */
 #define CONFIG_LITTLEFS2_MIN_BLOCK_SIZE_EXP (-1)
 #endif
+
+#ifndef CONFIG_LITTLEFS2_GC_BLOCKS_MAX
+/** Number of blocks that can be erased ahead of time by @ref vfs_maintain
+ * with module `littlefs2_pre_erase`.
+ * Blocks beyond this number are only erased when littlefs writes them. */
+#define CONFIG_LITTLEFS2_GC_BLOCKS_MAX      (256)
+#endif
+
+#ifndef CONFIG_LITTLEFS2_GC_ERASE_BATCH
+/** Maximum number of blocks erased by one call of @ref vfs_maintain */
+#define CONFIG_LITTLEFS2_GC_ERASE_BATCH     (1)
+#endif
 /** @} */
 
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE) || DOXYGEN
+/**
+ * @brief   littlefs erase statistics
+ *
+ * @note    Only available with module `littlefs2_pre_erase`
+ */
+typedef struct {
+    uint32_t inline_erases;     /**< blocks erased while littlefs waited */
+    uint32_t background_erases; /**< blocks erased ahead of time */
+    uint32_t erases_saved;      /**< erases skipped, the block was erased
+                                     ahead of time */
+} littlefs2_stats_t;
+#endif
+
 /**
  * @brief   littlefs descriptor for vfs integration
  */
@@ -111,11 +163,36 @@ typedef struct {
     /** lookahead buffer to use internally */
     alignas(uint32_t) uint8_t lookahead_buf[CONFIG_LITTLEFS2_LOOKAHEAD_SIZE];
     uint16_t sectors_per_block; /**< number of sectors per block */
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE) || DOXYGEN
+    littlefs2_stats_t stats;    /**< erase statistics */
+    /** blocks erased ahead of time and not written since */
+    BITFIELD(erased, CONFIG_LITTLEFS2_GC_BLOCKS_MAX);
+    /** blocks in use by littlefs, as of the last maintenance run */
+    BITFIELD(used, CONFIG_LITTLEFS2_GC_BLOCKS_MAX);
+    bool used_valid;            /**< littlefs wrote nothing since @p used
+                                     was filled */
+#endif
+#if IS_USED(MODULE_LITTLEFS2_BACKGROUND_GC) || DOXYGEN
+    event_t gc_event;           /**< background maintenance */
+    bool gc_enabled;            /**< file system is mounted */
+#endif
 } littlefs2_desc_t;
 
 /** The littlefs vfs driver */
 extern const vfs_file_system_t littlefs2_file_system;
 
+#if IS_USED(MODULE_LITTLEFS2_PRE_ERASE) || DOXYGEN
+/**
+ * @brief   Get the erase statistics of a file system
+ *
+ * @note    Only available with module `littlefs2_pre_erase`
+ *
+ * @param[in]   fs      littlefs descriptor
+ * @param[out]  stats   statistics since the file system was mounted
+ */
+void littlefs2_get_stats(littlefs2_desc_t *fs, littlefs2_stats_t *stats);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_mtd_kv Log-structured key/value store on MTD
+ * @ingroup     sys
+ * @brief       Small key/value store that appends to an MTD device and
+ *              keeps an index of all keys in RAM
+ *
+ * The store uses the erase sectors of an @ref drivers_mtd device as a log.
+ * Every update appends a record with the key and the new value to the active
+ * sector, deleting a key appends a record without value. Nothing is ever
+ * overwritten, so each sector is erased only when it is compacted.
+ *
+ * When the store is initialized, all sectors are scanned once and a hash
+ * index in RAM is filled with the location of the newest record of each key.
+ * Reading a key afterwards costs a hash lookup and a single read of the
+ * record, independent of the number of keys and updates.
+ *
+ * Each record carries a CRC over its header, key and value. A record torn by
+ * a power failure fails the check and is ignored when the store is
+ * initialized the next time, so the previous value of the key stays valid.
+ *
+ * Compaction copies the still valid records of the sector with the least
+ * valid data to the active sector and erases it. It runs when a write needs a
+ * new sector and only the reserved sector is left. With the
+ * `mtd_kv_background_gc` module, it is also posted to @ref EVENT_PRIO_LOWEST
+ * as soon as the store runs low on free sectors, so writes rarely have to
+ * wait for it. The module pulls in `event_thread_medium`, so that queue is
+ * served by its own thread at `THREAD_PRIORITY_IDLE - 1` and every other
+ * thread preempts the compaction. Each run compacts a single sector while
+ * holding the store lock, so an access may still wait for that long.
+ *
+ * @code {unparsed}
+ * Sector:  | "MKV1" | sequence number | record | record | ... | erased |
+ * Record:  | key len | flags | value len | CRC-16 | key | value | padding |
+ * @endcode
+ *
+ * @{
+ *
+ * @file
+ * @brief       Log-structured key/value store on MTD
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "modules.h"
+#include "mtd.h"
+#include "mutex.h"
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+#include "event.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_mtd_kv_conf Log-structured key/value store configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of entries of the RAM index, has to be a power of two
+ *
+ * One entry is kept free, deleted keys occupy an entry until their sector is
+ * compacted.
+ */
+#ifndef CONFIG_MTD_KV_INDEX_SIZE
+#  define CONFIG_MTD_KV_INDEX_SIZE      (32U)
+#endif
+
+/**
+ * @brief   Maximum number of MTD sectors used by the store
+ *
+ * Further sectors of the device are left alone.
+ */
+#ifndef CONFIG_MTD_KV_SECTORS_MAX
+#  define CONFIG_MTD_KV_SECTORS_MAX     (8U)
+#endif
+
+/**
+ * @brief   Maximum length of a key
+ */
+#ifndef CONFIG_MTD_KV_KEY_LEN_MAX
+#  define CONFIG_MTD_KV_KEY_LEN_MAX     (32U)
+#endif
+
+/**
+ * @brief   Size of the write buffer in bytes
+ *
+ * Has to be a multiple of the write size of the MTD device.
+ */
+#ifndef CONFIG_MTD_KV_BUF_SIZE
+#  define CONFIG_MTD_KV_BUF_SIZE        (32U)
+#endif
+
+/**
+ * @brief   Start background compaction at this number of free sectors
+ */
+#ifndef CONFIG_MTD_KV_GC_FREE_SECTORS
+#  define CONFIG_MTD_KV_GC_FREE_SECTORS (2U)
+#endif
+/** @} */
+
+/**
+ * @brief   Entry of the RAM index
+ */
+typedef struct {
+    uint32_t addr;      /**< address of the newest record of the key */
+    uint16_t tag;       /**< bits of the key hash, deleted flag */
+} mtd_kv_index_t;
+
+/**
+ * @brief   State of a sector
+ */
+typedef struct {
+    uint32_t seq;       /**< sequence number, orders the sectors */
+    uint32_t live;      /**< bytes of records that are still valid */
+    uint8_t state;      /**< free, closed or active */
+} mtd_kv_sector_t;
+
+/**
+ * @brief   Key/value store descriptor
+ */
+typedef struct {
+    mtd_dev_t *mtd;                 /**< underlying MTD device */
+    mutex_t lock;                   /**< serializes access */
+    uint32_t sector_size;           /**< size of an MTD sector in bytes */
+    uint32_t seq;                   /**< sequence number of the newest sector */
+    uint32_t pos;                   /**< write position in the active sector */
+    uint8_t sectors;                /**< number of sectors used */
+    uint8_t active;                 /**< active sector */
+    uint16_t keys;                  /**< used entries of @ref index */
+    mtd_kv_sector_t sector[CONFIG_MTD_KV_SECTORS_MAX];  /**< sector states */
+    mtd_kv_index_t index[CONFIG_MTD_KV_INDEX_SIZE];     /**< RAM index */
+    uint8_t buf[CONFIG_MTD_KV_BUF_SIZE];                /**< write buffer */
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC) || DOXYGEN
+    event_t gc_event;               /**< background compaction */
+#endif
+} mtd_kv_t;
+
+/**
+ * @brief   Initialize a store and build its index
+ *
+ * Sectors that do not belong to the store are treated as free and will be
+ * erased when they are used.
+ *
+ * @p kv must not be in use, with `mtd_kv_background_gc` this includes a
+ * pending background compaction.
+ *
+ * @param[out]  kv      store descriptor
+ * @param[in]   mtd     initialized MTD device with at least two sectors
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     the device is too small or its write size does not
+ *                      fit @ref CONFIG_MTD_KV_BUF_SIZE
+ * @retval  -ENOMEM     the device holds more keys than the index
+ * @retval  <0          error of the MTD device
+ */
+int mtd_kv_init(mtd_kv_t *kv, mtd_dev_t *mtd);
+
+/**
+ * @brief   Erase all sectors of a store
+ *
+ * @param[in]   kv      store descriptor
+ *
+ * @retval  0           on success
+ * @retval  <0          error of the MTD device
+ */
+int mtd_kv_format(mtd_kv_t *kv);
+
+/**
+ * @brief   Read the value of a key
+ *
+ * @param[in]   kv      store descriptor
+ * @param[in]   key     key to read
+ * @param[out]  value   buffer for the value, may be NULL to query the length
+ * @param[in]   len     size of @p value
+ *
+ * @return  length of the value
+ * @retval  -ENOENT     the key does not exist
+ * @retval  -ENOBUFS    @p value is too small
+ * @retval  <0          error of the MTD device
+ */
+ssize_t mtd_kv_get(mtd_kv_t *kv, const char *key, void *value, size_t len);
+
+/**
+ * @brief   Write the value of a key
+ *
+ * The previous value stays valid until the new one is completely written.
+ *
+ * @param[in]   kv      store descriptor
+ * @param[in]   key     key to write
+ * @param[in]   value   new value
+ * @param[in]   len     length of @p value
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     the key is empty or too long
+ * @retval  -EFBIG      the record does not fit into a sector
+ * @retval  -ENOMEM     the index is full
+ * @retval  -ENOSPC     the store is full
+ * @retval  <0          error of the MTD device
+ */
+int mtd_kv_set(mtd_kv_t *kv, const char *key, const void *value, size_t len);
+
+/**
+ * @brief   Delete a key
+ *
+ * @param[in]   kv      store descriptor
+ * @param[in]   key     key to delete
+ *
+ * @retval  0           on success
+ * @retval  -ENOENT     the key does not exist
+ * @retval  -ENOSPC     the store is full
+ * @retval  <0          error of the MTD device
+ */
+int mtd_kv_delete(mtd_kv_t *kv, const char *key);
+
+/**
+ * @brief   Compact one sector
+ *
+ * Compacts the sector with the least valid data, if any sector contains
+ * stale records and a free sector is available to copy the valid ones to.
+ *
+ * @param[in]   kv      store descriptor
+ *
+ * @retval  1           a sector was compacted
+ * @retval  0           nothing to compact
+ * @retval  <0          error of the MTD device
+ */
+int mtd_kv_compact(mtd_kv_t *kv);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_mutex_stats Mutex contention statistics
+ * @ingroup     sys
+ * @brief       Per-mutex statistics on acquisitions, contention, wait time
+ *              and hold time
+ *
+ * When this module is used, @ref core_sync_mutex reports every acquisition
+ * and release of a mutex to this module. The statistics are kept in a fixed
+ * size table, indexed by the address of the mutex. Mutexes are added on their
+ * first acquisition; once the table is full, further mutexes are counted in
+ * @ref mutex_stats_untracked only.
+ *
+ * Mutexes are identified by their address only. Use `nm` on the ELF file to
+ * map the address of a statically allocated mutex to its name. Mutexes on
+ * the stack (e.g. the one used by `ztimer_sleep()`) show up with whatever
+ * address they happened to have.
+ *
+ * @note    The hold time is the time from acquisition to release, regardless
+ *          of which thread or ISR released the mutex. For mutexes used to
+ *          signal events rather than to protect data this is the time until
+ *          the event.
+ *
+ * The shell command `mutex_stats` (module `shell_cmd_mutex_stats`) lists the
+ * statistics.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Mutex contention statistics
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_mutex_stats_conf Mutex statistics configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Maximum number of mutexes to keep statistics for
+ */
+#ifndef CONFIG_MUTEX_STATS_NUMOF
+#  define CONFIG_MUTEX_STATS_NUMOF      (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Statistics of a single mutex
+ *
+ * All times are in microseconds.
+ */
+typedef struct {
+    const mutex_t *mutex;       /**< the mutex, `NULL` if entry is unused */
+    uint32_t acquisitions;      /**< number of times the mutex was obtained */
+    uint32_t contended;         /**< acquisitions that had to block */
+    uint64_t wait_total;        /**< total time spent blocking on the mutex */
+    uint32_t wait_max;          /**< longest time spent blocking */
+    uint64_t hold_total;        /**< total time the mutex was held */
+    uint32_t hold_max;          /**< longest time the mutex was held */
+    uint32_t locked_since;      /**< time stamp of the last acquisition */
+    bool locked;                /**< whether @ref mutex_stats_t::locked_since
+                                     is valid */
+} mutex_stats_t;
+
+#if IS_USED(MODULE_MUTEX_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Start collecting statistics
+ *
+ * Called by auto_init after the timers are initialized. Until then, all
+ * reports are ignored.
+ */
+void mutex_stats_init(void);
+
+/**
+ * @brief   Get a time stamp to pass to @ref mutex_stats_acquired_contended
+ */
+uint32_t mutex_stats_now(void);
+
+/**
+ * @brief   Report that @p mutex was obtained without blocking
+ */
+void mutex_stats_acquired(const mutex_t *mutex);
+
+/**
+ * @brief   Report that @p mutex was obtained after blocking
+ *
+ * @param[in]   mutex       the mutex obtained
+ * @param[in]   wait_start  time stamp from @ref mutex_stats_now taken right
+ *                          before blocking
+ */
+void mutex_stats_acquired_contended(const mutex_t *mutex, uint32_t wait_start);
+
+/**
+ * @brief   Report that @p mutex was released
+ */
+void mutex_stats_released(const mutex_t *mutex);
+
+/**
+ * @brief   Copy the statistics of the tracked mutexes
+ *
+ * @param[out]  dest    buffer to copy the statistics to
+ * @param[in]   max     number of entries fitting in @p dest
+ *
+ * @return  number of entries copied
+ */
+size_t mutex_stats_get(mutex_stats_t *dest, size_t max);
+
+/**
+ * @brief   Get the number of acquisitions of mutexes that did not fit in the
+ *          table
+ */
+uint32_t mutex_stats_untracked(void);
+
+/**
+ * @brief   Clear all statistics
+ */
+void mutex_stats_reset(void);
+
+/**
+ * @brief   Print the statistics of all tracked mutexes
+ */
+void mutex_stats_print(void);
+#else
+static inline uint32_t mutex_stats_now(void)
+{
+    return 0;
+}
+
+static inline void mutex_stats_acquired(const mutex_t *mutex)
+{
+    (void)mutex;
+}
+
+static inline void mutex_stats_acquired_contended(const mutex_t *mutex,
+                                                  uint32_t wait_start)
+{
+    (void)mutex;
+    (void)wait_start;
+}
+
+static inline void mutex_stats_released(const mutex_t *mutex)
+{
+    (void)mutex;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_ipv6_flow_cache IPv6 next-hop flow cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Caches the resolved next hop of recent destinations
+ *
+ * Without this module, every unicast packet sent or forwarded by
+ * @ref net_gnrc_ipv6 is passed to @ref gnrc_ipv6_nib_get_next_hop_l2addr(),
+ * which searches the neighbor cache, the prefix list, and the forwarding
+ * table for the destination. With this module, the neighbor cache entry
+ * resolved for a destination and the interface the packet was sent to is kept
+ * in a small direct-mapped cache, so later packets of the same flow skip that
+ * search.
+ *
+ * An entry is valid for as long as the [generation of the
+ * NIB](@ref gnrc_ipv6_nib_generation) stays the same, so any change of a
+ * neighbor, a route, or a prefix invalidates all entries at once. Other
+ * threads therefore never touch the cache itself but call
+ * @ref gnrc_ipv6_nib_changed() to invalidate it. Only
+ * neighbors that need no neighbor unreachability detection on use, i.e. are
+ * REACHABLE or unmanaged, are cached, so the NIB still sees every packet to a
+ * STALE neighbor. Interfaces with a
+ * [route info callback](@ref gnrc_netif_ipv6_t::route_info_cb) are not cached,
+ * as the callback is called for every route used.
+ *
+ * The cache is only used by the @ref net_gnrc_ipv6 thread and does not lock.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 next-hop flow cache definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_ipv6_flow_cache_conf GNRC IPv6 flow cache compile configurations
+ * @ingroup     net_gnrc_ipv6_flow_cache
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of entries of the flow cache, has to be a power of two
+ */
+#ifndef CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE
+#  define CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE  (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Gets the cached next hop of a destination
+ *
+ * @param[in] dst       Destination address of a packet.
+ * @param[in] netif     Interface the packet is sent to, NULL if not given.
+ * @param[out] nce      Neighbor cache entry of the next hop.
+ *
+ * @return  true, if a valid entry was found and copied to @p nce.
+ * @return  false, if the next hop has to be resolved by the NIB.
+ */
+bool gnrc_ipv6_flow_cache_get(const ipv6_addr_t *dst,
+                              const gnrc_netif_t *netif,
+                              gnrc_ipv6_nib_nc_t *nce);
+
+/**
+ * @brief   Caches the next hop of a destination
+ *
+ * Nothing is cached if the NUD state of @p nce requires the NIB to see the
+ * next packets.
+ *
+ * @param[in] dst       Destination address of a packet.
+ * @param[in] netif     Interface the packet is sent to, NULL if not given.
+ * @param[in] gen       [Generation of the NIB](@ref gnrc_ipv6_nib_generation)
+ *                      read before @p nce was resolved.
+ * @param[in] nce       Result of @ref gnrc_ipv6_nib_get_next_hop_l2addr().
+ */
+void gnrc_ipv6_flow_cache_add(const ipv6_addr_t *dst,
+                              const gnrc_netif_t *netif, uint32_t gen,
+                              const gnrc_ipv6_nib_nc_t *nce);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
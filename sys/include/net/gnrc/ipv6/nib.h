@@ -368,6 +368,28 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the generation of the NIB
+ *
+ * The generation changes whenever a change of the NIB may change the result
+ * of @ref gnrc_ipv6_nib_get_next_hop_l2addr(), e.g. when a neighbor cache
+ * entry changes its link-layer address or NUD state, or a route is added or
+ * removed. A result of that function may be reused for as long as the
+ * generation read before calling it stays the same.
+ *
+ * @return  The current generation.
+ */
+uint32_t gnrc_ipv6_nib_generation(void);
+
+/**
+ * @brief   Changes the generation of the NIB
+ *
+ * To be called by routing protocols that keep routes outside the NIB, e.g.
+ * @ref net_gnrc_rpl_dao_table, whenever such a route is added, changed, or
+ * removed.
+ */
+void gnrc_ipv6_nib_changed(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
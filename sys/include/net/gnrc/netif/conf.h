@@ -126,6 +126,18 @@ extern "C" {
                                         GNRC_NETIF_IPV6_RTR_ADDR + 1)
 #endif
 
+/**
+ * @brief   Number of entries of the IPv6 address index
+ *
+ * Used with the `gnrc_netif_ipv6_index` module. Has to be a power of two
+ * and should be at least twice the number of addresses and groups of all
+ * interfaces. If the index runs full, the lookups search the interfaces
+ * again.
+ */
+#ifndef CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE
+#define CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE   (32U)
+#endif
+
 /**
  * @brief   Maximum length of the link-layer address.
  *
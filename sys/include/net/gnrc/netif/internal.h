@@ -281,6 +281,49 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
 int gnrc_netif_ipv6_group_idx(gnrc_netif_t *netif,
                               const ipv6_addr_t *addr);
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX) || DOXYGEN
+/**
+ * @brief   Adds an address or group of an interface to the address index
+ *
+ * @param[in] netif the network interface
+ * @param[in] addr  the address in gnrc_netif_ipv6_t::addrs or
+ *                  gnrc_netif_ipv6_t::groups of @p netif
+ *
+ * @note    Only available with the `gnrc_netif_ipv6_index` module.
+ */
+void gnrc_netif_ipv6_index_add(gnrc_netif_t *netif, const ipv6_addr_t *addr);
+
+/**
+ * @brief   Removes an address or group of an interface from the address index
+ *
+ * Has to be called before the address is changed in @p netif, also for
+ * addresses that did not fit into the index.
+ *
+ * @param[in] netif the network interface
+ * @param[in] addr  the address as passed to gnrc_netif_ipv6_index_add()
+ *
+ * @note    Only available with the `gnrc_netif_ipv6_index` module.
+ */
+void gnrc_netif_ipv6_index_remove(gnrc_netif_t *netif, const ipv6_addr_t *addr);
+
+/**
+ * @brief   Looks up the interface an address or group is assigned to
+ *
+ * Does not lock any interface.
+ *
+ * @param[in] addr      the address to look up
+ * @param[out] netif    the interface @p addr is assigned to, NULL if none
+ *
+ * @return  true, if @p netif was set
+ * @return  false, if addresses did not fit into the index and the interfaces
+ *          have to be searched, until these addresses are removed again
+ *
+ * @note    Only available with the `gnrc_netif_ipv6_index` module.
+ */
+bool gnrc_netif_ipv6_index_lookup(const ipv6_addr_t *addr,
+                                  gnrc_netif_t **netif);
+#endif
+
 /**
  * @brief   Posts a message to the IPv6 event bus of the interface
  *
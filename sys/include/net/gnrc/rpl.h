@@ -103,11 +103,22 @@
  *   CFLAGS += -DCONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF=2
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * - If parents should be chosen by link quality instead of hop count, use
+ *   MRHOF ([RFC6719](https://tools.ietf.org/html/rfc6719)) as objective
+ *   function of the DODAGs created by the root:
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ *   USEMODULE += gnrc_rpl_mrhof
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *   The ETX of the link to a parent is taken from the
+ *   neighbor statistics (`netstats_neighbor_etx`) of the interface, so
+ *   the network device has to report the number of retransmissions.
+ *
  * TODO
  * ------
  *
  * The GNRC RPL implementation only implements storing mode
- * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)).
+ * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)) and MRHOF
+ * ([RFC6719](https://tools.ietf.org/html/rfc6719)) without metric container.
  * The RPL routing header is parsed by the nodes when the [@c gnrc_rpl_srh](@ref net_gnrc_rpl_srh)
  * module is used, but anything else
  * for non-storing mode is missing.
@@ -115,10 +126,8 @@
  *
  * - IPv6 Hop-by-hop RPL option
  *   (see [#7231](https://github.com/RIOT-OS/RIOT/pull/7231#issuecomment-651237343))
- * - Metric based routing ([RFC6551](https://tools.ietf.org/html/rfc6551)
- *   and [RFC6719](https://tools.ietf.org/html/rfc6719))
- *   (see [14448](https://github.com/RIOT-OS/RIOT/pull/14448) and
- *   [#14623](https://github.com/RIOT-OS/RIOT/pull/14623))
+ * - Metric based routing with metrics other than ETX
+ *   ([RFC6551](https://tools.ietf.org/html/rfc6551))
  * - Non-Storing mode
  * - DAG-Metric Container ([RFC6550#6.7.4](https://tools.ietf.org/html/rfc6550#section-6.7.4)
  *   and [RFC6551](https://tools.ietf.org/html/rfc6551))
@@ -245,12 +254,58 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
+#if IS_USED(MODULE_GNRC_RPL_MRHOF) || defined(DOXYGEN)
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (2)
+#else
 #define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Default Objective Code Point
+ *
+ * MRHOF (1) with the `gnrc_rpl_mrhof` module, OF0 (0) otherwise.
  */
+#if IS_USED(MODULE_GNRC_RPL_MRHOF) || defined(DOXYGEN)
+#define GNRC_RPL_DEFAULT_OCP (1)
+#else
 #define GNRC_RPL_DEFAULT_OCP (0)
+#endif
+
+/**
+ * @brief   Maximum link metric of a parent selected by MRHOF
+ *
+ * In units of ETX * 128, parents with a worse link are not selected.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC (512)
+#endif
+
+/**
+ * @brief   Maximum path cost of a parent selected by MRHOF
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST
+#define CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST (32768)
+#endif
+
+/**
+ * @brief   Path cost a parent has to be better than the preferred parent by
+ *          for MRHOF to switch to it
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD (192)
+#endif
 
 /**
  * @brief   Default Instance ID
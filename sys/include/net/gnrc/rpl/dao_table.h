@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_rpl_dao_table RPL downward route table
+ * @ingroup     net_gnrc_rpl
+ * @brief       Scalable table of the downward routes learned from DAOs
+ *
+ * Without this module, every target of a DAO received in storing mode
+ * becomes an off-link entry of the @ref net_gnrc_ipv6_nib, so the number of
+ * nodes below a router (and the DODAG root in particular) is bounded by
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, and every lookup and lifetime update
+ * searches all of these entries.
+ *
+ * With this module, the targets are kept in a table of their own, which the
+ * NIB consults for every off-link destination:
+ *
+ * - Targets are found by a hash of their prefix and prefix length, so a
+ *   lookup probes one bucket per prefix length in use instead of scanning all
+ *   routes.
+ * - Lifetimes are kept in a timer wheel that advances every
+ *   @ref CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC seconds and only visits the
+ *   routes due in the current slot. Refreshing a route moves it to another
+ *   slot in constant time.
+ * - Two routes for the halves of a prefix (down to
+ *   @ref CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN bits) over the same next hop
+ *   that expire in the same tick are merged into one route for the whole
+ *   prefix. The merged route is split again when one of its targets is
+ *   removed, moves to another next hop or is refreshed to another expiry, so
+ *   every target expires on its own. If the table has no space to split a
+ *   merged route, the routes that expire first are evicted, which is counted
+ *   in @ref gnrc_rpl_dao_table_stats_t::dropped.
+ * - Next hops are stored once and referenced by index, an entry takes
+ *   32 bytes.
+ *
+ * The routes over an interface are removed with the last RPL DODAG on that
+ * interface. The table is changed by the RPL thread only, lookups may come
+ * from any thread.
+ *
+ * @{
+ *
+ * @file
+ * @brief   RPL downward route table definitions
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_rpl_dao_table_conf RPL downward route table compile configurations
+ * @ingroup     net_gnrc_rpl_dao_table
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of routes of the table
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_NUMOF
+#  define CONFIG_GNRC_RPL_DAO_TABLE_NUMOF           (64U)
+#endif
+
+/**
+ * @brief   Number of hash buckets, has to be a power of two
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS
+#  define CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS         (32U)
+#endif
+
+/**
+ * @brief   Number of distinct next hops, i.e. children, of the table
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF
+#  define CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF (8U)
+#endif
+
+/**
+ * @brief   Number of slots of the timer wheel
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE
+#  define CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE      (64U)
+#endif
+
+/**
+ * @brief   Duration of a slot of the timer wheel in seconds
+ *
+ * Lifetimes are rounded up to a multiple of it.
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC
+#  define CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC        (8U)
+#endif
+
+/**
+ * @brief   Shortest prefix length routes are merged to
+ *
+ * Set to 128 to disable merging.
+ */
+#ifndef CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN
+#  define CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN    (120U)
+#endif
+/** @} */
+
+/**
+ * @brief   Memory usage and fill level of the table
+ */
+typedef struct {
+    size_t size;            /**< bytes of RAM used by the table */
+    uint16_t numof;         /**< number of routes the table can hold */
+    uint16_t used;          /**< routes in use */
+    uint16_t aggregated;    /**< routes in use that were merged */
+    uint16_t dropped;       /**< routes or refreshes not stored and routes
+                                 evicted for lack of space since boot */
+    uint8_t next_hops;      /**< next hops in use */
+} gnrc_rpl_dao_table_stats_t;
+
+/**
+ * @brief   Adds or refreshes a downward route
+ *
+ * @param[in] target    Target of a DAO.
+ * @param[in] len       Prefix length of @p target.
+ * @param[in] next_hop  Node the DAO was received from.
+ * @param[in] iface     Interface the DAO was received on.
+ * @param[in] ltime     Lifetime of the route in seconds, 0 removes it.
+ *
+ * @return  0, on success.
+ * @return  -ENOMEM, if the table or the next hops are exhausted. If
+ *          @p target is part of a merged route, that route is kept, but
+ *          expires with the merged route.
+ */
+int gnrc_rpl_dao_table_add(const ipv6_addr_t *target, uint8_t len,
+                           const ipv6_addr_t *next_hop, kernel_pid_t iface,
+                           uint32_t ltime);
+
+/**
+ * @brief   Removes a downward route
+ *
+ * Removing a single target of a merged route keeps the other targets.
+ *
+ * @param[in] target    Target of a DAO.
+ * @param[in] len       Prefix length of @p target.
+ */
+void gnrc_rpl_dao_table_del(const ipv6_addr_t *target, uint8_t len);
+
+/**
+ * @brief   Removes all routes over an interface
+ *
+ * @param[in] iface     Interface, 0 for all routes.
+ */
+void gnrc_rpl_dao_table_flush(kernel_pid_t iface);
+
+/**
+ * @brief   Gets the route with the longest match for a destination
+ *
+ * @param[in] dst       Destination address.
+ * @param[in] min_len   Only routes with a prefix length of at least
+ *                      @p min_len are considered.
+ * @param[out] fte      The route.
+ *
+ * @return  true, if a route was found.
+ * @return  false, otherwise.
+ */
+bool gnrc_rpl_dao_table_get_route(const ipv6_addr_t *dst, unsigned min_len,
+                                  gnrc_ipv6_nib_ft_t *fte);
+
+/**
+ * @brief   Iterates over all routes of the table
+ *
+ * @param[in,out] state Iteration state, must point to a NULL pointer before
+ *                      the first call.
+ * @param[out] fte      The next route.
+ *
+ * @return  true, if @p fte contains a route.
+ * @return  false, if the iteration is finished.
+ */
+bool gnrc_rpl_dao_table_iter(void **state, gnrc_ipv6_nib_ft_t *fte);
+
+/**
+ * @brief   Advances the timer wheel by one slot and removes expired routes
+ *
+ * Has to be called every @ref CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC seconds
+ * while routes are in the table.
+ *
+ * @return  Number of routes left in the table.
+ */
+unsigned gnrc_rpl_dao_table_tick(void);
+
+/**
+ * @brief   Gets the memory usage and fill level of the table
+ *
+ * @param[out] stats    Statistics of the table.
+ */
+void gnrc_rpl_dao_table_stats(gnrc_rpl_dao_table_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -166,6 +166,44 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Number of hash buckets of each VRB index
+ *
+ * Entries are found by their incoming and by their outgoing label through a
+ * hash index each. Must be a power of two.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS     (16U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS */
+
+/**
+ * @brief   Number of slots of the wheel VRB entries expire from
+ *
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US is split into one slot less,
+ * so garbage collection only looks at entries due in the slots passed since
+ * it last ran. Must be at least 2.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_WHEEL_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_WHEEL_SIZE  (8U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_WHEEL_SIZE */
+
+/**
+ * @brief   Number of compressed headers kept for reuse
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc_template](@ref net_gnrc_sixlowpan_iphc_template)
+ *          module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_TEMPLATE_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_TEMPLATE_NUMOF   (2U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_TEMPLATE_NUMOF */
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
@@ -395,6 +433,31 @@ extern "C" {
 #ifndef CONFIG_GNRC_SIXLOWPAN_SFR_MOCK_ARQ_TIMER
 #define CONFIG_GNRC_SIXLOWPAN_SFR_MOCK_ARQ_TIMER        0U
 #endif
+
+/**
+ * @brief   Number of paths @ref net_gnrc_sixlowpan_frag_sfr_path keeps state
+ *          for
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_PATH_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_SFR_PATH_NUMOF            4U
+#endif
+
+/**
+ * @brief   Step in bytes by which @ref net_gnrc_sixlowpan_frag_sfr_path
+ *          changes the fragment size of a path
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP
+#define CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP   8U
+#endif
+
+/**
+ * @brief   Number of RFRAG-ACKs without losses after which
+ *          @ref net_gnrc_sixlowpan_frag_sfr_path increases the fragment size
+ *          of a path again
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_SFR_PATH_CLEAN_ACKS
+#define CONFIG_GNRC_SIXLOWPAN_SFR_PATH_CLEAN_ACKS       4U
+#endif
 /** @} */
 
 /**
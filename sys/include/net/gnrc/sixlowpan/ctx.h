@@ -73,9 +73,25 @@ typedef struct {
     uint16_t ltime;
 } gnrc_sixlowpan_ctx_t;
 
+/**
+ * @brief   Memo of the last context lookup for an address
+ *
+ * Packets of a flow have the same addresses, so the context found for the
+ * last packet is kept and used until the address or the contexts change.
+ * Zero-initialize before the first use.
+ */
+typedef struct {
+    ipv6_addr_t addr;           /**< address looked up last */
+    gnrc_sixlowpan_ctx_t *ctx;  /**< context found for gnrc_sixlowpan_ctx_memo_t::addr */
+    uint32_t seq;               /**< version of the contexts the lookup was for */
+} gnrc_sixlowpan_ctx_memo_t;
+
 /**
  * @brief   Gets a context matching the given IPv6 address best with its prefix.
  *
+ * Of the contexts with a prefix covering @p addr, the one with the longest
+ * prefix is returned.
+ *
  * @param[in] addr  An IPv6 address.
  *
  * @return  The context associated with the best prefix for @p addr.
@@ -83,6 +99,30 @@ typedef struct {
  */
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr);
 
+/**
+ * @brief   Gets a context matching the given IPv6 address best with its
+ *          prefix, using the result of the last lookup if possible
+ *
+ * @param[in,out] memo  Memo of the last lookup. Must not be used by
+ *                      multiple threads concurrently.
+ * @param[in] addr      An IPv6 address.
+ *
+ * @return  The context associated with the best prefix for @p addr.
+ * @return  NULL if there is no such context.
+ */
+gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_memo(gnrc_sixlowpan_ctx_memo_t *memo,
+                                                     const ipv6_addr_t *addr);
+
+/**
+ * @brief   Gets the version of the context buffer
+ *
+ * The version changes whenever a context is added, changed, removed or
+ * withdrawn from compression. It is odd while the context buffer is changed.
+ *
+ * @return  The current version of the context buffer.
+ */
+uint32_t gnrc_sixlowpan_ctx_seq(void);
+
 /**
  * @brief   Gets context by ID.
  *
@@ -117,12 +157,7 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
  *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
 
 /**
  * @brief   Check if a prefix matches a compression context
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup net_gnrc_sixlowpan_frag_sfr_path Per-path state for 6LoWPAN SFR
+ * @ingroup net_gnrc_sixlowpan_frag_sfr
+ *
+ * @brief   Adapts ARQ timeout and fragment size of 6LoWPAN SFR to the path
+ *
+ * When included, the fragmenting endpoint keeps a small cache of state per
+ * link-layer destination. It estimates the round-trip time from the timing of
+ * RFRAG-ACKs as TCP does ([RFC 6298](https://tools.ietf.org/html/rfc6298)) and
+ * uses the resulting retransmission timeout as ARQ timeout, bounded by
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS and
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS. The fragment size is
+ * decreased by @ref CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP when
+ * fragments get lost and increased again after
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_PATH_CLEAN_ACKS RFRAG-ACKs without losses,
+ * bounded by @ref CONFIG_GNRC_SIXLOWPAN_SFR_MIN_FRAG_SIZE and
+ * @ref CONFIG_GNRC_SIXLOWPAN_SFR_MAX_FRAG_SIZE.
+ *
+ * @see     [RFC 8931, section 7.1](https://tools.ietf.org/html/rfc8931#section-7.1)
+ * @{
+ *
+ * @file
+ * @brief   Per-path state definitions for @ref net_gnrc_sixlowpan_frag_sfr
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/sixlowpan/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State on the path to a link-layer destination
+ */
+typedef struct {
+    const gnrc_netif_t *netif;  /**< interface to the destination, NULL if unused */
+    uint32_t srtt;              /**< smoothed round-trip time in 1/8 ms, 0 without sample */
+    uint32_t rttvar;            /**< round-trip time variation in 1/4 ms */
+    uint32_t rto;               /**< ARQ timeout for the path in ms */
+    uint16_t frag_size;         /**< fragment size for the path, including the
+                                 *   RFRAG header */
+    uint8_t clean;              /**< RFRAG-ACKs without losses since the last
+                                 *   change of gnrc_sixlowpan_frag_sfr_path_t::frag_size */
+    uint8_t l2addr_len;         /**< length of gnrc_sixlowpan_frag_sfr_path_t::l2addr */
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< link-layer destination */
+} gnrc_sixlowpan_frag_sfr_path_t;
+
+/**
+ * @brief   Gets the state for the path to a link-layer destination
+ *
+ * @param[in] netif     The interface the destination is reached over
+ * @param[in] l2addr    The link-layer address of the destination
+ * @param[in] l2addr_len    Length of @p l2addr
+ * @param[in] create    Create the state, if there is none yet. The least
+ *                      recently used state is replaced if the cache is full.
+ *
+ * @return  The state for the path. Only valid until the next call.
+ * @return  NULL, if there is no state for the path and @p create is false.
+ */
+gnrc_sixlowpan_frag_sfr_path_t *gnrc_sixlowpan_frag_sfr_path_get(const gnrc_netif_t *netif,
+                                                                 const uint8_t *l2addr,
+                                                                 uint8_t l2addr_len,
+                                                                 bool create);
+
+/**
+ * @brief   Reports a round-trip time sample for a path
+ *
+ * Only report samples for fragments that were not resent (Karn's algorithm).
+ *
+ * @param[in,out] path  State of the path
+ * @param[in] rtt       Time in ms between sending a fragment that requested
+ *                      an acknowledgment and receiving the RFRAG-ACK for it
+ */
+void gnrc_sixlowpan_frag_sfr_path_rtt(gnrc_sixlowpan_frag_sfr_path_t *path,
+                                      uint32_t rtt);
+
+/**
+ * @brief   Reports an RFRAG-ACK for a path
+ *
+ * @param[in,out] path  State of the path
+ * @param[in] lost      Number of fragments the RFRAG-ACK did not acknowledge
+ */
+void gnrc_sixlowpan_frag_sfr_path_ack(gnrc_sixlowpan_frag_sfr_path_t *path,
+                                      unsigned lost);
+
+/**
+ * @brief   Reports an ARQ timeout for a path
+ *
+ * Backs the ARQ timeout of the path off and decreases its fragment size.
+ *
+ * @param[in,out] path  State of the path
+ */
+void gnrc_sixlowpan_frag_sfr_path_timeout(gnrc_sixlowpan_frag_sfr_path_t *path);
+
+#if defined(TEST_SUITES) || DOXYGEN
+/**
+ * @brief   Removes the state of all paths
+ *
+ * @note    Only available with test
+ */
+void gnrc_sixlowpan_frag_sfr_path_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -51,6 +51,14 @@ typedef struct gnrc_sixlowpan_frag_sfr_fb {
     evtimer_msg_event_t arq_timeout_event;
     uint32_t arq_timeout;       /**< Time in microseconds the sender should
                                  *   wait for an RFRAG Acknowledgment */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || DOXYGEN
+    uint32_t start;             /**< Time in milliseconds the first fragment
+                                 *   was sent */
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH) || DOXYGEN
+    uint16_t frag_size;         /**< Fragment size for the path of the
+                                 *   datagram, including the RFRAG header */
+#endif
     uint8_t cur_seq;            /**< Sequence number for next fragment */
     uint8_t frags_sent;         /**< Number of fragments sent */
     uint8_t retrans;            /**< Datagram retransmissions */
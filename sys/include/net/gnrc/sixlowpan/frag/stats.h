@@ -17,6 +17,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37,6 +39,14 @@ typedef struct {
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
 #endif
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || DOXYGEN
+    unsigned sfr_datagrams; /**< datagrams sent with selective fragment
+                             *   recovery and acknowledged completely */
+    uint32_t sfr_time_sum;  /**< sum of the times in ms from sending the first
+                             *   fragment to receiving the complete
+                             *   acknowledgment of those datagrams */
+    uint32_t sfr_time_max;  /**< maximum of those times in ms */
+#endif
 } gnrc_sixlowpan_frag_stats_t;
 
 /**
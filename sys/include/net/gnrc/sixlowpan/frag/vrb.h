@@ -9,6 +9,12 @@
  * @defgroup    net_gnrc_sixlowpan_frag_vrb Virtual reassembly buffer
  * @ingroup     net_gnrc_sixlowpan_frag
  * @brief       Virtual reassembly buffer
+ *
+ * Entries are found through two hash indices, one by the label of the incoming
+ * fragments for forwarding and one by the label of the outgoing fragments for
+ * reverse label switching, so the cost per forwarded fragment does not grow
+ * with @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE. For garbage collection,
+ * entries are filed into the slot of a timer wheel they are due in.
  * @{
  *
  * @file
@@ -142,18 +148,26 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
         const gnrc_netif_t *netif, const uint8_t *src, size_t src_len,
         unsigned tag);
 
+/**
+ * @brief   Sets the arrival time of a VRB entry
+ *
+ * The entry times out @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US after
+ * @p arrival. Writing gnrc_sixlowpan_frag_rb_base_t::arrival directly is only
+ * safe to postpone the timeout, an earlier time would only be noticed when
+ * the entry was due before.
+ *
+ * @param[in] vrb       A VRB entry
+ * @param[in] arrival   New arrival time of the entry in microseconds
+ */
+void gnrc_sixlowpan_frag_vrb_set_arrival(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                         uint32_t arrival);
+
 /**
  * @brief   Removes an entry from the VRB
  *
  * @param[in] vrb   A VRB entry
  */
-static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
-        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
-    }
-    vrb->super.src_len = 0;
-}
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
 
 /**
  * @brief   Determines if a VRB entry is empty
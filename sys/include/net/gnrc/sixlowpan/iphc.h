@@ -60,6 +60,16 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+/**
+ * @brief   Gets the number of packets whose compressed headers were taken
+ *          from a template
+ *
+ * @note    Only available with the `gnrc_sixlowpan_iphc_template` module.
+ *
+ * @return  number of template hits since boot
+ */
+unsigned gnrc_sixlowpan_iphc_template_hits(void);
+
 #ifdef __cplusplus
 }
 #endif
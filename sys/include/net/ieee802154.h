@@ -74,6 +74,9 @@ extern "C" {
 #define IEEE802154_FCF_VERS_MASK            (0x30)
 #define IEEE802154_FCF_VERS_V0              (0x00)
 #define IEEE802154_FCF_VERS_V1              (0x10)
+#define IEEE802154_FCF_VERS_V2              (0x20)
+
+#define IEEE802154_FCF_IE_PRESENT           (0x02)  /**< information elements present */
 
 #define IEEE802154_FCF_SRC_ADDR_MASK        (0xc0)
 #define IEEE802154_FCF_SRC_ADDR_VOID        (0x00)  /**< no source address */
@@ -152,6 +152,23 @@ typedef struct {
      */
     void (*tx_done)(ieee802154_submac_t *submac, int status,
                     ieee802154_tx_info_t *info);
+    /**
+     * @brief TX pending event (optional)
+     *
+     * This function is called from the SubMAC right after it requested the
+     * transmission of a data frame, while the radio performs CCA and sends.
+     * The upper layer may use the time to prepare the next frame, e.g. to
+     * precompute its keystream.
+     *
+     * It is only called when the radio handles the ACK or no ACK was
+     * requested, so the time spent in the function can not make the SubMAC
+     * miss the ACK. May be `NULL`.
+     *
+     * @note The function must not call @ref ieee802154_send.
+     *
+     * @param[in] submac pointer to the SubMAC descriptor
+     */
+    void (*tx_pending)(ieee802154_submac_t *submac);
 } ieee802154_submac_cb_t;
 
 /**
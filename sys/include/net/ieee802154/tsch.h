@@ -0,0 +1,564 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup     net_ieee802154_tsch IEEE802.15.4 TSCH MAC
+ * @ingroup      net_ieee802154
+ * @experimental This API is experimental and in an early state - expect
+ *               changes!
+ *
+ * @brief        Time-slotted channel hopping (TSCH) on top of the IEEE 802.15.4
+ *               radio HAL
+ *
+ * When the module `ieee802154_tsch` is used, the netdev adaption of the
+ * @ref net_ieee802154_submac hands the radio to this layer, so every radio
+ * with a HAL implementation can run TSCH below @ref net_gnrc_netif.
+ *
+ * Time is divided into timeslots of 10 ms, counted by the absolute slot number
+ * (ASN). Timeslots repeat in slotframes. A cell is a timeslot of a slotframe
+ * plus a channel offset, the channel of a cell changes with every slotframe
+ * along the hopping sequence
+ * @ref CONFIG_IEEE802154_TSCH_HOPPING_SEQUENCE. In each timeslot the radio is
+ * only switched on, if the schedule has a cell for it:
+ *
+ * - a TX cell is used, if a frame for the neighbor of the cell is queued. Cells
+ *   for any neighbor take broadcast frames and frames to neighbors without
+ *   dedicated TX cell. Frames that were not acknowledged are retried in the
+ *   next suitable cell, with an exponential backoff in shared cells, until
+ *   they are acknowledged or dropped. ieee802154_tsch_cb_t::tx_done reports
+ *   either.
+ * - otherwise, the radio listens in an RX cell.
+ *
+ * Frames are queued per cell, so a frame to one neighbor does not wait for the
+ * cell of another.
+ *
+ * The node started as PAN coordinator (@ref NETOPT_PAN_COORD) sets the ASN and
+ * starts sending enhanced beacons (EB) with a TSCH synchronization IE in the
+ * shared cells. Other nodes listen on the first channel of the hopping
+ * sequence until they hear an EB, take over its ASN and slot timing and start
+ * sending EBs themselves. The sender of that EB is the time source of the node:
+ * each frame from it corrects the slot timing. Without such a frame for
+ * @ref CONFIG_IEEE802154_TSCH_DESYNC_TIMEOUT_MS the node leaves the network and
+ * listens for EBs again.
+ *
+ * All nodes start with the minimal configuration of
+ * [RFC 8180](https://tools.ietf.org/html/rfc8180): one slotframe of
+ * @ref CONFIG_IEEE802154_TSCH_MINIMAL_SLOTFRAME_LENGTH timeslots with a single
+ * shared cell at slot offset 0 and channel offset 0. Further slotframes and
+ * cells can be added by the upper layer.
+ *
+ * The radio runs in promiscuous mode: TSCH filters frames by destination
+ * address and sends the ACKs macTsTxAckDelay after the frame, as the timeslot
+ * template demands. Timekeeping is frame based only, the time source
+ * corrects the slot timing with every frame it sends.
+ *
+ * @note    EBs only carry the TSCH synchronization IE, so all nodes need the
+ *          same schedule, hopping sequence and the default timeslot template
+ *          of the 2.4 GHz O-QPSK PHY.
+ * @note    Radios that wait for ACKs in hardware
+ *          (@ref IEEE802154_CAP_FRAME_RETRANS) are not supported yet.
+ *
+ * The upper layer needs to implement @ref ieee802154_tsch_bh_request and to
+ * pass the radio events to @ref ieee802154_tsch_radio_event,
+ * @ref ieee802154_tsch_tx_done_cb, @ref ieee802154_tsch_rx_done_cb and
+ * @ref ieee802154_tsch_crc_error_cb.
+ *
+ * TSCH does not lock its state. Apart from @ref ieee802154_tsch_radio_event,
+ * all functions that take a descriptor must be called from the thread that
+ * runs the bottom half, i.e. the thread of the network interface. Other
+ * threads change the schedule with @ref NETOPT_TSCH_SLOTFRAME and
+ * @ref NETOPT_TSCH_CELL, e.g. via `gnrc_netapi_set()`.
+ *
+ * @see     [RFC 7554](https://tools.ietf.org/html/rfc7554)
+ * @{
+ *
+ * @file
+ * @brief   TSCH MAC definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "iolist.h"
+#include "net/ieee802154.h"
+#include "net/ieee802154/radio.h"
+#include "net/ieee802154/submac.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_ieee802154_tsch_conf  IEEE802.15.4 TSCH compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of slotframes
+ */
+#ifndef CONFIG_IEEE802154_TSCH_SLOTFRAME_NUMOF
+#define CONFIG_IEEE802154_TSCH_SLOTFRAME_NUMOF      (2U)
+#endif
+
+/**
+ * @brief   Number of cells of all slotframes together
+ */
+#ifndef CONFIG_IEEE802154_TSCH_CELL_NUMOF
+#define CONFIG_IEEE802154_TSCH_CELL_NUMOF           (8U)
+#endif
+
+/**
+ * @brief   Number of frames that can be queued
+ */
+#ifndef CONFIG_IEEE802154_TSCH_QUEUE_SIZE
+#define CONFIG_IEEE802154_TSCH_QUEUE_SIZE           (8U)
+#endif
+
+/**
+ * @brief   Length in timeslots of the slotframe of the minimal configuration
+ */
+#ifndef CONFIG_IEEE802154_TSCH_MINIMAL_SLOTFRAME_LENGTH
+#define CONFIG_IEEE802154_TSCH_MINIMAL_SLOTFRAME_LENGTH (101U)
+#endif
+
+/**
+ * @brief   Channel hopping sequence
+ */
+#ifndef CONFIG_IEEE802154_TSCH_HOPPING_SEQUENCE
+#define CONFIG_IEEE802154_TSCH_HOPPING_SEQUENCE \
+    { 16, 17, 23, 18, 26, 15, 25, 22, 19, 11, 12, 13, 24, 14, 20, 21 }
+#endif
+
+/**
+ * @brief   Maximum number of retransmissions of a frame (macMaxFrameRetries)
+ */
+#ifndef CONFIG_IEEE802154_TSCH_MAX_FRAME_RETRIES
+#define CONFIG_IEEE802154_TSCH_MAX_FRAME_RETRIES    (3U)
+#endif
+
+/**
+ * @brief   Minimum backoff exponent in shared cells (macMinBe)
+ */
+#ifndef CONFIG_IEEE802154_TSCH_MIN_BE
+#define CONFIG_IEEE802154_TSCH_MIN_BE               (1U)
+#endif
+
+/**
+ * @brief   Maximum backoff exponent in shared cells (macMaxBe)
+ */
+#ifndef CONFIG_IEEE802154_TSCH_MAX_BE
+#define CONFIG_IEEE802154_TSCH_MAX_BE               (5U)
+#endif
+
+/**
+ * @brief   Mean period in milliseconds between two enhanced beacons
+ *
+ * The actual period is randomized by ±25 %.
+ */
+#ifndef CONFIG_IEEE802154_TSCH_EB_PERIOD_MS
+#define CONFIG_IEEE802154_TSCH_EB_PERIOD_MS         (4000U)
+#endif
+
+/**
+ * @brief   Time in milliseconds without frame from the time source after
+ *          which a node leaves the network
+ */
+#ifndef CONFIG_IEEE802154_TSCH_DESYNC_TIMEOUT_MS
+#define CONFIG_IEEE802154_TSCH_DESYNC_TIMEOUT_MS    (20000U)
+#endif
+/** @} */
+
+/**
+ * @name    Default timeslot template of the 2.4 GHz O-QPSK PHY in µs
+ * @see     IEEE 802.15.4-2015, table 8-99
+ * @{
+ */
+#define IEEE802154_TSCH_TS_TX_OFFSET_US     (2120U) /**< macTsTxOffset */
+#define IEEE802154_TSCH_TS_RX_OFFSET_US     (1020U) /**< macTsRxOffset */
+#define IEEE802154_TSCH_TS_TX_ACK_DELAY_US  (1000U) /**< macTsTxAckDelay */
+#define IEEE802154_TSCH_TS_RX_WAIT_US       (2200U) /**< macTsRxWait */
+#define IEEE802154_TSCH_TS_ACK_WAIT_US      (400U)  /**< macTsAckWait */
+#define IEEE802154_TSCH_TS_MAX_TX_US        (4256U) /**< macTsMaxTx */
+#define IEEE802154_TSCH_TS_LENGTH_US        (10000U)/**< macTsTimeslotLength */
+/** @} */
+
+/**
+ * @name    Link options of a cell
+ * @see     IEEE 802.15.4-2015, section 7.4.4.3
+ * @{
+ */
+#define IEEE802154_TSCH_LINK_TX             (0x01)  /**< transmit cell */
+#define IEEE802154_TSCH_LINK_RX             (0x02)  /**< receive cell */
+#define IEEE802154_TSCH_LINK_SHARED         (0x04)  /**< shared cell, with backoff */
+#define IEEE802154_TSCH_LINK_TIMEKEEPING    (0x08)  /**< timekeeping cell */
+/** @} */
+
+/**
+ * @brief   Length of an EB written by @ref ieee802154_tsch_eb_write
+ */
+#define IEEE802154_TSCH_EB_LEN      (25U)
+
+/**
+ * @brief   Marks an unused slotframe or cell
+ */
+#define IEEE802154_TSCH_NONE                (UINT8_MAX)
+
+/**
+ * @brief   TSCH forward declaration
+ */
+typedef struct ieee802154_tsch ieee802154_tsch_t;
+
+/**
+ * @brief   TSCH callbacks
+ */
+typedef struct {
+    /**
+     * @brief   RX done event
+     *
+     * A data or MAC command frame for this node was received. Fetch it with
+     * @ref ieee802154_tsch_read_frame.
+     *
+     * @param[in] tsch  TSCH descriptor
+     */
+    void (*rx_done)(ieee802154_tsch_t *tsch);
+    /**
+     * @brief   TX done event
+     *
+     * A frame queued with @ref ieee802154_tsch_send left the queue. It was
+     * either sent (and acknowledged, if requested) or dropped after
+     * @ref CONFIG_IEEE802154_TSCH_MAX_FRAME_RETRIES retransmissions.
+     *
+     * @param[in] tsch      TSCH descriptor
+     * @param[in] status    @ref TX_STATUS_SUCCESS or @ref TX_STATUS_NO_ACK
+     * @param[in] info      status and retransmissions of the frame
+     */
+    void (*tx_done)(ieee802154_tsch_t *tsch, int status,
+                    ieee802154_tx_info_t *info);
+} ieee802154_tsch_cb_t;
+
+/**
+ * @brief   State of a node
+ */
+typedef enum {
+    IEEE802154_TSCH_STATE_OFF,          /**< TSCH not initialized */
+    IEEE802154_TSCH_STATE_SCANNING,     /**< listening for EBs */
+    IEEE802154_TSCH_STATE_JOINED,       /**< synchronized to the network */
+} ieee802154_tsch_state_t;
+
+/**
+ * @brief   A cell of a slotframe
+ */
+typedef struct {
+    uint16_t slot_offset;               /**< timeslot in the slotframe */
+    uint8_t channel_offset;             /**< offset in the hopping sequence */
+    uint8_t options;                    /**< IEEE802154_TSCH_LINK_* flags */
+    uint8_t slotframe;                  /**< handle of the slotframe or
+                                         *   @ref IEEE802154_TSCH_NONE */
+    uint8_t addr_len;                   /**< length of
+                                         *   ieee802154_tsch_cell_t::addr, 0 for
+                                         *   any neighbor */
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];  /**< neighbor of the cell */
+} ieee802154_tsch_cell_t;
+
+/**
+ * @brief   A slotframe, value of @ref NETOPT_TSCH_SLOTFRAME
+ */
+typedef struct {
+    uint8_t handle;                     /**< handle of the slotframe */
+    uint16_t length;                    /**< length in timeslots, 0 to remove
+                                         *   the slotframe */
+} ieee802154_tsch_slotframe_t;
+
+/**
+ * @brief   A queued frame
+ */
+typedef struct {
+    uint8_t psdu[IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN];    /**< PSDU without FCS */
+    uint8_t len;                        /**< length of the PSDU, 0 if unused */
+    uint8_t addr_len;                   /**< length of the destination address */
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];  /**< destination address */
+    uint16_t order;                     /**< position in the queue */
+    uint8_t retries;                    /**< retransmissions so far */
+    uint8_t be;                         /**< backoff exponent in shared cells */
+    uint8_t backoff;                    /**< shared cells to skip */
+} ieee802154_tsch_frame_t;
+
+/**
+ * @brief   TSCH descriptor
+ */
+struct ieee802154_tsch {
+    ieee802154_submac_t *submac;        /**< SubMAC owning the radio and the
+                                         *   addresses */
+    const ieee802154_tsch_cb_t *cb;     /**< callbacks */
+    ztimer_t timer;                     /**< slot timer */
+    uint64_t asn;                       /**< absolute slot number of the
+                                         *   current or next slot */
+    uint32_t slot_start;                /**< start of that slot (ZTIMER_USEC) */
+    uint32_t rx_time;                   /**< time of the last RX done event */
+    uint32_t tx_time;                   /**< time of the last TX done event */
+    uint32_t deadline;                  /**< time the slot timer is set to */
+    uint32_t last_sync;                 /**< time of the last frame from the
+                                         *   time source */
+    uint32_t next_eb;                   /**< time the next EB is due */
+    uint16_t slotframes[CONFIG_IEEE802154_TSCH_SLOTFRAME_NUMOF];    /**< lengths
+                                         *   of the slotframes by handle, 0 if
+                                         *   unused */
+    ieee802154_tsch_cell_t cells[CONFIG_IEEE802154_TSCH_CELL_NUMOF];    /**< cells */
+    ieee802154_tsch_frame_t queue[CONFIG_IEEE802154_TSCH_QUEUE_SIZE];   /**< frames */
+    uint8_t rx_buf[IEEE802154_FRAME_LEN_MAX];   /**< last received frame */
+    ieee802154_rx_info_t rx_info;       /**< RX info of the last received frame */
+    uint8_t rx_len;                     /**< length of the last received frame */
+    uint8_t time_source[IEEE802154_LONG_ADDRESS_LEN];   /**< long address of the
+                                                         *   time source */
+    uint16_t order;                     /**< position for the next queued frame */
+    uint8_t state;                      /**< @ref ieee802154_tsch_state_t */
+    uint8_t slot_state;                 /**< state within the slot */
+    uint8_t cell;                       /**< cell of the current slot */
+    uint8_t frame;                      /**< frame sent in the current slot */
+    uint8_t channel;                    /**< current channel */
+    uint8_t join_metric;                /**< hops to the PAN coordinator */
+    uint8_t eb_seq;                     /**< sequence number of the next EB */
+    bool coordinator;                   /**< node is PAN coordinator */
+    bool rx_ready;                      /**< ieee802154_tsch_t::rx_buf holds a
+                                         *   frame to announce at the end of
+                                         *   the slot */
+};
+
+/**
+ * @brief   Initializes TSCH and starts listening for EBs
+ *
+ * The radio is taken from @p submac, which must be initialized and idle. The
+ * addresses, PAN ID, PHY mode and TX power of @p submac are used.
+ *
+ * @param[out] tsch     TSCH descriptor
+ * @param[in] submac    Initialized SubMAC
+ * @param[in] cb        Callbacks
+ */
+void ieee802154_tsch_init(ieee802154_tsch_t *tsch, ieee802154_submac_t *submac,
+                          const ieee802154_tsch_cb_t *cb);
+
+/**
+ * @brief   Starts a network as PAN coordinator
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_start(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Leaves the network and listens for EBs
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_scan(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Replaces the schedule with the minimal configuration of RFC 8180
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_schedule_minimal(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Adds a slotframe
+ *
+ * @pre     Called from the thread of the network interface, use
+ *          @ref NETOPT_TSCH_SLOTFRAME from other threads
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ * @param[in] handle    Handle of the slotframe. Slotframes with lower handle
+ *                      take precedence, if cells of several slotframes fall
+ *                      into a timeslot.
+ * @param[in] length    Length of the slotframe in timeslots
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p handle is out of range or @p length is 0
+ * @return  -EEXIST, if a slotframe with @p handle exists
+ */
+int ieee802154_tsch_slotframe_add(ieee802154_tsch_t *tsch, uint8_t handle,
+                                  uint16_t length);
+
+/**
+ * @brief   Removes a slotframe and its cells
+ *
+ * @pre     Called from the thread of the network interface, use
+ *          @ref NETOPT_TSCH_SLOTFRAME from other threads
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ * @param[in] handle    Handle of the slotframe
+ */
+void ieee802154_tsch_slotframe_remove(ieee802154_tsch_t *tsch, uint8_t handle);
+
+/**
+ * @brief   Adds a cell
+ *
+ * @pre     Called from the thread of the network interface, use
+ *          @ref NETOPT_TSCH_CELL from other threads
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ * @param[in] cell      The cell
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if the slotframe of @p cell does not exist or the slot
+ *          offset does not fit into it
+ * @return  -ENOMEM, if there is no space for another cell
+ */
+int ieee802154_tsch_cell_add(ieee802154_tsch_t *tsch,
+                             const ieee802154_tsch_cell_t *cell);
+
+/**
+ * @brief   Removes the cells at a timeslot of a slotframe
+ *
+ * @pre     Called from the thread of the network interface, use
+ *          @ref NETOPT_TSCH_CELL from other threads
+ *
+ * @param[in,out] tsch      TSCH descriptor
+ * @param[in] handle        Handle of the slotframe
+ * @param[in] slot_offset   Timeslot in the slotframe
+ */
+void ieee802154_tsch_cell_remove(ieee802154_tsch_t *tsch, uint8_t handle,
+                                 uint16_t slot_offset);
+
+/**
+ * @brief   Queues a frame for the cells to its destination
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ * @param[in] iolist    PSDU without FCS
+ *
+ * The result is reported with ieee802154_tsch_cb_t::tx_done once the frame
+ * was sent or dropped.
+ *
+ * @return  length of the frame including FCS on success
+ * @return  -ENETDOWN, if the node did not join a network
+ * @return  -EBUSY, if the queue is full
+ * @return  -EINVAL, if the frame is too long or has no valid header
+ */
+int ieee802154_tsch_send(ieee802154_tsch_t *tsch, const iolist_t *iolist);
+
+/**
+ * @brief   Gets the length of the frame announced by
+ *          @ref ieee802154_tsch_cb_t::rx_done
+ *
+ * @param[in] tsch  TSCH descriptor
+ *
+ * @return  length of the frame without FCS, 0 if there is none
+ */
+static inline int ieee802154_tsch_get_frame_length(const ieee802154_tsch_t *tsch)
+{
+    return tsch->rx_len;
+}
+
+/**
+ * @brief   Reads the frame announced by @ref ieee802154_tsch_cb_t::rx_done
+ *
+ * The frame is released afterwards.
+ *
+ * @param[in] tsch  TSCH descriptor
+ * @param[out] buf  Buffer for the frame without FCS, NULL to drop it
+ * @param[in] len   Size of @p buf
+ * @param[out] info RX info of the frame, may be NULL
+ *
+ * @return  length of the frame
+ * @return  -ENOBUFS, if @p buf is too small
+ */
+int ieee802154_tsch_read_frame(ieee802154_tsch_t *tsch, void *buf, size_t len,
+                               ieee802154_rx_info_t *info);
+
+/**
+ * @brief   Gets the channel of a cell in a timeslot
+ *
+ * @param[in] asn               Absolute slot number of the timeslot
+ * @param[in] channel_offset    Channel offset of the cell
+ *
+ * @return  The channel
+ */
+uint8_t ieee802154_tsch_channel(uint64_t asn, uint8_t channel_offset);
+
+/**
+ * @brief   Writes an enhanced beacon with TSCH synchronization IE
+ *
+ * @param[out] buf          Buffer of at least @ref IEEE802154_TSCH_EB_LEN bytes
+ * @param[in] src           Long source address
+ * @param[in] panid         PAN ID
+ * @param[in] seq           Sequence number
+ * @param[in] asn           ASN of the timeslot the EB is sent in
+ * @param[in] join_metric   Hops to the PAN coordinator
+ *
+ * @return  Length of the EB without FCS
+ */
+size_t ieee802154_tsch_eb_write(uint8_t *buf, const eui64_t *src, uint16_t panid,
+                                uint8_t seq, uint64_t asn, uint8_t join_metric);
+
+/**
+ * @brief   Parses the TSCH synchronization IE of an enhanced beacon
+ *
+ * @param[in] buf           The frame without FCS
+ * @param[in] len           Length of @p buf
+ * @param[out] asn          ASN of the timeslot the EB was sent in
+ * @param[out] join_metric  Hops of the sender to the PAN coordinator
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p buf is no EB with TSCH synchronization IE
+ */
+int ieee802154_tsch_eb_parse(const uint8_t *buf, size_t len, uint64_t *asn,
+                             uint8_t *join_metric);
+
+/**
+ * @brief   Records the time of radio events
+ *
+ * Must be called from the radio event callback for all events, before they
+ * are passed on to the callbacks of TSCH.
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ * @param[in] ev        The radio event
+ */
+void ieee802154_tsch_radio_event(ieee802154_tsch_t *tsch, ieee802154_trx_ev_t ev);
+
+/**
+ * @brief   @ref ieee802154_tsch_bh_process should be called as soon as possible
+ *
+ * Called from ISR context.
+ *
+ * @note This function should be implemented by the user of TSCH.
+ *
+ * @param[in] tsch  TSCH descriptor
+ */
+extern void ieee802154_tsch_bh_request(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Processes the slot timer
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_bh_process(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Indicates TSCH that the radio finished a transmission
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_tx_done_cb(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Indicates TSCH that the radio received a frame
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_rx_done_cb(ieee802154_tsch_t *tsch);
+
+/**
+ * @brief   Indicates TSCH that the radio received a frame with invalid CRC
+ *
+ * @param[in,out] tsch  TSCH descriptor
+ */
+void ieee802154_tsch_crc_error_cb(ieee802154_tsch_t *tsch);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -29,6 +29,7 @@
 #include <stdint.h>
 #include "ieee802154.h"
 #include "crypto/ciphers.h"
+#include "modules.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -228,6 +229,50 @@ typedef enum {
     IEEE802154_SEC_UNSUPORTED,                          /**< Unsupported operation */
 } ieee802154_sec_error_t;
 
+/**
+ * @brief   Number of keystream blocks precomputed for a frame
+ *
+ * The block A0 for the MIC and enough blocks Ai for the largest payload.
+ */
+#define IEEE802154_SEC_KEYSTREAM_BLOCKS \
+    (1U + ((IEEE802154_FRAME_LEN_MAX + IEEE802154_SEC_BLOCK_SIZE - 1) / \
+           IEEE802154_SEC_BLOCK_SIZE))
+
+/**
+ * @brief   Keystream precomputed for the next frame to encrypt
+ *
+ * The CTR keystream of CCM* only depends on the key and the nonce, so it can
+ * be computed before the frame is known.
+ *
+ * @see     ieee802154_sec_precompute()
+ */
+typedef struct {
+    /**
+     * @brief   Encrypted counter blocks A0, A1, ...
+     */
+    uint8_t blocks[IEEE802154_SEC_KEYSTREAM_BLOCKS][IEEE802154_SEC_BLOCK_SIZE];
+    /**
+     * @brief   Key the keystream was computed with
+     */
+    uint8_t key[IEEE802154_SEC_KEY_LENGTH];
+    /**
+     * @brief   Source address of the nonce
+     */
+    uint8_t src_addr[IEEE802154_LONG_ADDRESS_LEN];
+    /**
+     * @brief   Frame counter of the nonce
+     */
+    uint32_t frame_counter;
+    /**
+     * @brief   Security level of the nonce
+     */
+    uint8_t security_level;
+    /**
+     * @brief   Number of valid blocks, 0 if there is no keystream
+     */
+    uint8_t numof;
+} ieee802154_sec_keystream_t;
+
 /**
  * @brief   Struct to hold IEEE 802.15.4 security information
  */
@@ -262,6 +307,14 @@ typedef struct ieee802154_sec_context {
      * @brief   802.15.4 security dev
      */
     ieee802154_sec_dev_t dev;
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM) || defined(DOXYGEN)
+    /**
+     * @brief   Keystream for the next frame
+     *
+     * @note    Only available with module `ieee802154_security_keystream`
+     */
+    ieee802154_sec_keystream_t keystream;
+#endif
 } ieee802154_sec_context_t;
 
 /**
@@ -401,6 +454,23 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
                                  uint8_t *mic, uint8_t *mic_size,
                                  const uint8_t *src_address);
 
+/**
+ * @brief   Precompute the keystream to encrypt the next frame with
+ *
+ * Meant to be called while the radio is busy anyway, e.g. while it performs
+ * CCA and sends the current frame. The next call of
+ * @ref ieee802154_sec_encrypt_frame() then only has to compute the MIC, if
+ * @p src_address, the key, the frame counter, and the security level of @p ctx
+ * did not change in between. Does nothing, if the keystream is already there.
+ *
+ * @note    Only available with module `ieee802154_security_keystream`
+ *
+ * @param[in,out]   ctx                     IEEE 802.15.4 security context
+ * @param[in]       src_address             Long source address of the next frame
+ */
+void ieee802154_sec_precompute(ieee802154_sec_context_t *ctx,
+                               const uint8_t *src_address);
+
 /**
  * @brief   Decrypt IEEE 802.15.4 frame according to @p ctx
  *
@@ -369,6 +369,12 @@ struct _coap_request_ctx {
      */
     uint32_t tl_type;
 #endif
+    /**
+     * @brief   Payload sent after the response, `NULL` if the server does not
+     *          support this
+     * @see     coap_request_ctx_get_payload_snip
+     */
+    iolist_t *payload_snip;
 };
 
 /* forward declarations */
@@ -424,6 +430,23 @@ const sock_udp_ep_t *coap_request_ctx_get_remote_udp(const coap_request_ctx_t *c
  */
 const sock_udp_ep_t *coap_request_ctx_get_local_udp(const coap_request_ctx_t *ctx);
 
+/**
+ * @brief   Get the snip for payload the server sends after the response
+ *
+ * A handler can point this snip to payload data instead of copying the data
+ * into the response buffer. The response buffer then only holds the header,
+ * the options and the payload marker, and the handler returns the length of
+ * those. The data has to stay valid after the handler returned, e.g. because
+ * it is in the read-only data of the firmware.
+ *
+ * @param[in]   ctx The request context
+ *
+ * @return  Snip for payload, initialized to zero length
+ * @return  NULL    The server does not send payload snips, the payload has to
+ *                  be written into the response buffer
+ */
+iolist_t *coap_request_ctx_get_payload_snip(coap_request_ctx_t *ctx);
+
 /**
  * @brief   Structure to hold the state for building a CoAP message
  *
@@ -478,6 +478,9 @@ static inline uint16_t nanocoap_sock_next_msg_id(nanocoap_sock_t *sock)
  *
  * This function only returns if there's an error binding to @p local.
  *
+ * Handlers can attach payload to the response without copying it into @p buf,
+ * see @ref coap_request_ctx_get_payload_snip.
+ *
  * @param[in]   local   local UDP endpoint to bind to
  * @param[in]   buf     response buffer to use
  * @param[in]   bufsize size of @p buf
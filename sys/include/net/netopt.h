@@ -874,6 +874,23 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief (ieee802154_tsch_slotframe_t) Add or remove a TSCH slotframe
+     *
+     * A slotframe of length 0 removes the slotframe with that handle and its
+     * cells. Adding a slotframe with a handle that is in use fails with
+     * -EEXIST.
+     */
+    NETOPT_TSCH_SLOTFRAME,
+
+    /**
+     * @brief (ieee802154_tsch_cell_t) Add or remove a TSCH cell
+     *
+     * A cell without link options removes all cells at its slot offset of
+     * its slotframe.
+     */
+    NETOPT_TSCH_CELL,
+
     /**
      * @brief   maximum number of options defined here.
      *
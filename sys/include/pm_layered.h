@@ -23,6 +23,13 @@
  * - if a mode is blocked, so are implicitly all lower modes
  * - the idle thread automatically selects and sets the lowest unblocked mode
  *
+ * With module `pm_layered_residency`, the idle thread additionally skips modes
+ * that would not pay off: entering and leaving a deep power mode costs time
+ * and energy, so a mode is only used if the next ztimer timer expires no
+ * sooner than the mode's minimum residency (see
+ * @ref PM_MODE_MIN_RESIDENCY_US). Combined with `ztimer_slack`, which lets
+ * timers share wakeups, this yields fewer and longer sleep periods.
+ *
  * In order to use this module, you'll need to implement pm_set().
  *
  * @file
@@ -47,6 +54,19 @@ extern "C" {
 #define PROVIDES_PM_SET_LOWEST
 #endif
 
+/**
+ * @brief   Minimum time in microseconds worth spending in each power mode
+ *
+ * Array initializer with @ref PM_NUM_MODES entries, indexed by power mode.
+ * Only used with module `pm_layered_residency`. A mode is skipped by
+ * @ref pm_set_lowest if the next timer expires earlier than its entry. The
+ * values should cover the wakeup latency and the energy break-even time of
+ * the mode and be defined by the CPU or board. By default, no mode is skipped.
+ */
+#if !defined(PM_MODE_MIN_RESIDENCY_US) || defined(DOXYGEN)
+#  define PM_MODE_MIN_RESIDENCY_US  { 0 }
+#endif
+
 /**
  * @brief Power Management mode blocker typedef
  */
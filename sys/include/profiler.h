@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_profiler Sampling profiler
+ * @ingroup     sys
+ * @brief       Statistical whole-system profiler
+ *
+ * This module periodically samples the program counter (PC) of the code that
+ * was interrupted by a timer, together with the PID of the thread that was
+ * running at that time. Samples are stored in a lock-free ring buffer and can
+ * be drained at any time, e.g. with the `profiler` shell command.
+ *
+ * No symbol information is needed on the device: the host-side script
+ * `dist/tools/profiler/profiler.py` reads the dumped samples and the ELF file
+ * of the application and aggregates the samples into a flat profile per
+ * function and per thread.
+ *
+ * The sampling backend is selected automatically:
+ *
+ * - `profiler_cortexm`: a periodic timer (see @ref CONFIG_PROFILER_TIMER)
+ *   fires at @ref CONFIG_PROFILER_SAMPLE_RATE_HZ. Its ISR reads the PC from
+ *   the exception frame stacked on the process stack. Samples taken while
+ *   another ISR was running are attributed to @ref PROFILER_PID_ISR (only
+ *   detectable on ARMv7-M and ARMv8-M mainline).
+ * - `profiler_native`: `SIGPROF` is delivered via `setitimer(ITIMER_PROF)` and
+ *   the PC is read from the signal context. As the interval timer counts
+ *   consumed CPU time only, idle time is not sampled.
+ *
+ * Usage:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ * > profiler start
+ * ... run the workload ...
+ * > profiler dump
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * and on the host:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ * $ dist/tools/profiler/profiler.py bin/<board>/<app>.elf term.log
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler API
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_profiler_config   Sampling profiler compile time configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of samples that fit into the sample buffer
+ *
+ * @note    Must be a power of two
+ */
+#ifndef CONFIG_PROFILER_BUFSIZE
+#  define CONFIG_PROFILER_BUFSIZE           (256U)
+#endif
+
+/**
+ * @brief   Sampling rate in Hz
+ */
+#ifndef CONFIG_PROFILER_SAMPLE_RATE_HZ
+#  define CONFIG_PROFILER_SAMPLE_RATE_HZ    (1000U)
+#endif
+
+/**
+ * @brief   Timer used for sampling (not used on `native`)
+ *
+ * The timer must not be used by anything else, e.g. ZTIMER.
+ */
+#ifndef CONFIG_PROFILER_TIMER
+#  define CONFIG_PROFILER_TIMER             TIMER_DEV(TIMER_NUMOF - 1)
+#endif
+
+/**
+ * @brief   Frequency to run @ref CONFIG_PROFILER_TIMER at
+ */
+#ifndef CONFIG_PROFILER_TIMER_FREQ
+#  define CONFIG_PROFILER_TIMER_FREQ        (1000000LU)
+#endif
+/** @} */
+
+/**
+ * @brief   PID used for samples that did not interrupt a thread
+ */
+#define PROFILER_PID_ISR                    KERNEL_PID_UNDEF
+
+/**
+ * @brief   A single profiler sample
+ */
+typedef struct {
+    uintptr_t pc;               /**< interrupted program counter */
+    kernel_pid_t pid;           /**< thread running when the sample was taken */
+} profiler_sample_t;
+
+/**
+ * @brief   Start sampling
+ *
+ * @retval  0           Success
+ * @retval  -EALREADY   Profiler is already running
+ * @retval  <0          Failed to start the sampling timer
+ */
+int profiler_start(void);
+
+/**
+ * @brief   Stop sampling
+ *
+ * Samples still in the buffer remain available to @ref profiler_read
+ */
+void profiler_stop(void);
+
+/**
+ * @brief   Check whether the profiler is currently sampling
+ *
+ * @retval  true    Profiler is running
+ * @retval  false   Profiler is stopped
+ */
+bool profiler_is_running(void);
+
+/**
+ * @brief   Store a sample in the sample buffer
+ *
+ * This is called by the sampling backend from interrupt context. If the buffer
+ * is full, the sample is dropped and accounted in @ref profiler_dropped.
+ *
+ * @param[in]   pc      Interrupted program counter
+ * @param[in]   pid     PID of the interrupted thread or @ref PROFILER_PID_ISR
+ */
+void profiler_sample(uintptr_t pc, kernel_pid_t pid);
+
+/**
+ * @brief   Move up to @p max_samples samples out of the sample buffer
+ *
+ * @note    Only one thread at a time may consume samples
+ *
+ * @param[out]  dest        Buffer to write the samples to
+ * @param[in]   max_samples Number of samples that fit into @p dest
+ *
+ * @return  Number of samples written to @p dest
+ */
+size_t profiler_read(profiler_sample_t *dest, size_t max_samples);
+
+/**
+ * @brief   Get the total number of samples taken since the last reset
+ *
+ * @return  Number of samples taken, including the dropped ones
+ */
+uint32_t profiler_total(void);
+
+/**
+ * @brief   Get the number of samples dropped due to a full buffer
+ *
+ * @return  Number of samples dropped since the last reset
+ */
+uint32_t profiler_dropped(void);
+
+/**
+ * @brief   Discard all samples and reset the counters
+ */
+void profiler_reset(void);
+
+/**
+ * @brief   Drain the sample buffer to stdio
+ *
+ * The output is line based and meant to be parsed by
+ * `dist/tools/profiler/profiler.py`:
+ *
+ *     profiler: rate=1000 total=1234 dropped=0
+ *     profiler: thread 1 idle
+ *     profiler: thread 2 main
+ *     profiler: sample 2 0x080004f3
+ *     ...
+ *     profiler: end
+ */
+void profiler_dump(void);
+
+/**
+ * @name    Sampling backend API
+ *
+ * Implemented by the profiler backend of the used architecture.
+ * @{
+ */
+/**
+ * @brief   Start triggering @ref profiler_sample periodically
+ *
+ * @param[in]   rate_hz     Sampling rate in Hz
+ *
+ * @retval  0   Success
+ * @retval  <0  Negative errno on failure
+ */
+int profiler_arch_start(unsigned rate_hz);
+
+/**
+ * @brief   Stop triggering samples
+ */
+void profiler_arch_stop(void);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
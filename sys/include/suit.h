@@ -33,6 +33,9 @@
 #include "cose/sign.h"
 #include "nanocbor/nanocbor.h"
 #include "uuid.h"
+#if defined(MODULE_SUIT_TRANSPORT_PIPELINE) || DOXYGEN
+#  include "hashes/sha256.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -175,6 +178,27 @@ typedef enum {
 } suit_parameter_t;
 /** @} */
 
+/**
+ * @brief SUIT unpack algorithms
+ *
+ * Value of the @ref SUIT_PARAMETER_UNPACK_INFO parameter. RIOT encodes the
+ * parameter as a plain integer instead of a map.
+ */
+typedef enum {
+    SUIT_UNPACK_DELTA = 1,  /**< VCDIFF delta against the running image */
+} suit_unpack_t;
+
+/**
+ * @brief SUIT compression algorithms
+ *
+ * Value of the @ref SUIT_PARAMETER_COMPRESSION_INFO parameter. RIOT encodes
+ * the parameter as a plain integer instead of a map. heatshrink is not
+ * registered and uses a value from the private range.
+ */
+typedef enum {
+    SUIT_COMPRESSION_HEATSHRINK = -1,   /**< heatshrink (LZSS) */
+} suit_compression_t;
+
 /**
  * @brief SUIT parameter reference
  *
@@ -195,6 +219,7 @@ typedef struct {
 #define SUIT_COMPONENT_STATE_VERIFIED      (1 << 2) /**< Component is verified */
 #define SUIT_COMPONENT_STATE_INSTALLED     (1 << 3) /**< Component is installed, but has not been verified */
 #define SUIT_COMPONENT_STATE_FINALIZED     (1 << 4) /**< Component successfully installed */
+#define SUIT_COMPONENT_STATE_DIGESTED      (1 << 5) /**< Payload digest calculated while fetching */
 /** @} */
 
 /**
@@ -223,6 +248,16 @@ typedef struct {
      * @brief Component offset inside the device memory.
      */
     suit_param_ref_t param_component_offset;
+    suit_param_ref_t param_unpack_info;         /**< Payload unpack algorithm */
+    suit_param_ref_t param_compression_info;    /**< Payload compression */
+#if defined(MODULE_SUIT_TRANSPORT_PIPELINE) || DOXYGEN
+    /**
+     * @brief SHA-256 digest of the payload, calculated while fetching
+     *
+     * Only valid if @ref SUIT_COMPONENT_STATE_DIGESTED is set.
+     */
+    uint8_t fetch_digest[SHA256_DIGEST_LENGTH];
+#endif
 } suit_component_t;
 
 /**
@@ -297,6 +332,18 @@ static inline void suit_component_set_flag(suit_component_t *component,
     component->state |= flag;
 }
 
+/**
+ * @brief Clear a component flag
+ *
+ * @param   component   Component to clear flag for
+ * @param   flag        Flag to clear
+ */
+static inline void suit_component_clear_flag(suit_component_t *component,
+                                             uint16_t flag)
+{
+    component->state &= ~flag;
+}
+
 /**
  * @brief Check a component flag
  *
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_suit_transport_decompress SUIT compressed payloads
+ * @ingroup     sys_suit
+ * @brief       Expands compressed SUIT payloads while they are fetched
+ *
+ * A component with the @ref SUIT_PARAMETER_COMPRESSION_INFO parameter set to
+ * @ref SUIT_COMPRESSION_HEATSHRINK is fetched compressed with
+ * @ref pkg_heatshrink. The fetched blocks are expanded while they arrive and
+ * the image is handed to the storage backend (or to
+ * @ref sys_suit_transport_delta, for compressed deltas) block by block, so
+ * the RAM needed does not depend on the size of the image.
+ *
+ * The image size and digest parameters of the component describe the
+ * expanded image. heatshrink streams do not carry their length, so a
+ * truncated payload is caught by the size check of the storage helper once
+ * the last block is expanded.
+ *
+ * The heatshrink decoder is statically configured. The window and lookahead
+ * sizes used to compress the payload have to match
+ * `HEATSHRINK_STATIC_WINDOW_BITS` (8 by default) and
+ * `HEATSHRINK_STATIC_LOOKAHEAD_BITS` (4 by default):
+ *
+ *     heatshrink -e -w 8 -l 4 slot1.bin slot1.bin.hs
+ *
+ * Setting `SUIT_COMPRESS=1` makes `make suit/manifest` do this and reference
+ * the compressed payloads in the manifest.
+ *
+ * @{
+ *
+ * @file
+ * @brief       SUIT compressed payloads
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "heatshrink_decoder.h"
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_suit_transport_decompress_conf SUIT decompression configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Size of the buffer for the expanded data in bytes
+ *
+ * This is the largest block handed to the storage backend.
+ */
+#ifndef CONFIG_SUIT_DECOMPRESS_BUF_SIZE
+#  define CONFIG_SUIT_DECOMPRESS_BUF_SIZE   (64U)
+#endif
+/** @} */
+
+/**
+ * @brief   Decompressor context
+ */
+typedef struct {
+    heatshrink_decoder decoder;     /**< heatshrink decoder */
+    coap_blockwise_cb_t cb;         /**< receives the expanded image */
+    void *arg;                      /**< argument of @p cb */
+    size_t offset;                  /**< bytes of the image handed to @p cb */
+    size_t received;                /**< compressed bytes received */
+    uint8_t buf[CONFIG_SUIT_DECOMPRESS_BUF_SIZE];   /**< expanded data */
+} suit_decompress_t;
+
+/**
+ * @brief   Prepare expanding a payload
+ *
+ * @param[out]  ctx     decompressor context to initialize
+ * @param[in]   cb      called with the expanded image in order, with
+ *                      @p more set to 0 once after the last block
+ * @param[in]   arg     argument passed to @p cb
+ */
+void suit_decompress_init(suit_decompress_t *ctx, coap_blockwise_cb_t cb,
+                          void *arg);
+
+/**
+ * @brief   Expand a block of the payload
+ *
+ * Can be used as @ref coap_blockwise_cb_t, with a @ref suit_decompress_t as
+ * @p arg.
+ *
+ * @param[in]   arg     decompressor context
+ * @param[in]   offset  offset of the block in the compressed payload, unused
+ * @param[in]   buf     block of the compressed payload
+ * @param[in]   len     length of the block
+ * @param[in]   more    0 for the last block of the payload
+ *
+ * @retval  0   on success
+ * @retval  <0  the payload is invalid or @p cb failed
+ */
+int suit_decompress_apply(void *arg, size_t offset, uint8_t *buf, size_t len,
+                          int more);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_suit_transport_delta SUIT delta payloads
+ * @ingroup     sys_suit
+ * @brief       Reconstructs SUIT payloads from VCDIFF deltas
+ *
+ * A component with the @ref SUIT_PARAMETER_UNPACK_INFO parameter set to
+ * @ref SUIT_UNPACK_DELTA is fetched as a VCDIFF delta against the image in
+ * the currently running riotboot slot. The fetched blocks are decoded with
+ * @ref pkg_tinyvcdiff while they arrive, and the reconstructed image is
+ * handed to the storage backend block by block, just like a full payload.
+ *
+ * The image size and digest parameters of the component describe the
+ * reconstructed image, so the usual size check and the image digest
+ * condition cover the result of the delta and not the delta itself.
+ *
+ * Deltas are created with open-vcdiff against the image of the running slot,
+ * including its riotboot header:
+ *
+ *     vcdiff delta -interleaved -dictionary slot0.old.bin <slot1.new.bin >delta
+ *
+ * Setting `SUIT_DELTA_SLOTFILES` to the slot binaries of the running version
+ * makes `make suit/manifest` create these deltas and reference them in the
+ * manifest.
+ *
+ * The SUIT worker only accepts deltas together with `riotboot_slot`, which
+ * @ref sys_suit_storage_flashwrite pulls in.
+ *
+ * @note    The reconstructed image is not read back while decoding, so deltas
+ *          must not copy from the target window. open-vcdiff does not do
+ *          this unless `-target_matches` is given.
+ *
+ * @{
+ *
+ * @file
+ * @brief       SUIT delta payloads
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/nanocoap.h"
+#include "vcdiff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Delta decoder context
+ */
+typedef struct {
+    vcdiff_t vcdiff;                /**< VCDIFF decoder */
+    const uint8_t *source;          /**< source image */
+    size_t source_len;              /**< length of the source image */
+    coap_blockwise_cb_t cb;         /**< receives the reconstructed image */
+    void *arg;                      /**< argument of @p cb */
+    size_t offset;                  /**< bytes of the image handed to @p cb */
+} suit_delta_t;
+
+/**
+ * @brief   Prepare decoding a delta
+ *
+ * @param[out]  delta       decoder context to initialize
+ * @param[in]   source      memory mapped source image, has to stay valid
+ *                          until the delta is decoded
+ * @param[in]   source_len  length of the source image
+ * @param[in]   cb          called with the reconstructed image in order,
+ *                          with @p more set to 0 once after the last block
+ * @param[in]   arg         argument passed to @p cb
+ */
+void suit_delta_init(suit_delta_t *delta, const void *source, size_t source_len,
+                     coap_blockwise_cb_t cb, void *arg);
+
+/**
+ * @brief   Decode a block of the delta
+ *
+ * Can be used as @ref coap_blockwise_cb_t, with a @ref suit_delta_t as
+ * @p arg.
+ *
+ * @param[in]   arg     decoder context
+ * @param[in]   offset  offset of the block in the delta, unused
+ * @param[in]   buf     block of the delta
+ * @param[in]   len     length of the block
+ * @param[in]   more    0 for the last block of the delta
+ *
+ * @retval  0   on success
+ * @retval  <0  the delta is invalid or @p cb failed
+ */
+int suit_delta_apply(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
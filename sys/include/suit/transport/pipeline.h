@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_suit_transport_pipeline SUIT pipelined payload storage
+ * @ingroup     sys_suit
+ * @brief       Overlaps fetching, hashing and writing of SUIT payloads
+ *
+ * Without this module, each block of a payload is written to the storage
+ * backend before the next block is requested, so the flash is idle while
+ * waiting for the network and vice versa. After the fetch, the payload is
+ * read back from storage to calculate its digest.
+ *
+ * With this module, fetched blocks are copied into one of two buffers and
+ * handed to a writer thread, while the worker requests the next block. The
+ * writer thread runs at a lower priority than the worker, so it programs
+ * (and erases) the flash while the worker waits for the network. The SHA-256
+ * digest of the payload is calculated on the fly in the worker, so checking
+ * the image digest does not have to read back the written payload.
+ *
+ * @note    The digest is calculated over the data handed to the storage
+ *          backend, so write errors have to be reported by the storage
+ *          backend.
+ *
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload storage
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hashes/sha256.h"
+#include "suit.h"
+#include "suit/storage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_suit_transport_pipeline_conf SUIT pipeline configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Size of each of the two block buffers in bytes
+ *
+ * Larger blocks are split.
+ */
+#ifndef CONFIG_SUIT_PIPELINE_BUF_SIZE
+#  define CONFIG_SUIT_PIPELINE_BUF_SIZE     (256U)
+#endif
+/** @} */
+
+/**
+ * @brief   Start storing a payload
+ *
+ * The writer thread is created on the first call.
+ *
+ * @param[in]   manifest    manifest the payload belongs to, has to stay valid
+ *                          until @ref suit_pipeline_finish returns
+ * @param[in]   storage     storage backend to write to, has to be started
+ *
+ * @retval  0   on success
+ * @retval  <0  the writer thread could not be created
+ */
+int suit_pipeline_start(const suit_manifest_t *manifest,
+                        suit_storage_t *storage);
+
+/**
+ * @brief   Hand a block of the payload to the writer thread
+ *
+ * Blocks until a buffer is free. Blocks have to be handed in order and
+ * without gaps: @p offset must be the sum of the lengths of all blocks handed
+ * in before. Otherwise, the block is rejected, as the digest would not match
+ * the stored payload, and @ref suit_pipeline_finish fails as well.
+ *
+ * @param[in]   offset  offset of the block in the payload
+ * @param[in]   buf     block data, copied
+ * @param[in]   len     length of the block
+ * @param[in]   more    false for the last block, the storage backend is
+ *                      finished after it was written
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     @p offset does not continue the previous blocks
+ * @retval  <0          error of an earlier write, the fetch should be aborted
+ */
+int suit_pipeline_put(size_t offset, const uint8_t *buf, size_t len, bool more);
+
+/**
+ * @brief   Wait until all blocks are written
+ *
+ * Has to be called after @ref suit_pipeline_start, also if the fetch failed.
+ *
+ * @param[out]  digest  SHA-256 digest of all blocks handed in
+ *
+ * @retval  0           on success
+ * @retval  -EINVAL     a block was rejected by @ref suit_pipeline_put
+ * @retval  <0          error of the storage backend
+ */
+int suit_pipeline_finish(uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
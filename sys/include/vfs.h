@@ -237,6 +237,97 @@ extern "C" {
 #  define VFS_MAX_OPEN_FILES            (16)
 #endif
 
+/**
+ * @brief   Maximum number of mounts in the mount lookup table
+ *
+ * Path lookups search a table of the mount points that is rebuilt on every
+ * mount and unmount, without taking a lock. With more mounts than this,
+ * lookups fall back to walking the list of mounts with the mount lock held.
+ */
+#ifndef CONFIG_VFS_MOUNT_TABLE_NUMOF
+#  define CONFIG_VFS_MOUNT_TABLE_NUMOF  (4)
+#endif
+
+/**
+ * @defgroup    sys_vfs_dentry_cache_conf VFS directory cache configuration
+ * @ingroup     config
+ * @brief       Configuration of the `vfs_dentry_cache` module
+ * @{
+ */
+/**
+ * @brief   Number of directories to remember the mount of
+ */
+#ifndef CONFIG_VFS_DENTRY_CACHE_NUMOF
+#  define CONFIG_VFS_DENTRY_CACHE_NUMOF (4)
+#endif
+
+/**
+ * @brief   Maximum length of a cached directory path, longer ones are not
+ *          cached
+ */
+#ifndef CONFIG_VFS_DENTRY_PATH_MAX
+#  define CONFIG_VFS_DENTRY_PATH_MAX    (32)
+#endif
+/** @} */
+
+/**
+ * @defgroup    sys_vfs_buffered_conf VFS file buffering configuration
+ * @ingroup     config
+ * @brief       Configuration of the `vfs_buffered` module
+ * @{
+ */
+/**
+ * @brief   Number of file descriptors that can be buffered at the same time
+ */
+#ifndef CONFIG_VFS_BUFFER_NUMOF
+#  define CONFIG_VFS_BUFFER_NUMOF       (2)
+#endif
+
+/**
+ * @brief   Size of the buffer of a file descriptor in bytes
+ *
+ * Reads and writes of at least this size bypass the buffer.
+ */
+#ifndef CONFIG_VFS_BUFFER_SIZE
+#  define CONFIG_VFS_BUFFER_SIZE        (256)
+#endif
+/** @} */
+
+/**
+ * @name    VFS specific @ref vfs_fcntl commands
+ * @{
+ */
+/**
+ * @brief   Enable (`arg != 0`) or disable (`arg == 0`) buffering of a file
+ *          descriptor
+ *
+ * Requires the `vfs_buffered` module. Buffers are taken from a pool of
+ * @ref CONFIG_VFS_BUFFER_NUMOF buffers, -ENOMEM is returned if all of them
+ * are in use. A buffer is returned to the pool when buffering is disabled or
+ * the file is closed.
+ *
+ * With buffering enabled, small writes are collected in the buffer and
+ * passed to the file system as a single write once the buffer is full, or
+ * before the file is read, seeked, synced or closed (write-behind). Once
+ * the file is read sequentially, i.e. the same file descriptor is read
+ * again without seeking in between, small reads are served from the buffer,
+ * which is filled with a single read of @ref CONFIG_VFS_BUFFER_SIZE bytes
+ * (read-ahead).
+ *
+ * @warning Other file descriptors of the same file may not see data still in
+ *          the write buffer. A write error of buffered data is reported by the
+ *          call that writes the buffer back, e.g. @ref vfs_fsync.
+ */
+#define VFS_F_SETBUF    (0x100)
+
+/**
+ * @brief   Query whether a file descriptor is buffered
+ *
+ * Returns 1 if buffering is enabled, 0 otherwise.
+ */
+#define VFS_F_GETBUF    (0x101)
+/** @} */
+
 /**
  * @brief Size of buffer space in vfs_DIR
  *
@@ -416,6 +507,9 @@ typedef struct {
     int flags;                  /**< File flags */
     off_t pos;                  /**< Current position in the file */
     kernel_pid_t pid;           /**< PID of the process that opened the file */
+#if defined(MODULE_VFS_BUFFERED) || DOXYGEN
+    struct vfs_buffer *buffer;  /**< read/write buffer, see @ref VFS_F_SETBUF */
+#endif
     union {
         void *ptr;              /**< pointer to private data */
         int value;              /**< alternatively, you can use private_data as an int */
@@ -587,6 +681,23 @@ struct vfs_file_ops {
      * @retval <0 on error
      */
     int (*fsync) (vfs_file_t *filp);
+
+    /**
+     * @brief Reference bytes of an open file without copying them
+     *
+     * This is optional, it only makes sense for file systems that keep the
+     * file contents in memory mapped storage. The file position is advanced
+     * as if the data was read.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] data     pointer to the file contents at the current position,
+     *                      it has to stay valid while the file system is mounted
+     * @param[in]  nbytes   maximum number of bytes to reference
+     *
+     * @return number of bytes at @p data on success
+     * @retval <0 on error
+     */
+    ssize_t (*map) (vfs_file_t *filp, const void **data, size_t nbytes);
 };
 
 /**
@@ -758,6 +869,21 @@ struct vfs_file_system_ops {
      * @retval <0 on error
      */
     int (*statvfs) (vfs_mount_t *mountp, const char *restrict path, struct statvfs *restrict buf);
+
+    /**
+     * @brief Do deferred maintenance work
+     *
+     * Lets the file system do work ahead of time that it would otherwise do
+     * while writing, such as garbage collection or erasing unused blocks. An
+     * implementation should only do a bounded amount of work per call.
+     *
+     * @param[in]  mountp  file system mount to operate on
+     *
+     * @retval 0 on success, nothing left to do
+     * @retval 1 on success, more work is pending
+     * @retval <0 on error
+     */
+    int (*maintain) (vfs_mount_t *mountp);
 };
 
 /**
@@ -870,6 +996,31 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Read bytes from an open file into an iolist snip
+ *
+ * If the file system can reference the file contents in place (see
+ * @ref vfs_file_ops::map, e.g. @ref sys_fs_constfs), @p snip is pointed to
+ * them and nothing is copied. Otherwise the data is read into @p buf and
+ * @p snip is pointed to @p buf. Callers can tell the cases apart by comparing
+ * @ref iolist_t::iol_base to @p buf.
+ *
+ * This allows sending file contents with e.g. @ref sock_udp_sendv without
+ * copying them into an intermediate buffer first.
+ *
+ * @ref iolist_t::iol_next of @p snip is not touched.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] snip     snip to point to the file contents
+ * @param[out] buf      buffer to hold the file contents if they can not be
+ *                      referenced, must be at least @p count bytes long
+ * @param[in]  count    maximum number of bytes to read
+ *
+ * @return number of bytes read on success
+ * @retval <0 on error
+ */
+ssize_t vfs_read_iolist(int fd, iolist_t *snip, void *buf, size_t count);
+
 /**
  * @brief Read a line from an open text file
  *
@@ -1123,6 +1274,25 @@ int vfs_stat(const char *restrict path, struct stat *restrict buf);
  */
 int vfs_statvfs(const char *restrict path, struct statvfs *restrict buf);
 
+/**
+ * @brief Do deferred maintenance work of a file system
+ *
+ * Meant to be called when the system is idle, so that writes later on do not
+ * have to wait for garbage collection or block erasure. Call it again as long
+ * as it returns 1.
+ *
+ * @p path can be any path that resolves to the file system, it does not have
+ * to be an existing file.
+ *
+ * @param[in]  path    path to a file on the file system
+ *
+ * @retval 0 on success, nothing left to do
+ * @retval 1 on success, more work is pending
+ * @retval -ENOTSUP the file system has no maintenance to do
+ * @retval <0 on error
+ */
+int vfs_maintain(const char *path);
+
 /**
  * @brief Allocate a new file descriptor and give it file operations
  *
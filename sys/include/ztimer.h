@@ -250,6 +250,24 @@
  * 5. Due to +-1 systemic inaccuracies, it is advisable to use ZTIMER_MSEC for
  *    second timers up to 49 days (instead of ZTIMER_SEC).
  *
+ *
+ * ## Timer slack
+ *
+ * Periodic background activities (neighbor discovery, RPL trickle timers,
+ * sensor polling, ...) tend to wake the CPU at slightly different instants,
+ * although most of them do not care about a few milliseconds. With module
+ * `ztimer_slack`, a timer can be set via @ref ztimer_set_with_slack with a
+ * number of ticks it may fire late. It is then scheduled to expire together
+ * with the first timer already pending on the same clock within that window,
+ * so both are handled in a single wakeup. All other ways of setting a timer
+ * (@ref ztimer_set and everything built on top of it) keep the exact behavior.
+ * @ref sys_trickle uses it to let its transmissions slip within the current
+ * interval.
+ *
+ * Timers are only coalesced with timers on the same clock. Note that all
+ * timers on a converted clock (e.g. ZTIMER_MSEC on top of an RTT) share a
+ * single entry on the underlying clock.
+ *
  * @{
  *
  * @file
@@ -457,6 +475,45 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Set a timer on a clock, allowing it to fire up to @p slack ticks
+ *          late
+ *
+ * If another timer on @p clock is already due within
+ * `[now() + @p val, now() + @p val + @p slack]`, @p timer is scheduled to
+ * expire together with it, so that both are handled in a single wakeup.
+ * Otherwise, @p timer expires at `now() + @p val` as with @ref ztimer_set.
+ *
+ * The slack only applies to this call. Setting @p timer again via
+ * @ref ztimer_set (e.g. by @ref ztimer_periodic_t) schedules it exactly.
+ *
+ * @note    Only available with module `ztimer_slack`
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       ticks the timer may fire late
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack);
+#endif
+
+/**
+ * @brief   Get the number of ticks until the next timer on a clock expires
+ *
+ * This is used e.g. by the idle path of @ref sys_pm_layered to decide whether
+ * entering a deep power mode pays off.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ *
+ * @return  ticks until the next timer on @p clock expires, 0 if it is overdue
+ * @return  UINT32_MAX if no timer is set on @p clock
+ */
+uint32_t ztimer_time_to_next(ztimer_clock_t *clock);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -505,6 +562,28 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer);
 void ztimer_set_msg(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
                     msg_t *msg, kernel_pid_t target_pid);
 
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+/**
+ * @brief   Post a message after a delay, allowing it to be sent up to
+ *          @p slack ticks late
+ *
+ * Like @ref ztimer_set_msg, but the timer is set via
+ * @ref ztimer_set_with_slack.
+ *
+ * @note    Only available with module `ztimer_slack`
+ *
+ * @param[in]   clock           ztimer clock to operate on
+ * @param[in]   timer           ztimer timer struct to use
+ * @param[in]   offset          ticks from now
+ * @param[in]   slack           ticks the message may be sent late
+ * @param[in]   msg             pointer to msg that will be sent
+ * @param[in]   target_pid      pid the message will be sent to
+ */
+void ztimer_set_msg_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t offset, uint32_t slack, msg_t *msg,
+                               kernel_pid_t target_pid);
+#endif
+
 /**
  * @brief receive a message (blocking, with timeout)
  *
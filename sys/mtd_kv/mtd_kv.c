@@ -0,0 +1,844 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_mtd_kv
+ * @{
+ *
+ * @file
+ * @brief       Log-structured key/value store on MTD
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "hashes.h"
+#include "macros/utils.h"
+#include "mtd_kv.h"
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+#include "container.h"
+#include "event/thread.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SEC_MAGIC           "MKV1"
+#define SEC_HDR_LEN         (8U)    /**< magic, sequence number */
+#define REC_HDR_LEN         (6U)    /**< key len, flags, value len, CRC */
+
+#define REC_FLAG_VALUE      (0x00U)
+#define REC_FLAG_DELETED    (0x01U)
+
+#define TAG_DELETED         (0x8000U)
+#define TAG_MASK            (0x7fffU)
+#define ADDR_NONE           (UINT32_MAX)
+#define SECTOR_NONE         (UINT8_MAX)
+
+#define INDEX_MASK          (CONFIG_MTD_KV_INDEX_SIZE - 1)
+
+enum {
+    SECTOR_FREE,            /**< not in use, may have to be erased */
+    SECTOR_CLOSED,          /**< holds records, no more writes */
+    SECTOR_ACTIVE,          /**< records are appended here */
+};
+
+static_assert((CONFIG_MTD_KV_INDEX_SIZE & INDEX_MASK) == 0,
+              "CONFIG_MTD_KV_INDEX_SIZE must be a power of two");
+static_assert(CONFIG_MTD_KV_INDEX_SIZE <= TAG_MASK + 1,
+              "CONFIG_MTD_KV_INDEX_SIZE too large");
+static_assert(CONFIG_MTD_KV_SECTORS_MAX < SECTOR_NONE,
+              "CONFIG_MTD_KV_SECTORS_MAX too large");
+static_assert(CONFIG_MTD_KV_KEY_LEN_MAX < UINT8_MAX,
+              "CONFIG_MTD_KV_KEY_LEN_MAX too large");
+static_assert(CONFIG_MTD_KV_BUF_SIZE >= SEC_HDR_LEN,
+              "CONFIG_MTD_KV_BUF_SIZE too small");
+
+typedef struct {
+    uint8_t key_len;
+    uint8_t flags;
+    uint16_t value_len;
+} _rec_t;
+
+typedef struct {
+    uint32_t addr;
+    size_t fill;
+} _writer_t;
+
+static int _compact(mtd_kv_t *kv);
+
+static uint32_t _align(const mtd_kv_t *kv, uint32_t len)
+{
+    uint32_t write_size = kv->mtd->write_size ? kv->mtd->write_size : 1;
+
+    return (len + write_size - 1) / write_size * write_size;
+}
+
+static uint32_t _sec_start(const mtd_kv_t *kv, unsigned sector)
+{
+    return sector * kv->sector_size;
+}
+
+static uint32_t _sec_end(const mtd_kv_t *kv, unsigned sector)
+{
+    return _sec_start(kv, sector) + kv->sector_size;
+}
+
+static uint32_t _data_start(const mtd_kv_t *kv, unsigned sector)
+{
+    return _sec_start(kv, sector) + _align(kv, SEC_HDR_LEN);
+}
+
+static uint32_t _capacity(const mtd_kv_t *kv)
+{
+    return kv->sector_size - _align(kv, SEC_HDR_LEN);
+}
+
+static unsigned _sec_of(const mtd_kv_t *kv, uint32_t addr)
+{
+    return addr / kv->sector_size;
+}
+
+static uint32_t _rec_size(const mtd_kv_t *kv, const _rec_t *rec)
+{
+    return _align(kv, REC_HDR_LEN + rec->key_len + rec->value_len);
+}
+
+static int _read(mtd_kv_t *kv, uint32_t addr, void *dest, uint32_t len)
+{
+    int res = mtd_read(kv->mtd, dest, addr, len);
+
+    return (res < 0) ? res : 0;
+}
+
+static int _write(mtd_kv_t *kv, uint32_t addr, const void *src, uint32_t len)
+{
+    int res = mtd_write_page_raw(kv->mtd, src, 0, addr, len);
+
+    return (res < 0) ? res : 0;
+}
+
+static void _rec_decode(const uint8_t *hdr, _rec_t *rec)
+{
+    rec->key_len = hdr[0];
+    rec->flags = hdr[1];
+    rec->value_len = hdr[2] | (hdr[3] << 8);
+}
+
+static uint16_t _rec_crc(const uint8_t *hdr, const void *key, const void *value,
+                         size_t value_len)
+{
+    uint16_t crc = crc16_ccitt_false_update(0xffff, hdr, 4);
+
+    crc = crc16_ccitt_false_update(crc, key, hdr[0]);
+    return crc16_ccitt_false_update(crc, value, value_len);
+}
+
+static uint32_t _hash(const char *key, size_t key_len)
+{
+    return fnv_hash((const uint8_t *)key, key_len);
+}
+
+/* reads and checks the record at addr, returns its size, 0 at the end of the
+ * log and -EBADMSG for a damaged record */
+static int _rec_read(mtd_kv_t *kv, uint32_t addr, uint32_t end, _rec_t *rec,
+                     char *key)
+{
+    uint8_t hdr[REC_HDR_LEN];
+    uint8_t chunk[16];
+
+    if (end - addr < REC_HDR_LEN) {
+        return 0;
+    }
+    int res = _read(kv, addr, hdr, sizeof(hdr));
+    if (res < 0) {
+        return res;
+    }
+
+    static const uint8_t erased[REC_HDR_LEN] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+    if (memcmp(hdr, erased, sizeof(hdr)) == 0) {
+        return 0;
+    }
+
+    _rec_decode(hdr, rec);
+    if ((rec->key_len == 0) || (rec->key_len > CONFIG_MTD_KV_KEY_LEN_MAX) ||
+            (rec->flags > REC_FLAG_DELETED) ||
+            (_rec_size(kv, rec) > end - addr)) {
+        return -EBADMSG;
+    }
+
+    res = _read(kv, addr + REC_HDR_LEN, key, rec->key_len);
+    if (res < 0) {
+        return res;
+    }
+    uint16_t crc = _rec_crc(hdr, key, NULL, 0);
+
+    uint32_t pos = addr + REC_HDR_LEN + rec->key_len;
+    for (size_t left = rec->value_len; left;) {
+        size_t n = MIN(left, sizeof(chunk));
+        res = _read(kv, pos, chunk, n);
+        if (res < 0) {
+            return res;
+        }
+        crc = crc16_ccitt_false_update(crc, chunk, n);
+        pos += n;
+        left -= n;
+    }
+
+    if (crc != (hdr[4] | (hdr[5] << 8))) {
+        DEBUG("mtd_kv: bad CRC at 0x%" PRIx32 "\n", addr);
+        return -EBADMSG;
+    }
+    return _rec_size(kv, rec);
+}
+
+static int _key_equals(mtd_kv_t *kv, uint32_t addr, const char *key,
+                       uint8_t key_len)
+{
+    uint8_t buf[REC_HDR_LEN + CONFIG_MTD_KV_KEY_LEN_MAX];
+
+    int res = _read(kv, addr, buf, REC_HDR_LEN + key_len);
+    if (res < 0) {
+        return res;
+    }
+    return (buf[0] == key_len) &&
+           (memcmp(&buf[REC_HDR_LEN], key, key_len) == 0);
+}
+
+/* returns the slot of key or -ENOENT, empty is set to the slot a new entry
+ * for the key would go to */
+static int _index_find(mtd_kv_t *kv, const char *key, uint8_t key_len,
+                       uint32_t hash, unsigned *empty)
+{
+    uint16_t tag = hash & TAG_MASK;
+
+    for (unsigned i = tag & INDEX_MASK, n = 0; n < CONFIG_MTD_KV_INDEX_SIZE;
+         i = (i + 1) & INDEX_MASK, n++) {
+        mtd_kv_index_t *entry = &kv->index[i];
+
+        if (entry->addr == ADDR_NONE) {
+            if (empty) {
+                *empty = i;
+            }
+            return -ENOENT;
+        }
+        if ((entry->tag & TAG_MASK) != tag) {
+            continue;
+        }
+        int res = _key_equals(kv, entry->addr, key, key_len);
+        if (res < 0) {
+            return res;
+        }
+        if (res) {
+            return i;
+        }
+    }
+    /* not reached, one entry is always left free */
+    return -ENOENT;
+}
+
+static void _index_remove(mtd_kv_t *kv, unsigned i)
+{
+    /* backward shift deletion keeps the probe sequences intact */
+    for (unsigned j = (i + 1) & INDEX_MASK; kv->index[j].addr != ADDR_NONE;
+         j = (j + 1) & INDEX_MASK) {
+        unsigned home = kv->index[j].tag & INDEX_MASK;
+        if (((j - home) & INDEX_MASK) >= ((j - i) & INDEX_MASK)) {
+            kv->index[i] = kv->index[j];
+            i = j;
+        }
+    }
+    kv->index[i].addr = ADDR_NONE;
+    kv->keys--;
+}
+
+/* points the index to a newly written record */
+static int _index_update(mtd_kv_t *kv, const char *key, const _rec_t *rec,
+                         uint32_t addr)
+{
+    uint32_t hash = _hash(key, rec->key_len);
+    uint16_t tag = (hash & TAG_MASK) |
+                   ((rec->flags == REC_FLAG_DELETED) ? TAG_DELETED : 0);
+    unsigned empty = 0;
+
+    int slot = _index_find(kv, key, rec->key_len, hash, &empty);
+    if (slot >= 0) {
+        mtd_kv_index_t *entry = &kv->index[slot];
+        uint8_t hdr[REC_HDR_LEN];
+        _rec_t old;
+
+        int res = _read(kv, entry->addr, hdr, sizeof(hdr));
+        if (res < 0) {
+            return res;
+        }
+        _rec_decode(hdr, &old);
+        kv->sector[_sec_of(kv, entry->addr)].live -= _rec_size(kv, &old);
+        entry->addr = addr;
+        entry->tag = tag;
+    }
+    else if (slot != -ENOENT) {
+        return slot;
+    }
+    else if (rec->flags == REC_FLAG_DELETED) {
+        /* nothing older to hide, the record is stale right away */
+        return 0;
+    }
+    else if (kv->keys >= CONFIG_MTD_KV_INDEX_SIZE - 1) {
+        return -ENOMEM;
+    }
+    else {
+        kv->index[empty].addr = addr;
+        kv->index[empty].tag = tag;
+        kv->keys++;
+    }
+    kv->sector[_sec_of(kv, addr)].live += _rec_size(kv, rec);
+    return 0;
+}
+
+static int _put(mtd_kv_t *kv, _writer_t *w, const void *data, size_t len)
+{
+    const uint8_t *pos = data;
+
+    while (len) {
+        size_t n = MIN(len, sizeof(kv->buf) - w->fill);
+        memcpy(&kv->buf[w->fill], pos, n);
+        w->fill += n;
+        pos += n;
+        len -= n;
+        if (w->fill == sizeof(kv->buf)) {
+            int res = _write(kv, w->addr, kv->buf, sizeof(kv->buf));
+            if (res < 0) {
+                return res;
+            }
+            w->addr += sizeof(kv->buf);
+            w->fill = 0;
+        }
+    }
+    return 0;
+}
+
+static int _flush(mtd_kv_t *kv, _writer_t *w)
+{
+    if (w->fill == 0) {
+        return 0;
+    }
+    size_t len = _align(kv, w->fill);
+    memset(&kv->buf[w->fill], 0xff, len - w->fill);
+    return _write(kv, w->addr, kv->buf, len);
+}
+
+static int _erased(mtd_kv_t *kv, uint32_t addr, uint32_t end)
+{
+    while (addr < end) {
+        size_t n = MIN(end - addr, sizeof(kv->buf));
+        int res = _read(kv, addr, kv->buf, n);
+        if (res < 0) {
+            return res;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (kv->buf[i] != 0xff) {
+                return 0;
+            }
+        }
+        addr += n;
+    }
+    return 1;
+}
+
+static unsigned _free_count(const mtd_kv_t *kv)
+{
+    unsigned count = 0;
+
+    for (unsigned s = 0; s < kv->sectors; s++) {
+        count += (kv->sector[s].state == SECTOR_FREE);
+    }
+    return count;
+}
+
+static void _close_active(mtd_kv_t *kv)
+{
+    if (kv->active != SECTOR_NONE) {
+        kv->sector[kv->active].state = SECTOR_CLOSED;
+        kv->active = SECTOR_NONE;
+    }
+}
+
+static int _open_sector(mtd_kv_t *kv)
+{
+    unsigned s = 0;
+
+    while (kv->sector[s].state != SECTOR_FREE) {
+        if (++s == kv->sectors) {
+            return -ENOSPC;
+        }
+    }
+
+    int res = mtd_erase_sector(kv->mtd, s, 1);
+    if (res < 0) {
+        return res;
+    }
+
+    uint32_t seq = kv->seq + 1;
+    size_t len = _align(kv, SEC_HDR_LEN);
+    memset(kv->buf, 0xff, len);
+    memcpy(kv->buf, SEC_MAGIC, 4);
+    kv->buf[4] = seq;
+    kv->buf[5] = seq >> 8;
+    kv->buf[6] = seq >> 16;
+    kv->buf[7] = seq >> 24;
+    res = _write(kv, _sec_start(kv, s), kv->buf, len);
+    if (res < 0) {
+        return res;
+    }
+
+    DEBUG("mtd_kv: sector %u opened, seq %" PRIu32 "\n", s, seq);
+    _close_active(kv);
+    kv->seq = seq;
+    kv->sector[s].seq = seq;
+    kv->sector[s].live = 0;
+    kv->sector[s].state = SECTOR_ACTIVE;
+    kv->active = s;
+    kv->pos = _data_start(kv, s);
+    return 0;
+}
+
+/* finds room for size bytes in the active sector. Compaction may not start
+ * another compaction and may use the last free sector. */
+static int _alloc(mtd_kv_t *kv, uint32_t size, bool compaction, uint32_t *addr)
+{
+    unsigned attempts = kv->sectors;
+
+    for (;;) {
+        if ((kv->active != SECTOR_NONE) &&
+                (size <= _sec_end(kv, kv->active) - kv->pos)) {
+            *addr = kv->pos;
+            return 0;
+        }
+        /* the record does not fit, the rest of the sector stays unused */
+        _close_active(kv);
+
+        if (!compaction && (_free_count(kv) <= 1)) {
+            /* keep the last free sector for compaction */
+            int res = attempts-- ? _compact(kv) : 0;
+            if (res <= 0) {
+                return res ? res : -ENOSPC;
+            }
+            continue;
+        }
+
+        int res = _open_sector(kv);
+        if (res < 0) {
+            return res;
+        }
+    }
+}
+
+static int _copy(mtd_kv_t *kv, uint32_t from, uint32_t to, uint32_t len)
+{
+    while (len) {
+        uint32_t n = MIN(len, sizeof(kv->buf));
+        int res = _read(kv, from, kv->buf, n);
+        if (res < 0) {
+            return res;
+        }
+        res = _write(kv, to, kv->buf, n);
+        if (res < 0) {
+            return res;
+        }
+        from += n;
+        to += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int _pick_victim(const mtd_kv_t *kv)
+{
+    int victim = -1;
+    uint32_t live = _capacity(kv);
+
+    for (unsigned s = 0; s < kv->sectors; s++) {
+        if ((kv->sector[s].state == SECTOR_CLOSED) && (kv->sector[s].live < live)) {
+            victim = s;
+            live = kv->sector[s].live;
+        }
+    }
+    return victim;
+}
+
+static int _compact(mtd_kv_t *kv)
+{
+    int victim = _pick_victim(kv);
+    if (victim < 0) {
+        return 0;
+    }
+
+    /* deletions can only be forgotten if no older sector could still hold a
+     * value of the key */
+    bool oldest = true;
+    for (unsigned s = 0; s < kv->sectors; s++) {
+        if ((kv->sector[s].state != SECTOR_FREE) &&
+                (kv->sector[s].seq < kv->sector[victim].seq)) {
+            oldest = false;
+        }
+    }
+
+    DEBUG("mtd_kv: compacting sector %d, %" PRIu32 " bytes live\n",
+          victim, kv->sector[victim].live);
+
+    uint32_t addr = _data_start(kv, victim);
+    uint32_t end = _sec_end(kv, victim);
+    char key[CONFIG_MTD_KV_KEY_LEN_MAX];
+
+    while (addr < end) {
+        _rec_t rec;
+        int size = _rec_read(kv, addr, end, &rec, key);
+        if (size == 0 || size == -EBADMSG) {
+            /* the rest of the sector is unused */
+            break;
+        }
+        if (size < 0) {
+            return size;
+        }
+
+        int slot = _index_find(kv, key, rec.key_len, _hash(key, rec.key_len),
+                               NULL);
+        if ((slot == -ENOENT) || ((slot >= 0) && (kv->index[slot].addr != addr))) {
+            /* stale record */
+            addr += size;
+            continue;
+        }
+        if (slot < 0) {
+            return slot;
+        }
+
+        kv->sector[victim].live -= size;
+        if ((rec.flags == REC_FLAG_DELETED) && oldest) {
+            _index_remove(kv, slot);
+            addr += size;
+            continue;
+        }
+
+        uint32_t to;
+        int res = _alloc(kv, size, true, &to);
+        if (res == 0) {
+            res = _copy(kv, addr, to, size);
+        }
+        if (res < 0) {
+            kv->sector[victim].live += size;
+            return res;
+        }
+        kv->pos += size;
+        kv->sector[_sec_of(kv, to)].live += size;
+        kv->index[slot].addr = to;
+        addr += size;
+    }
+
+    int res = mtd_erase_sector(kv->mtd, victim, 1);
+    if (res < 0) {
+        return res;
+    }
+    kv->sector[victim].state = SECTOR_FREE;
+    kv->sector[victim].live = 0;
+    return 1;
+}
+
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+static bool _gc_wanted(const mtd_kv_t *kv)
+{
+    unsigned free = _free_count(kv);
+
+    if ((free == 0) || (free > CONFIG_MTD_KV_GC_FREE_SECTORS)) {
+        return false;
+    }
+    /* only worth it if at least half a sector is gained */
+    int victim = _pick_victim(kv);
+    return (victim >= 0) && (kv->sector[victim].live <= _capacity(kv) / 2);
+}
+
+static void _gc_handler(event_t *event)
+{
+    mtd_kv_t *kv = container_of(event, mtd_kv_t, gc_event);
+
+    mutex_lock(&kv->lock);
+    if (_gc_wanted(kv)) {
+        _compact(kv);
+    }
+    bool again = _gc_wanted(kv);
+    mutex_unlock(&kv->lock);
+
+    if (again) {
+        event_post(EVENT_PRIO_LOWEST, event);
+    }
+}
+#endif
+
+static void _gc_schedule(mtd_kv_t *kv)
+{
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+    if (_gc_wanted(kv)) {
+        event_post(EVENT_PRIO_LOWEST, &kv->gc_event);
+    }
+#else
+    (void)kv;
+#endif
+}
+
+static int _write_record(mtd_kv_t *kv, const char *key, const _rec_t *rec,
+                         const void *value)
+{
+    uint32_t size = _rec_size(kv, rec);
+    uint8_t hdr[REC_HDR_LEN];
+
+    if (size > _capacity(kv)) {
+        return -EFBIG;
+    }
+
+    uint32_t addr;
+    int res = _alloc(kv, size, false, &addr);
+    if (res < 0) {
+        return res;
+    }
+
+    hdr[0] = rec->key_len;
+    hdr[1] = rec->flags;
+    hdr[2] = rec->value_len;
+    hdr[3] = rec->value_len >> 8;
+    uint16_t crc = _rec_crc(hdr, key, value, rec->value_len);
+    hdr[4] = crc;
+    hdr[5] = crc >> 8;
+
+    _writer_t w = { .addr = addr };
+    if (((res = _put(kv, &w, hdr, sizeof(hdr))) < 0) ||
+            ((res = _put(kv, &w, key, rec->key_len)) < 0) ||
+            ((res = _put(kv, &w, value, rec->value_len)) < 0) ||
+            ((res = _flush(kv, &w)) < 0)) {
+        /* the damaged record must not be written over */
+        _close_active(kv);
+        return res;
+    }
+    kv->pos += size;
+
+    return _index_update(kv, key, rec, addr);
+}
+
+static int _mount(mtd_kv_t *kv)
+{
+    uint8_t order[CONFIG_MTD_KV_SECTORS_MAX];
+    unsigned used = 0;
+
+    for (unsigned s = 0; s < kv->sectors; s++) {
+        uint8_t hdr[SEC_HDR_LEN];
+        int res = _read(kv, _sec_start(kv, s), hdr, sizeof(hdr));
+        if (res < 0) {
+            return res;
+        }
+        if (memcmp(hdr, SEC_MAGIC, 4) != 0) {
+            continue;
+        }
+        kv->sector[s].seq = hdr[4] | (hdr[5] << 8) | ((uint32_t)hdr[6] << 16) |
+                            ((uint32_t)hdr[7] << 24);
+        kv->sector[s].state = SECTOR_CLOSED;
+
+        /* replay the sectors from the oldest to the newest */
+        unsigned i = used++;
+        for (; i && kv->sector[order[i - 1]].seq > kv->sector[s].seq; i--) {
+            order[i] = order[i - 1];
+        }
+        order[i] = s;
+    }
+
+    for (unsigned i = 0; i < used; i++) {
+        unsigned s = order[i];
+        uint32_t addr = _data_start(kv, s);
+        uint32_t end = _sec_end(kv, s);
+        char key[CONFIG_MTD_KV_KEY_LEN_MAX];
+        int size;
+        _rec_t rec;
+
+        while ((size = _rec_read(kv, addr, end, &rec, key)) > 0) {
+            int res = _index_update(kv, key, &rec, addr);
+            if (res < 0) {
+                return res;
+            }
+            addr += size;
+        }
+        if ((size < 0) && (size != -EBADMSG)) {
+            return size;
+        }
+
+        kv->seq = kv->sector[s].seq;
+        if ((i == used - 1) && (size == 0) && (_erased(kv, addr, end) == 1)) {
+            /* continue writing after the last intact record */
+            kv->sector[s].state = SECTOR_ACTIVE;
+            kv->active = s;
+            kv->pos = addr;
+        }
+    }
+
+    DEBUG("mtd_kv: %u keys in %u sectors\n", kv->keys, used);
+    return 0;
+}
+
+static void _reset(mtd_kv_t *kv)
+{
+    memset(kv->sector, 0, sizeof(kv->sector));
+    for (unsigned i = 0; i < CONFIG_MTD_KV_INDEX_SIZE; i++) {
+        kv->index[i].addr = ADDR_NONE;
+    }
+    kv->keys = 0;
+    kv->seq = 0;
+    kv->active = SECTOR_NONE;
+}
+
+int mtd_kv_init(mtd_kv_t *kv, mtd_dev_t *mtd)
+{
+    uint32_t write_size = mtd->write_size ? mtd->write_size : 1;
+
+    memset(kv, 0, sizeof(*kv));
+    mutex_init(&kv->lock);
+    kv->mtd = mtd;
+    kv->sector_size = mtd->pages_per_sector * mtd->page_size;
+    kv->sectors = MIN(mtd->sector_count, CONFIG_MTD_KV_SECTORS_MAX);
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+    kv->gc_event.handler = _gc_handler;
+#endif
+    _reset(kv);
+
+    if ((kv->sectors < 2) || (write_size > sizeof(kv->buf)) ||
+            (sizeof(kv->buf) % write_size)) {
+        return -EINVAL;
+    }
+
+    return _mount(kv);
+}
+
+int mtd_kv_format(mtd_kv_t *kv)
+{
+    mutex_lock(&kv->lock);
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+    event_cancel(EVENT_PRIO_LOWEST, &kv->gc_event);
+#endif
+    _reset(kv);
+    int res = mtd_erase_sector(kv->mtd, 0, kv->sectors);
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
+
+ssize_t mtd_kv_get(mtd_kv_t *kv, const char *key, void *value, size_t len)
+{
+    size_t key_len = strlen(key);
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KV_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    mutex_lock(&kv->lock);
+    ssize_t res = _index_find(kv, key, key_len, _hash(key, key_len), NULL);
+    if ((res >= 0) && (kv->index[res].tag & TAG_DELETED)) {
+        res = -ENOENT;
+    }
+    if (res >= 0) {
+        uint32_t addr = kv->index[res].addr;
+        uint8_t hdr[REC_HDR_LEN];
+        _rec_t rec;
+
+        /* errors of the MTD device are returned as they are */
+        res = _read(kv, addr, hdr, sizeof(hdr));
+        if (res == 0) {
+            _rec_decode(hdr, &rec);
+            if (value == NULL) {
+                res = rec.value_len;
+            }
+            else if (len < rec.value_len) {
+                res = -ENOBUFS;
+            }
+            else {
+                res = _read(kv, addr + REC_HDR_LEN + key_len, value,
+                            rec.value_len);
+                if (res == 0) {
+                    res = rec.value_len;
+                }
+            }
+        }
+    }
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
+
+int mtd_kv_set(mtd_kv_t *kv, const char *key, const void *value, size_t len)
+{
+    size_t key_len = strlen(key);
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KV_KEY_LEN_MAX)) {
+        return -EINVAL;
+    }
+    if (len > UINT16_MAX) {
+        return -EFBIG;
+    }
+
+    _rec_t rec = {
+        .key_len = key_len,
+        .flags = REC_FLAG_VALUE,
+        .value_len = len,
+    };
+
+    mutex_lock(&kv->lock);
+    int res = _index_find(kv, key, key_len, _hash(key, key_len), NULL);
+    if ((res == -ENOENT) && (kv->keys >= CONFIG_MTD_KV_INDEX_SIZE - 1)) {
+        res = -ENOMEM;
+    }
+    else if ((res >= 0) || (res == -ENOENT)) {
+        res = _write_record(kv, key, &rec, value);
+        _gc_schedule(kv);
+    }
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
+
+int mtd_kv_delete(mtd_kv_t *kv, const char *key)
+{
+    size_t key_len = strlen(key);
+
+    if ((key_len == 0) || (key_len > CONFIG_MTD_KV_KEY_LEN_MAX)) {
+        return -ENOENT;
+    }
+
+    _rec_t rec = {
+        .key_len = key_len,
+        .flags = REC_FLAG_DELETED,
+        .value_len = 0,
+    };
+
+    mutex_lock(&kv->lock);
+    int res = _index_find(kv, key, key_len, _hash(key, key_len), NULL);
+    if ((res >= 0) && (kv->index[res].tag & TAG_DELETED)) {
+        res = -ENOENT;
+    }
+    if (res >= 0) {
+        res = _write_record(kv, key, &rec, NULL);
+        _gc_schedule(kv);
+    }
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
+
+int mtd_kv_compact(mtd_kv_t *kv)
+{
+    mutex_lock(&kv->lock);
+    int res = _compact(kv);
+    mutex_unlock(&kv->lock);
+
+    return res;
+}
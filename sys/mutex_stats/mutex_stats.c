@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_mutex_stats
+ * @{
+ *
+ * @file
+ * @brief       Mutex contention statistics implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex_stats.h"
+#include "ztimer.h"
+
+static mutex_stats_t _stats[CONFIG_MUTEX_STATS_NUMOF];
+static uint32_t _untracked;
+static bool _running;
+
+/**
+ * @brief   Look up the entry of @p mutex
+ * @pre     IRQs are disabled
+ *
+ * @param[in]   mutex   mutex to look up
+ * @param[in]   add     whether to add @p mutex if it is not yet tracked
+ */
+static mutex_stats_t *_find(const mutex_t *mutex, bool add)
+{
+    mutex_stats_t *free = NULL;
+
+    for (unsigned i = 0; i < CONFIG_MUTEX_STATS_NUMOF; i++) {
+        if (_stats[i].mutex == mutex) {
+            return &_stats[i];
+        }
+        if ((free == NULL) && (_stats[i].mutex == NULL)) {
+            free = &_stats[i];
+        }
+    }
+
+    if (!add) {
+        return NULL;
+    }
+    if (free == NULL) {
+        _untracked++;
+        return NULL;
+    }
+
+    free->mutex = mutex;
+    return free;
+}
+
+static void _acquired(const mutex_t *mutex, uint32_t now, uint32_t waited,
+                      bool contended)
+{
+    unsigned irq_state = irq_disable();
+    mutex_stats_t *entry = _find(mutex, true);
+
+    if (entry != NULL) {
+        entry->acquisitions++;
+        if (contended) {
+            entry->contended++;
+            entry->wait_total += waited;
+            if (waited > entry->wait_max) {
+                entry->wait_max = waited;
+            }
+        }
+        entry->locked_since = now;
+        entry->locked = true;
+    }
+
+    irq_restore(irq_state);
+}
+
+void mutex_stats_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    _running = true;
+}
+
+uint32_t mutex_stats_now(void)
+{
+    return _running ? ztimer_now(ZTIMER_USEC) : 0;
+}
+
+void mutex_stats_acquired(const mutex_t *mutex)
+{
+    if (_running) {
+        _acquired(mutex, ztimer_now(ZTIMER_USEC), 0, false);
+    }
+}
+
+void mutex_stats_acquired_contended(const mutex_t *mutex, uint32_t wait_start)
+{
+    if (_running) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        _acquired(mutex, now, now - wait_start, true);
+    }
+}
+
+void mutex_stats_released(const mutex_t *mutex)
+{
+    if (!_running) {
+        return;
+    }
+
+    unsigned irq_state = irq_disable();
+    /* don't add mutexes that were never acquired, such as those created with
+     * MUTEX_INIT_LOCKED */
+    mutex_stats_t *entry = _find(mutex, false);
+
+    if ((entry != NULL) && entry->locked) {
+        uint32_t held = ztimer_now(ZTIMER_USEC) - entry->locked_since;
+        entry->hold_total += held;
+        if (held > entry->hold_max) {
+            entry->hold_max = held;
+        }
+        entry->locked = false;
+    }
+
+    irq_restore(irq_state);
+}
+
+size_t mutex_stats_get(mutex_stats_t *dest, size_t max)
+{
+    size_t n = 0;
+
+    for (unsigned i = 0; (i < CONFIG_MUTEX_STATS_NUMOF) && (n < max); i++) {
+        unsigned irq_state = irq_disable();
+        if (_stats[i].mutex != NULL) {
+            dest[n++] = _stats[i];
+        }
+        irq_restore(irq_state);
+    }
+
+    return n;
+}
+
+uint32_t mutex_stats_untracked(void)
+{
+    return _untracked;
+}
+
+void mutex_stats_reset(void)
+{
+    unsigned irq_state = irq_disable();
+    memset(_stats, 0, sizeof(_stats));
+    _untracked = 0;
+    irq_restore(irq_state);
+}
+
+void mutex_stats_print(void)
+{
+    puts("     mutex    acquired   contended  wait avg[us]  wait max[us]"
+         "  hold avg[us]  hold max[us]");
+
+    /* printing may lock mutexes itself, so copy one entry at a time */
+    for (unsigned i = 0; i < CONFIG_MUTEX_STATS_NUMOF; i++) {
+        mutex_stats_t entry;
+        unsigned irq_state = irq_disable();
+        entry = _stats[i];
+        irq_restore(irq_state);
+
+        if (entry.mutex == NULL) {
+            continue;
+        }
+
+        uint32_t wait_avg = entry.contended
+                          ? (uint32_t)(entry.wait_total / entry.contended) : 0;
+        uint32_t released = entry.acquisitions - (entry.locked ? 1 : 0);
+        uint32_t hold_avg = released
+                          ? (uint32_t)(entry.hold_total / released) : 0;
+
+        printf("%10p  %10" PRIu32 "  %10" PRIu32 "  %12" PRIu32 "  %12" PRIu32
+               "  %12" PRIu32 "  %12" PRIu32 "\n",
+               (const void *)entry.mutex, entry.acquisitions, entry.contended,
+               wait_avg, entry.wait_max, hold_avg, entry.hold_max);
+    }
+
+    if (_untracked) {
+        printf("%" PRIu32 " acquisitions of untracked mutexes, increase "
+               "CONFIG_MUTEX_STATS_NUMOF\n", _untracked);
+    }
+}
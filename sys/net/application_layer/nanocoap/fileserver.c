@@ -207,7 +207,7 @@ static inline void _event_file(nanocoap_fileserver_event_t event, struct request
 }
 
 static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
-                         struct requestdata *request)
+                         struct requestdata *request, coap_request_ctx_t *ctx)
 {
     int err;
     uint32_t etag, size_total;
@@ -275,7 +275,17 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * */
     assert(pdu->payload + slicer.end - slicer.start <= buf + len);
     bool more = 1;
-    int read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    int read;
+    iolist_t *snip = coap_request_ctx_get_payload_snip(ctx);
+    if (snip) {
+        /* let the server send the file contents from where they are stored
+         * if the file system allows it */
+        read = vfs_read_iolist(fd, snip, pdu->payload,
+                               slicer.end - slicer.start + more);
+    }
+    else {
+        read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    }
     if (read < 0) {
         goto late_err;
     }
@@ -284,6 +294,18 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     vfs_close(fd);
 
+    if (snip) {
+        if (snip->iol_base == pdu->payload) {
+            /* data was copied into the response buffer */
+            snip->iol_len = 0;
+        }
+        else {
+            /* payload is sent from the snip, not from the response buffer */
+            snip->iol_len = read;
+            resp_len -= read;
+        }
+    }
+
     slicer.cur = slicer.end + more;
     coap_block2_finish(&slicer);
 
@@ -448,11 +470,12 @@ static ssize_t _delete_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 #endif
 
 static ssize_t nanocoap_fileserver_file_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
-                                             struct requestdata *request)
+                                             struct requestdata *request,
+                                             coap_request_ctx_t *ctx)
 {
     switch (coap_get_method(pdu)) {
         case COAP_METHOD_GET:
-            return _get_file(pdu, buf, len, request);
+            return _get_file(pdu, buf, len, request, ctx);
 #if IS_USED(MODULE_NANOCOAP_FILESERVER_PUT)
         case COAP_METHOD_PUT:
             return _put_file(pdu, buf, len, request);
@@ -739,7 +762,7 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * resource list, but that'll go away once we parse more options */
     return is_directory
         ? nanocoap_fileserver_directory_handler(pdu, buf, len, &request, root, resource)
-        : nanocoap_fileserver_file_handler(pdu, buf, len, &request);
+        : nanocoap_fileserver_file_handler(pdu, buf, len, &request, ctx);
 error:
     if (_resp_init(pdu, buf, len, errorcode)) {
         return -1;
@@ -591,6 +591,10 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
                                        coap_resources, coap_resources_numof);
 
     if (retval < 0) {
+        if (ctx->payload_snip) {
+            /* the reply is built anew, drop what the handler attached */
+            ctx->payload_snip->iol_len = 0;
+        }
         if (retval == -ECANCELED) {
             DEBUG_PUTS("nanocoap: No-Response Option present and matching");
             if (coap_get_type(pkt) == COAP_TYPE_CON) {
@@ -1779,3 +1783,8 @@ const sock_udp_ep_t *coap_request_ctx_get_local_udp(const coap_request_ctx_t *ct
     return NULL;
 #endif
 }
+
+iolist_t *coap_request_ctx_get_payload_snip(coap_request_ctx_t *ctx)
+{
+    return ctx->payload_snip;
+}
@@ -1257,12 +1257,20 @@ int nanocoap_server(sock_udp_ep_t *local, void *rsp_buf, size_t rsp_buf_len)
         }
         ctx.local = &aux_in.local;
 #endif
+        /* handlers may attach payload they do not want to copy */
+        iolist_t payload = { 0 };
+        ctx.payload_snip = &payload;
         if ((res = coap_handle_req(&pkt, rsp_buf, rsp_buf_len, &ctx)) <= 0) {
             DEBUG("nanocoap: error handling request %" PRIdSIZE "\n", res);
             continue;
         }
 
-        sock_udp_send_aux(&sock, rsp_buf, res, &remote, aux_out_ptr);
+        iolist_t reply = {
+            .iol_next = payload.iol_len ? &payload : NULL,
+            .iol_base = rsp_buf,
+            .iol_len = res,
+        };
+        sock_udp_sendv_aux(&sock, &reply, &remote, aux_out_ptr);
     }
 
     return 0;
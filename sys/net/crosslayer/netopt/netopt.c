@@ -140,6 +140,8 @@ static const char *_netopt_strmap[] = {
     [NETOPT_PAN_COORD]             = "NETOPT_PAN_COORD",
     [NETOPT_GTS_ALLOC]             = "NETOPT_GTS_ALLOC",
     [NETOPT_GTS_TX]                = "NETOPT_GTS_TX",
+    [NETOPT_TSCH_SLOTFRAME]        = "NETOPT_TSCH_SLOTFRAME",
+    [NETOPT_TSCH_CELL]             = "NETOPT_TSCH_CELL",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
@@ -679,6 +679,9 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+    gnrc_netif_ipv6_index_add(netif, &netif->ipv6.addrs[idx]);
+#endif
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -725,6 +728,12 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     gnrc_netif_acquire(netif);
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+            /* unused entries were never added */
+            if (netif->ipv6.addrs_flags[i] != 0) {
+                gnrc_netif_ipv6_index_remove(netif, &netif->ipv6.addrs[i]);
+            }
+#endif
             netif->ipv6.addrs_flags[i] = 0;
             ipv6_addr_set_unspecified(&netif->ipv6.addrs[i]);
         }
@@ -801,6 +810,11 @@ gnrc_netif_t *gnrc_netif_get_by_ipv6_addr(const ipv6_addr_t *addr)
 
     DEBUG("gnrc_netif: get interface by IPv6 address %s\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+    if (gnrc_netif_ipv6_index_lookup(addr, &netif)) {
+        return netif;
+    }
+#endif
     while ((netif = gnrc_netif_iter(netif))) {
         if (_addr_idx(netif, addr) >= 0) {
             break;
@@ -882,6 +896,9 @@ int gnrc_netif_ipv6_group_join_internal(gnrc_netif_t *netif,
         return -ENOMEM;
     }
     memcpy(&netif->ipv6.groups[idx], addr, sizeof(netif->ipv6.groups[idx]));
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+    gnrc_netif_ipv6_index_add(netif, &netif->ipv6.groups[idx]);
+#endif
     /* TODO:
      *  - MLD action
      */
@@ -943,6 +960,9 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
         }
     }
     if (idx >= 0) {
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+        gnrc_netif_ipv6_index_remove(netif, &netif->ipv6.groups[idx]);
+#endif
         ipv6_addr_set_unspecified(&netif->ipv6.groups[idx]);
         /* TODO:
          *  - MLD action */
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_netif
+ * @{
+ *
+ * @file
+ * @brief       Index of the IPv6 addresses and groups of all interfaces
+ *
+ * The index is a hash table with linear probing. Its entries point to the
+ * address in gnrc_netif_ipv6_t::addrs or gnrc_netif_ipv6_t::groups. Changes
+ * are serialized by a mutex and bracketed by a sequence counter, lookups do
+ * not lock but retry when the counter changed meanwhile.
+ *
+ * Addresses that do not fit are counted. Until all of them are removed
+ * again, lookups report that the interfaces have to be searched.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "atomic_utils.h"
+#include "log.h"
+#include "mutex.h"
+#include "net/gnrc/netif/internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define INDEX_MASK  (CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE - 1)
+
+static_assert((CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE & INDEX_MASK) == 0,
+              "CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE must be a power of two");
+
+typedef struct {
+    const ipv6_addr_t *addr;    /**< address in the interface, NULL if unused */
+    gnrc_netif_t *netif;        /**< interface the address is assigned to */
+} _entry_t;
+
+static _entry_t _index[CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE];
+static uint16_t _used;
+/* addresses that did not fit, lookups have to search the interfaces */
+static uint16_t _missing;
+/* odd while the index is changed */
+static uint32_t _seq;
+static mutex_t _lock = MUTEX_INIT;
+
+static unsigned _home(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* Fibonacci hashing, the upper bits are mixed best */
+    return ((hash * 2654435769U) >> 16) & INDEX_MASK;
+}
+
+static void _change_begin(void)
+{
+    mutex_lock(&_lock);
+    atomic_fetch_add_u32(&_seq, 1);
+}
+
+static void _change_end(void)
+{
+    atomic_fetch_add_u32(&_seq, 1);
+    mutex_unlock(&_lock);
+}
+
+void gnrc_netif_ipv6_index_add(gnrc_netif_t *netif, const ipv6_addr_t *addr)
+{
+    _change_begin();
+    /* one entry stays free, so probing always ends */
+    if (_used < INDEX_MASK) {
+        unsigned i = _home(addr);
+        while (_index[i].addr != NULL) {
+            i = (i + 1) & INDEX_MASK;
+        }
+        _index[i].addr = addr;
+        _index[i].netif = netif;
+        _used++;
+    }
+    else if (_missing++ == 0) {
+        LOG_WARNING("gnrc_netif: IPv6 address index full, increase "
+                    "CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE\n");
+    }
+    _change_end();
+}
+
+void gnrc_netif_ipv6_index_remove(gnrc_netif_t *netif, const ipv6_addr_t *addr)
+{
+    _change_begin();
+    unsigned i = _home(addr);
+    while ((_index[i].addr != NULL) && (_index[i].addr != addr)) {
+        i = (i + 1) & INDEX_MASK;
+    }
+    if (_index[i].addr != NULL) {
+        assert(_index[i].netif == netif);
+        (void)netif;
+        /* move entries back that would not be found anymore */
+        for (unsigned j = (i + 1) & INDEX_MASK; _index[j].addr != NULL;
+             j = (j + 1) & INDEX_MASK) {
+            unsigned home = _home(_index[j].addr);
+            if (((j - home) & INDEX_MASK) >= ((j - i) & INDEX_MASK)) {
+                _index[i] = _index[j];
+                i = j;
+            }
+        }
+        _index[i].addr = NULL;
+        _used--;
+    }
+    else if (_missing > 0) {
+        /* the address was one that did not fit */
+        _missing--;
+    }
+    _change_end();
+}
+
+static gnrc_netif_t *_probe(const ipv6_addr_t *addr)
+{
+    for (unsigned i = _home(addr); _index[i].addr != NULL;
+         i = (i + 1) & INDEX_MASK) {
+        if (ipv6_addr_equal(_index[i].addr, addr)) {
+            return _index[i].netif;
+        }
+    }
+    return NULL;
+}
+
+bool gnrc_netif_ipv6_index_lookup(const ipv6_addr_t *addr,
+                                  gnrc_netif_t **netif)
+{
+    for (;;) {
+        uint32_t seq = atomic_load_u32(&_seq);
+        if (seq & 1) {
+            /* the index is being changed, wait until it is done */
+            mutex_lock(&_lock);
+            mutex_unlock(&_lock);
+            continue;
+        }
+        if (_missing > 0) {
+            return false;
+        }
+        gnrc_netif_t *res = _probe(addr);
+        if (atomic_load_u32(&_seq) == seq) {
+            *netif = res;
+            return true;
+        }
+        DEBUG("gnrc_netif: IPv6 index changed during lookup, retry\n");
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_ipv6_flow_cache
+ * @{
+ *
+ * @file
+ * @brief       IPv6 next-hop flow cache
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "net/gnrc/ipv6/flow_cache.h"
+#include "net/gnrc/ipv6/nib.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define CACHE_MASK  (CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE - 1)
+
+static_assert((CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE & CACHE_MASK) == 0,
+              "CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE must be a power of two");
+
+typedef struct {
+    ipv6_addr_t dst;            /**< destination of the flow */
+    const gnrc_netif_t *netif;  /**< interface the flow was sent to */
+    uint32_t gen;               /**< generation of the NIB @ref nce is from */
+    bool valid;                 /**< entry is in use */
+    gnrc_ipv6_nib_nc_t nce;     /**< resolved next hop */
+} _entry_t;
+
+static _entry_t _cache[CONFIG_GNRC_IPV6_FLOW_CACHE_SIZE];
+
+static _entry_t *_slot(const ipv6_addr_t *dst, const gnrc_netif_t *netif)
+{
+    uint32_t hash = dst->u32[0].u32 ^ dst->u32[1].u32 ^
+                    dst->u32[2].u32 ^ dst->u32[3].u32 ^
+                    (uint32_t)(uintptr_t)netif;
+
+    /* Fibonacci hashing, the upper bits are mixed best */
+    return &_cache[((hash * 2654435769U) >> 16) & CACHE_MASK];
+}
+
+static bool _cacheable(const gnrc_ipv6_nib_nc_t *nce)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(nce));
+
+    if ((netif != NULL) && (netif->ipv6.route_info_cb != NULL)) {
+        return false;
+    }
+#endif
+    if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)) {
+        /* NUD states do not change without the NIB changing */
+        return true;
+    }
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+        /* Falls through. */
+        case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+            return true;
+        default:
+            /* a STALE neighbor has to be probed when used */
+            return false;
+    }
+}
+
+bool gnrc_ipv6_flow_cache_get(const ipv6_addr_t *dst,
+                              const gnrc_netif_t *netif,
+                              gnrc_ipv6_nib_nc_t *nce)
+{
+    _entry_t *entry = _slot(dst, netif);
+
+    if (!entry->valid || (entry->netif != netif) ||
+        !ipv6_addr_equal(&entry->dst, dst)) {
+        return false;
+    }
+    if (entry->gen != gnrc_ipv6_nib_generation()) {
+        DEBUG("ipv6 flow cache: NIB changed, drop entry\n");
+        entry->valid = false;
+        return false;
+    }
+    *nce = entry->nce;
+    return true;
+}
+
+void gnrc_ipv6_flow_cache_add(const ipv6_addr_t *dst,
+                              const gnrc_netif_t *netif, uint32_t gen,
+                              const gnrc_ipv6_nib_nc_t *nce)
+{
+    if (!_cacheable(nce)) {
+        return;
+    }
+
+    _entry_t *entry = _slot(dst, netif);
+
+    entry->dst = *dst;
+    entry->netif = netif;
+    entry->gen = gen;
+    entry->nce = *nce;
+    entry->valid = true;
+}
@@ -33,6 +33,7 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
+#include "net/gnrc/ipv6/flow_cache.h"
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
@@ -614,6 +615,27 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+static int _get_next_hop_l2addr(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                                gnrc_pktsnip_t *pkt, gnrc_ipv6_nib_nc_t *nce)
+{
+#ifdef MODULE_GNRC_IPV6_FLOW_CACHE
+    if (gnrc_ipv6_flow_cache_get(dst, netif, nce)) {
+        DEBUG("ipv6: next hop to %s from flow cache\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        return 0;
+    }
+    /* read before resolving, so changes meanwhile invalidate the result */
+    uint32_t gen = gnrc_ipv6_nib_generation();
+    int res = gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+    if (res == 0) {
+        gnrc_ipv6_flow_cache_add(dst, netif, gen, nce);
+    }
+    return res;
+#else
+    return gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+#endif
+}
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
@@ -621,8 +643,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     gnrc_ipv6_nib_nc_t nce;
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
-                                          &nce) < 0) {
+    if (_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt, &nce) < 0) {
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
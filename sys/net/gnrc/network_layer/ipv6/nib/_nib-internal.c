@@ -25,6 +25,9 @@
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+#include "net/gnrc/rpl/dao_table.h"
+#endif
 #include "net/ipv6/addr.h"
 #include "random.h"
 
@@ -50,6 +53,7 @@ static rmutex_t _nib_mutex = RMUTEX_INIT;
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
+uint32_t _nib_gen;
 
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
@@ -194,6 +198,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* masked above already */
         node->info |= cstate;
         node->mode |= _NC;
+        _nib_changed();
     }
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
@@ -247,6 +252,7 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 
     node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+    _nib_changed();
 #ifdef TEST_SUITES
     /* exit early for unittests */
     if (netif == NULL) {
@@ -269,6 +275,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
+    _nib_changed();
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
@@ -346,7 +353,10 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
             (ipv6_addr_equal(router_addr, &tmp_node->ipv6))) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
-            tmp_node->mode |= _DRL;
+            if (!(tmp_node->mode & _DRL)) {
+                tmp_node->mode |= _DRL;
+                _nib_changed();
+            }
             return tmp;
         }
         if ((def_router == NULL) && (tmp_node == NULL)) {
@@ -362,6 +372,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         }
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
+        _nib_changed();
     }
     return def_router;
 }
@@ -371,6 +382,7 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
     if (nib_dr->next_hop != NULL) {
         _evtimer_del(&nib_dr->rtr_timeout);
         nib_dr->next_hop->mode &= ~(_DRL);
+        _nib_changed();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
         /*  When removing a router from the Default
             Router list, the node MUST update the Destination Cache in such a way
@@ -508,9 +520,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                                        || _addr_equals(next_hop, tmp_node))) {
                 /* next hop matches or is unspecified */
                 DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
+                if ((next_hop != NULL) && !_addr_equals(next_hop, tmp_node)) {
                     /* sets next_hop if it was previously unspecified */
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _nib_changed();
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -647,6 +660,13 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
           (void *)pkt);
     _nib_offl_entry_t *offl = _nib_offl_get_match(dst);
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+    /* downward routes of RPL are kept outside the NIB */
+    if (gnrc_rpl_dao_table_get_route(dst, (offl != NULL) ? offl->pfx_len + 1 : 0,
+                                     fte)) {
+        return 0;
+    }
+#endif
     if ((offl == NULL) ||
         /* give default route precedence over off-link PLEs */
         ((offl->mode == _PL) && !(offl->flags & _PFX_ON_LINK))) {
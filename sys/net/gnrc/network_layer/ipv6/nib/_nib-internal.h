@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "atomic_utils.h"
 #include "bitfield.h"
 #include "evtimer_msg.h"
 #include "sched.h"
@@ -261,6 +262,14 @@ extern evtimer_msg_t _nib_evtimer;
  */
 extern _nib_dr_entry_t *_prime_def_router;
 
+/**
+ * @brief   Generation of the NIB
+ *
+ * Incremented by @ref _nib_changed(), read by
+ * @ref gnrc_ipv6_nib_generation().
+ */
+extern uint32_t _nib_gen;
+
 /**
  * @brief   Looks up if an event is queued in the event timer
  *
@@ -311,6 +320,18 @@ static inline void _evtimer_add(void *ctx, int16_t type,
  */
 void _nib_init(void);
 
+/**
+ * @brief   Marks a change of the NIB that may change the result of
+ *          @ref gnrc_ipv6_nib_get_next_hop_l2addr()
+ *
+ * That is, a neighbor cache entry or its link-layer address or NUD state, a
+ * default router, or an off-link entry was added, changed, or removed.
+ */
+static inline void _nib_changed(void)
+{
+    atomic_fetch_add_u32(&_nib_gen, 1);
+}
+
 /**
  * @brief   Acquire exclusive access to the NIB
  */
@@ -638,8 +659,9 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 {
     _nib_offl_entry_t *nib_offl = _nib_offl_alloc(next_hop, iface, pfx, pfx_len);
 
-    if (nib_offl != NULL) {
+    if ((nib_offl != NULL) && ((nib_offl->mode & mode) != mode)) {
         nib_offl->mode |= mode;
+        _nib_changed();
     }
     return nib_offl;
 }
@@ -653,6 +675,7 @@ static inline void _nib_offl_remove(_nib_offl_entry_t *nib_offl, uint8_t mode)
 {
     nib_offl->mode &= ~mode;
     _nib_offl_clear(nib_offl);
+    _nib_changed();
 }
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC) || DOXYGEN
@@ -449,6 +449,16 @@ out:
     return res;
 }
 
+uint32_t gnrc_ipv6_nib_generation(void)
+{
+    return atomic_load_u32(&_nib_gen);
+}
+
+void gnrc_ipv6_nib_changed(void)
+{
+    _nib_changed();
+}
+
 void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                               const icmpv6_hdr_t *icmpv6, size_t icmpv6_len)
 {
@@ -10,11 +10,20 @@
  * @{
  *
  * @file
+ *
+ * The contexts in use are kept in an index sorted by prefix length, longest
+ * first, so an address lookup ends at the first matching context. Changes are
+ * serialized by a mutex and bracketed by a sequence counter, address lookups
+ * do not lock but retry when the counter changed meanwhile. The counter also
+ * tells users of gnrc_sixlowpan_ctx_memo_t whether a memoized lookup is still
+ * valid.
  */
 
 #include <stdbool.h>
 #include <inttypes.h>
+#include <string.h>
 
+#include "atomic_utils.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -30,37 +39,115 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+/* IDs of the contexts in use, longest prefix first */
+static uint8_t _ctx_index[GNRC_SIXLOWPAN_CTX_SIZE];
+static uint8_t _ctx_index_numof;
+/* minute the next context used for compression expires at */
+static uint32_t _ctx_next_expiry = UINT32_MAX;
+/* odd while the contexts are changed */
+static uint32_t _ctx_seq;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
+static void _update_ltime(uint8_t id);
 
 static char ipv6str[IPV6_ADDR_MAX_STR_LEN];
 
-static inline bool _valid(uint8_t id)
+static void _change_begin(void)
 {
-    _update_lifetime(id);
-    return (_ctxs[id].prefix_len > 0);
+    mutex_lock(&_ctx_mutex);
+    atomic_fetch_add_u32(&_ctx_seq, 1);
 }
 
-gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
+/* rebuilds the index, has to be called with the mutex held */
+static void _compile(void)
 {
-    uint8_t best = 0;
-    gnrc_sixlowpan_ctx_t *res = NULL;
+    uint32_t next_expiry = UINT32_MAX;
 
-    mutex_lock(&_ctx_mutex);
+    _ctx_index_numof = 0;
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (_ctxs[id].prefix_len == 0) {
+            continue;
+        }
+        /* insertion sort, IDs with the same prefix length keep their order */
+        unsigned i = _ctx_index_numof++;
+        while ((i > 0) &&
+               (_ctxs[_ctx_index[i - 1]].prefix_len < _ctxs[id].prefix_len)) {
+            _ctx_index[i] = _ctx_index[i - 1];
+            i--;
+        }
+        _ctx_index[i] = id;
+        if ((_ctxs[id].flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP) &&
+            (_ctx_inval_times[id] < next_expiry)) {
+            next_expiry = _ctx_inval_times[id];
+        }
+    }
+    atomic_store_u32(&_ctx_next_expiry, next_expiry);
+}
 
-    for (unsigned int id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
-        if (_valid(id)) {
-            uint8_t match = ipv6_addr_match_prefix(&_ctxs[id].prefix, addr);
+static void _change_end(void)
+{
+    _compile();
+    atomic_fetch_add_u32(&_ctx_seq, 1);
+    mutex_unlock(&_ctx_mutex);
+}
 
-            if ((_ctxs[id].prefix_len <= match) && (match > best)) {
-                best = match;
-                res = &(_ctxs[id]);
+/* withdraws contexts from compression when their lifetime is over */
+static void _expire(void)
+{
+    if (_current_minute() < atomic_load_u32(&_ctx_next_expiry)) {
+        return;
+    }
+    _change_begin();
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (_ctxs[id].prefix_len > 0) {
+            _update_lifetime(id);
+        }
+    }
+    _change_end();
+}
+
+static bool _match(const gnrc_sixlowpan_ctx_t *ctx, const ipv6_addr_t *addr)
+{
+    unsigned bytes = ctx->prefix_len / 8;
+    uint8_t mask = 0xff00 >> (ctx->prefix_len % 8);
+
+    return (memcmp(ctx->prefix.u8, addr->u8, bytes) == 0) &&
+           ((mask == 0) || (((ctx->prefix.u8[bytes] ^ addr->u8[bytes]) & mask) == 0));
+}
+
+static gnrc_sixlowpan_ctx_t *_lookup_addr(const ipv6_addr_t *addr, uint32_t *seq)
+{
+    for (;;) {
+        gnrc_sixlowpan_ctx_t *res = NULL;
+
+        *seq = atomic_load_u32(&_ctx_seq);
+        if (*seq & 1) {
+            /* the contexts are being changed, wait until it is done */
+            mutex_lock(&_ctx_mutex);
+            mutex_unlock(&_ctx_mutex);
+            continue;
+        }
+        for (unsigned i = 0; i < _ctx_index_numof; i++) {
+            if (_match(&_ctxs[_ctx_index[i]], addr)) {
+                res = &_ctxs[_ctx_index[i]];
+                break;
             }
         }
+        if (atomic_load_u32(&_ctx_seq) == *seq) {
+            return res;
+        }
+        DEBUG("6lo ctx: contexts changed during lookup, retry\n");
     }
+}
 
-    mutex_unlock(&_ctx_mutex);
+gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
+{
+    uint32_t seq;
+    gnrc_sixlowpan_ctx_t *res;
+
+    _expire();
+    res = _lookup_addr(addr, &seq);
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         if (res != NULL) {
@@ -75,18 +162,41 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_addr(const ipv6_addr_t *addr)
     return res;
 }
 
+gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_memo(gnrc_sixlowpan_ctx_memo_t *memo,
+                                                     const ipv6_addr_t *addr)
+{
+    _expire();
+    if ((memo->seq != atomic_load_u32(&_ctx_seq)) ||
+        !ipv6_addr_equal(&memo->addr, addr)) {
+        memo->ctx = _lookup_addr(addr, &memo->seq);
+        memo->addr = *addr;
+    }
+    return memo->ctx;
+}
+
+uint32_t gnrc_sixlowpan_ctx_seq(void)
+{
+    _expire();
+    return atomic_load_u32(&_ctx_seq);
+}
+
 gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_lookup_id(uint8_t id)
 {
     if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
         return NULL;
     }
 
+    /* withdrawing a context from compression changes the index, so this is
+     * only done between _change_begin() and _change_end() */
+    _expire();
+
     mutex_lock(&_ctx_mutex);
 
-    if (_valid(id)) {
+    if (_ctxs[id].prefix_len > 0) {
         DEBUG("6lo ctx: found context (%u, %s/%" PRIu8 ")\n", id,
               ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
               _ctxs[id].prefix_len);
+        _update_ltime(id);
         mutex_unlock(&_ctx_mutex);
         return &(_ctxs[id]);
     }
@@ -104,7 +214,7 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
         return NULL;
     }
 
-    mutex_lock(&_ctx_mutex);
+    _change_begin();
 
     _ctxs[id].ltime = ltime;
 
@@ -130,10 +240,22 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
 
-    mutex_unlock(&_ctx_mutex);
+    _change_end();
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
+        return;
+    }
+
+    _change_begin();
+    DEBUG("6lo ctx: remove context %u\n", id);
+    _ctxs[id].prefix_len = 0;
+    _change_end();
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -164,12 +286,25 @@ static void _update_lifetime(uint8_t id)
     }
 }
 
-#ifdef TEST_SUITES
-#include <string.h>
+/* only counts the remaining lifetime down, the context is withdrawn from
+ * compression by _expire() */
+static void _update_ltime(uint8_t id)
+{
+    uint32_t now = _current_minute();
 
+    if (_ctxs[id].ltime == 0) {
+        return;
+    }
+    _ctxs[id].ltime = (now < _ctx_inval_times[id])
+                    ? (uint16_t)(_ctx_inval_times[id] - now) : 0;
+}
+
+#ifdef TEST_SUITES
 void gnrc_sixlowpan_ctx_reset(void)
 {
+    _change_begin();
     memset(_ctxs, 0, sizeof(_ctxs));
+    _change_end();
 }
 #endif
 
@@ -40,6 +40,8 @@
 
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #include "net/gnrc/sixlowpan/frag/sfr/congure.h"
+#include "net/gnrc/sixlowpan/frag/sfr/path.h"
+#include "net/gnrc/sixlowpan/frag/stats.h"
 
 #define ENABLE_DEBUG    0
 #include "debug.h"
@@ -129,6 +131,30 @@ static inline uint8_t _frag_seq(_frag_desc_t *frag);
  */
 static inline uint16_t _frag_size(_frag_desc_t *frag);
 
+/**
+ * @brief   Returns the maximum size of the next fragment of a datagram,
+ *          including the RFRAG header
+ */
+static inline uint16_t _max_frag_size(const gnrc_netif_t *netif,
+                                      const gnrc_sixlowpan_frag_fb_t *fbuf);
+
+/**
+ * @brief   Reports an RFRAG-ACK to the state of the path of a datagram
+ *
+ * @param[in] fbuf  Fragmentation buffer for the datagram
+ * @param[in] rtt   Round-trip time sample in ms, UINT32_MAX for none
+ * @param[in] lost  Number of fragments the RFRAG-ACK did not acknowledge
+ */
+static void _report_path_ack(gnrc_sixlowpan_frag_fb_t *fbuf, uint32_t rtt,
+                             unsigned lost);
+
+/**
+ * @brief   Reports an ARQ timeout to the state of the path of a datagram
+ *
+ * @param[in] fbuf  Fragmentation buffer for the datagram
+ */
+static void _report_path_timeout(gnrc_sixlowpan_frag_fb_t *fbuf);
+
 /**
  * @brief   Cleans up a fragmentation buffer entry and all state related to its
  *          datagram.
@@ -517,6 +543,7 @@ void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf)
     _frag_desc_t *frag_desc = (_frag_desc_t *)fbuf->sfr.window.next;
     uint32_t next_arq_offset = fbuf->sfr.arq_timeout;
     bool reschedule_arq_timeout = false;
+    bool backed_off = false;
     int error_no = ETIMEDOUT;   /* assume time out for fbuf->pkt */
 
     DEBUG("6lo sfr: ARQ timeout for datagram %u\n", fbuf->tag);
@@ -562,6 +589,12 @@ void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf)
                  * yet. Try to resend it */
                 if ((frag_desc->super.resends++) < CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
                     /* we have retries left for this fragment */
+                    if (!backed_off) {
+                        /* back off before the resend schedules the next ARQ
+                         * timeout */
+                        _report_path_timeout(fbuf);
+                        backed_off = true;
+                    }
                     DEBUG("6lo sfr: %u retries left for fragment (tag: %u, "
                           "X: %i, seq: %u, frag_size: %u, offset: %u)\n",
                           CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES -
@@ -1272,6 +1305,8 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
     _frag_desc_t *frag_desc;
     clist_node_t not_received = { .next = NULL };
     ztimer_now_t earliest_send = UINT32_MAX;
+    uint32_t rtt = UINT32_MAX;
+    unsigned lost = 0;
 
     DEBUG("6lo sfr: checking which fragments to resend for datagram %u\n",
           fbuf->tag);
@@ -1289,6 +1324,11 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
             DEBUG("6lo sfr: fragment %u (offset: %u, frag_size: %u) "
                   "for datagram %u was received\n", seq,
                   frag_desc->offset, _frag_size(frag_desc), fbuf->tag);
+            if (_frag_ack_req(frag_desc) && (frag_desc->super.resends == 0)) {
+                /* the ACK was requested by this fragment, and it was only
+                 * sent once so the sample is unambiguous */
+                rtt = ack_recv_time - frag_desc->super.send_time;
+            }
             fbuf->sfr.frags_sent--;
             clist_rpush(&_frag_descs_free, &frag_desc->super.super);
             if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_CONGURE)) {
@@ -1306,6 +1346,7 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
             DEBUG("6lo sfr: fragment %u (offset: %u, frag_size: %u) "
                   "for datagram %u was not received\n", seq,
                   frag_desc->offset, _frag_size(frag_desc), fbuf->tag);
+            lost++;
             if ((frag_desc->super.resends++) < CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
                 DEBUG("6lo sfr: %u retries left\n",
                       CONFIG_GNRC_SIXLOWPAN_SFR_FRAG_RETRIES -
@@ -1324,6 +1365,7 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
                     );
                 }
                 clist_rpush(&_frag_descs_free, &frag_desc->super.super);
+                _report_path_ack(fbuf, rtt, lost);
                 /* retry to resend whole datagram */
                 _retry_datagram(fbuf);
                 return;
@@ -1334,10 +1376,21 @@ static void _check_failed_frags(sixlowpan_sfr_ack_t *ack,
         sixlowpan_sfr_ecn(&ack->base)) {
         gnrc_sixlowpan_frag_sfr_congure_snd_report_ecn(fbuf, earliest_send);
     }
+    _report_path_ack(fbuf, rtt, lost);
     /* all fragments were received of the current window were received and
      * the datagram was transmitted completely */
     if ((clist_lpeek(&not_received) == NULL) &&
         (fbuf->offset == fbuf->datagram_size)) {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+        uint32_t dg_time = ack_recv_time - fbuf->sfr.start;
+
+        stats->sfr_datagrams++;
+        stats->sfr_time_sum += dg_time;
+        if (dg_time > stats->sfr_time_max) {
+            stats->sfr_time_max = dg_time;
+        }
+#endif
         /* release fragmentation buffer */
         _clean_up_fbuf(fbuf, GNRC_NETERR_SUCCESS);
     }
@@ -1406,6 +1459,70 @@ static inline uint16_t _frag_size(_frag_desc_t *frag)
     return (frag->ar_seq_fs & SIXLOWPAN_SFR_FRAG_SIZE_MASK);
 }
 
+static inline uint16_t _max_frag_size(const gnrc_netif_t *netif,
+                                      const gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+    return (netif->sixlo.max_frag_size > fbuf->sfr.frag_size)
+         ? fbuf->sfr.frag_size
+         : netif->sixlo.max_frag_size;
+#else
+    (void)fbuf;
+    return netif->sixlo.max_frag_size;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+static gnrc_sixlowpan_frag_sfr_path_t *_get_path(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+
+    return gnrc_sixlowpan_frag_sfr_path_get(gnrc_netif_hdr_get_netif(netif_hdr),
+                                            gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                            netif_hdr->dst_l2addr_len, false);
+}
+#endif
+
+static void _report_path_ack(gnrc_sixlowpan_frag_fb_t *fbuf, uint32_t rtt,
+                             unsigned lost)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get_path(fbuf);
+
+    if (path == NULL) {
+        /* state was replaced by state for another path in the meantime */
+        return;
+    }
+    if (rtt != UINT32_MAX) {
+        gnrc_sixlowpan_frag_sfr_path_rtt(path, rtt);
+    }
+    gnrc_sixlowpan_frag_sfr_path_ack(path, lost);
+    fbuf->sfr.arq_timeout = path->rto;
+    fbuf->sfr.frag_size = path->frag_size;
+#else
+    (void)fbuf;
+    (void)rtt;
+    (void)lost;
+#endif
+}
+
+static void _report_path_timeout(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get_path(fbuf);
+
+    if (path == NULL) {
+        /* state was replaced by state for another path in the meantime */
+        return;
+    }
+    gnrc_sixlowpan_frag_sfr_path_timeout(path);
+    fbuf->sfr.arq_timeout = path->rto;
+    fbuf->sfr.frag_size = path->frag_size;
+#else
+    (void)fbuf;
+#endif
+}
+
 static void _clean_up_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf, int error)
 {
     DEBUG("6lo sfr: removing fragmentation buffer entry for datagram %u\n",
@@ -1424,8 +1541,7 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *netif,
     sixlowpan_sfr_rfrag_t *hdr;
     uint8_t *data;
     size_t comp_form_size = gnrc_pkt_len(pkt->next);
-    uint16_t frag_size = (uint16_t)netif->sixlo.max_frag_size -
-                         sizeof(sixlowpan_sfr_rfrag_t);
+    uint16_t frag_size;
 
     assert((fbuf->sfr.cur_seq == 0) && (fbuf->sfr.frags_sent == 0));
     assert(fbuf->sfr.window.next == NULL);
@@ -1433,6 +1549,20 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *netif,
     /* restrict tag to value space of SFR, so that later RFRAG ACK can find
      * it in reverse look-up */
     fbuf->tag &= UINT8_MAX;
+    fbuf->sfr.arq_timeout = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+    gnrc_sixlowpan_frag_sfr_path_t *path = gnrc_sixlowpan_frag_sfr_path_get(
+            netif, gnrc_netif_hdr_get_dst_addr(pkt->data),
+            ((gnrc_netif_hdr_t *)pkt->data)->dst_l2addr_len, true
+        );
+
+    fbuf->sfr.arq_timeout = path->rto;
+    fbuf->sfr.frag_size = path->frag_size;
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    fbuf->sfr.start = xtimer_now_usec() / US_PER_MS;
+#endif
+    frag_size = _max_frag_size(netif, fbuf) - sizeof(sixlowpan_sfr_rfrag_t);
     DEBUG("6lo sfr: determined frag_size = %u\n", frag_size);
 
     /* packet was compressed */
@@ -1447,7 +1577,6 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *netif,
          * datagram_size */
         fbuf->datagram_size++;
     }
-    fbuf->sfr.arq_timeout = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
 
     frag = _build_frag_from_fbuf(pkt, fbuf, frag_size);
     if (frag == NULL) {
@@ -1484,7 +1613,7 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *netif,
     gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
     sixlowpan_sfr_rfrag_t *hdr;
     uint8_t *data;
-    uint16_t frag_size = (uint16_t)netif->sixlo.max_frag_size -
+    uint16_t frag_size = _max_frag_size(netif, fbuf) -
                          sizeof(sixlowpan_sfr_rfrag_t);
     uint16_t local_offset;
 
@@ -1809,16 +1938,17 @@ static void _handle_ack(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             if (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0) {
                 /* garbage-collect entry after CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER
                  * microseconds */
-                vrbe->super.arrival = recv_time -
-                                      (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US -
-                                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+                gnrc_sixlowpan_frag_vrb_set_arrival(
+                    vrbe, recv_time - (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US -
+                                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER)
+                );
             }
             else {
                 gnrc_sixlowpan_frag_vrb_rm(vrbe);
             }
         }
         else {
-            vrbe->super.arrival = recv_time;
+            gnrc_sixlowpan_frag_vrb_set_arrival(vrbe, recv_time);
         }
     }
     else {
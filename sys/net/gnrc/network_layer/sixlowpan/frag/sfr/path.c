@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "assert.h"
+#include "container.h"
+#include "macros/utils.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/path.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+/* clock granularity G of RFC 6298 in ms */
+#define RTO_GRANULARITY     (1U)
+
+/* least recently used path last */
+static gnrc_sixlowpan_frag_sfr_path_t _paths[CONFIG_GNRC_SIXLOWPAN_SFR_PATH_NUMOF];
+
+static void _init(gnrc_sixlowpan_frag_sfr_path_t *path,
+                  const gnrc_netif_t *netif, const uint8_t *l2addr,
+                  uint8_t l2addr_len)
+{
+    memset(path, 0, sizeof(*path));
+    path->netif = netif;
+    path->rto = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS;
+    path->frag_size = CONFIG_GNRC_SIXLOWPAN_SFR_OPT_FRAG_SIZE;
+    path->l2addr_len = l2addr_len;
+    memcpy(path->l2addr, l2addr, l2addr_len);
+}
+
+gnrc_sixlowpan_frag_sfr_path_t *gnrc_sixlowpan_frag_sfr_path_get(const gnrc_netif_t *netif,
+                                                                 const uint8_t *l2addr,
+                                                                 uint8_t l2addr_len,
+                                                                 bool create)
+{
+    gnrc_sixlowpan_frag_sfr_path_t path;
+    unsigned i;
+
+    assert(l2addr_len <= sizeof(path.l2addr));
+    for (i = 0; i < ARRAY_SIZE(_paths); i++) {
+        if ((_paths[i].netif == NULL) ||
+            ((_paths[i].netif == netif) &&
+             (_paths[i].l2addr_len == l2addr_len) &&
+             (memcmp(_paths[i].l2addr, l2addr, l2addr_len) == 0))) {
+            break;
+        }
+    }
+    if (i == ARRAY_SIZE(_paths)) {
+        if (!create) {
+            return NULL;
+        }
+        /* replace least recently used path */
+        i--;
+        DEBUG("6lo sfr path: replacing path %u\n", i);
+        _init(&_paths[i], netif, l2addr, l2addr_len);
+    }
+    else if (_paths[i].netif == NULL) {
+        if (!create) {
+            return NULL;
+        }
+        _init(&_paths[i], netif, l2addr, l2addr_len);
+    }
+    /* move to front */
+    path = _paths[i];
+    memmove(&_paths[1], &_paths[0], i * sizeof(_paths[0]));
+    _paths[0] = path;
+    return &_paths[0];
+}
+
+void gnrc_sixlowpan_frag_sfr_path_rtt(gnrc_sixlowpan_frag_sfr_path_t *path,
+                                      uint32_t rtt)
+{
+    uint32_t rto;
+
+    if (path->srtt == 0) {
+        /* first sample: SRTT <- R, RTTVAR <- R/2 */
+        path->srtt = (rtt > 0) ? (rtt << 3) : 1U;
+        path->rttvar = rtt << 1;
+    }
+    else {
+        /* RTTVAR <- 3/4 * RTTVAR + 1/4 * |SRTT - R|,
+         * SRTT <- 7/8 * SRTT + 1/8 * R, with both scaled */
+        uint32_t srtt = path->srtt >> 3;
+        uint32_t err = (srtt > rtt) ? (srtt - rtt) : (rtt - srtt);
+
+        path->rttvar = path->rttvar - (path->rttvar >> 2) + err;
+        path->srtt = path->srtt - srtt + rtt;
+        if (path->srtt == 0) {
+            path->srtt = 1U;
+        }
+    }
+    /* RTO <- SRTT + max(G, 4 * RTTVAR) */
+    rto = (path->srtt >> 3) + MAX(RTO_GRANULARITY, path->rttvar);
+    path->rto = MIN(MAX(rto, CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS),
+                    CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS);
+    DEBUG("6lo sfr path: RTT %" PRIu32 " ms => SRTT %" PRIu32 "/8 ms, "
+          "RTTVAR %" PRIu32 "/4 ms, RTO %" PRIu32 " ms\n",
+          rtt, path->srtt, path->rttvar, path->rto);
+}
+
+void gnrc_sixlowpan_frag_sfr_path_ack(gnrc_sixlowpan_frag_sfr_path_t *path,
+                                      unsigned lost)
+{
+    if (lost > 0) {
+        path->clean = 0;
+        if (path->frag_size >= (CONFIG_GNRC_SIXLOWPAN_SFR_MIN_FRAG_SIZE +
+                                CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP)) {
+            path->frag_size -= CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP;
+        }
+        else {
+            path->frag_size = CONFIG_GNRC_SIXLOWPAN_SFR_MIN_FRAG_SIZE;
+        }
+    }
+    else if (++path->clean >= CONFIG_GNRC_SIXLOWPAN_SFR_PATH_CLEAN_ACKS) {
+        path->clean = 0;
+        path->frag_size = MIN(path->frag_size +
+                              CONFIG_GNRC_SIXLOWPAN_SFR_PATH_FRAG_SIZE_STEP,
+                              CONFIG_GNRC_SIXLOWPAN_SFR_MAX_FRAG_SIZE);
+    }
+    DEBUG("6lo sfr path: %u fragments lost => fragment size %u\n", lost,
+          path->frag_size);
+}
+
+void gnrc_sixlowpan_frag_sfr_path_timeout(gnrc_sixlowpan_frag_sfr_path_t *path)
+{
+    /* back off as with RFC 6298, section 5.5 */
+    path->rto = MIN(path->rto << 1, CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 1);
+}
+
+#ifdef TEST_SUITES
+void gnrc_sixlowpan_frag_sfr_path_reset(void)
+{
+    memset(_paths, 0, sizeof(_paths));
+}
+#endif
+
+/** @} */
@@ -11,8 +11,19 @@
  *
  * @file
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
+ *
+ * Used entries are in the chain of their forward and of their reverse hash
+ * bucket and in the list of the wheel slot they are due in, free entries are
+ * chained through their forward link. Other modules update
+ * gnrc_sixlowpan_frag_rb_base_t::arrival of an entry without telling the VRB,
+ * so the wheel only is a hint: an entry is checked against its arrival time
+ * when its slot is due and filed anew if it is not timed out yet.
  */
 
+#include <assert.h>
+
+#include "macros/math.h"
+#include "macros/utils.h"
 #include "net/ieee802154.h"
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/ipv6/addr.h"
@@ -30,13 +41,82 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#define NONE            (UINT8_MAX)
+#define BUCKET_MASK     (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS - 1)
+#define WHEEL_SIZE      (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_WHEEL_SIZE)
+/* an entry is never filed more than one turn of the wheel ahead */
+#define SLOT_US         DIV_ROUND_UP(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US, \
+                                     WHEEL_SIZE - 1)
+
+static_assert((CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS & BUCKET_MASK) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS must be a power of two");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < NONE,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE too large");
+static_assert((WHEEL_SIZE >= 2) && (WHEEL_SIZE <= NONE),
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_WHEEL_SIZE out of range");
+
+typedef struct {
+    uint8_t fwd_next;       /**< next entry in forward bucket or free list */
+    uint8_t rev_next;       /**< next entry in reverse bucket */
+    uint8_t wheel_prev;     /**< previous entry in wheel slot */
+    uint8_t wheel_next;     /**< next entry in wheel slot */
+    uint8_t slot;           /**< wheel slot the entry is filed in */
+} _links_t;
+
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static _links_t _links[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _fwd[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS];
+static uint8_t _rev[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_BUCKETS];
+static uint8_t _wheel[WHEEL_SIZE];
+static uint32_t _slot_start;    /* start of current wheel slot in usec */
+static uint8_t _slot;           /* current wheel slot */
+static uint8_t _free;
+static bool _initialized;
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
 static char addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 #endif  /* MODULE_GNRC_IPV6_NIB */
 
+static void _init(void)
+{
+    /* zero-initialized memory is an empty VRB but for the links */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        _links[i].fwd_next = (i + 1 < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+                           ? i + 1 : NONE;
+    }
+    memset(_fwd, 0xff, sizeof(_fwd));
+    memset(_rev, 0xff, sizeof(_rev));
+    memset(_wheel, 0xff, sizeof(_wheel));
+    _slot_start = xtimer_now_usec();
+    _slot = 0;
+    _free = 0;
+    _initialized = true;
+}
+
+static inline unsigned _bucket(uint32_t hash)
+{
+    /* Fibonacci hashing, the upper bits are mixed best */
+    return ((hash * 2654435769U) >> 16) & BUCKET_MASK;
+}
+
+static unsigned _fwd_hash(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash << 5) + hash + src[i];
+    }
+    return _bucket(hash);
+}
+
+static unsigned _rev_hash(const gnrc_netif_t *netif, unsigned tag)
+{
+    /* SFR restricts gnrc_sixlowpan_frag_vrb_t::out_tag to 8 bits after the
+     * entry was added, so only these take part in the hash */
+    return _bucket((uint32_t)(uintptr_t)netif ^ (tag & UINT8_MAX));
+}
+
 static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
                                 const uint8_t *src, size_t src_len,
                                 unsigned tag)
@@ -46,72 +126,159 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static uint8_t _find(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    for (uint8_t i = _fwd[_fwd_hash(src, src_len, tag)]; i != NONE;
+         i = _links[i].fwd_next) {
+        if (_equal_index(&_vrb[i], src, src_len, tag)) {
+            return i;
+        }
+    }
+    return NONE;
+}
+
+static inline bool _timed_out(const gnrc_sixlowpan_frag_vrb_t *vrbe,
+                              uint32_t now_usec)
+{
+    return (now_usec - vrbe->super.arrival) >
+           CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US;
+}
+
+static void _wheel_remove(uint8_t i)
+{
+    _links_t *links = &_links[i];
+
+    if (links->wheel_prev != NONE) {
+        _links[links->wheel_prev].wheel_next = links->wheel_next;
+    }
+    else {
+        _wheel[links->slot] = links->wheel_next;
+    }
+    if (links->wheel_next != NONE) {
+        _links[links->wheel_next].wheel_prev = links->wheel_prev;
+    }
+}
+
+static void _wheel_insert(uint8_t i)
+{
+    int32_t left = (int32_t)(_vrb[i].super.arrival +
+                             CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US -
+                             _slot_start);
+    /* entries due in the current slot are checked on every garbage
+     * collection, the ones further ahead when their slot is reached */
+    unsigned ahead = (left > 0) ? MIN((uint32_t)left / SLOT_US,
+                                      WHEEL_SIZE - 1U)
+                                : 0;
+    uint8_t slot = (_slot + ahead) % WHEEL_SIZE;
+    _links_t *links = &_links[i];
+
+    links->slot = slot;
+    links->wheel_prev = NONE;
+    links->wheel_next = _wheel[slot];
+    if (_wheel[slot] != NONE) {
+        _links[_wheel[slot]].wheel_prev = i;
+    }
+    _wheel[slot] = i;
+}
+
+static void _remove(uint8_t i)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    uint8_t *link = &_fwd[_fwd_hash(vrbe->super.src, vrbe->super.src_len,
+                                    vrbe->super.tag)];
+
+    while (*link != i) {
+        assert(*link != NONE);
+        link = &_links[*link].fwd_next;
+    }
+    *link = _links[i].fwd_next;
+    link = &_rev[_rev_hash(vrbe->out_netif, vrbe->out_tag)];
+    while (*link != i) {
+        assert(*link != NONE);
+        link = &_links[*link].rev_next;
+    }
+    *link = _links[i].rev_next;
+    _wheel_remove(i);
+    _links[i].fwd_next = _free;
+    _free = i;
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
     gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    uint8_t i;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+    if (!_initialized) {
+        _init();
+    }
+    if ((i = _find(base->src, base->src_len, base->tag)) != NONE) {
+        vrbe = &_vrb[i];
+        /* _equal_index() => append intervals of `base`, so they don't get
+         * lost. We use append, so we don't need to change base! */
+        if (base->ints != NULL) {
+            gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
+            if (tmp != base->ints) {
+                /* base->ints is not already vrbe->super.ints */
+                if (tmp != NULL) {
+                    /* iterate before appending and check if `base->ints` is
+                     * not already part of list */
+                    while (tmp->next != NULL) {
+                        if (tmp == base->ints) {
+                            tmp = NULL;
+                            break;
                         }
+                        tmp = tmp->next;
                     }
-                    else {
-                        vrbe->super.ints = base->ints;
+                    if (tmp != NULL) {
+                        tmp->next = base->ints;
                     }
                 }
+                else {
+                    vrbe->super.ints = base->ints;
+                }
             }
-            break;
         }
     }
+    else if ((i = _free) != NONE) {
+        unsigned bucket;
+
+        vrbe = &_vrb[i];
+        _free = _links[i].fwd_next;
+        vrbe->super = *base;
+        vrbe->out_netif = out_netif;
+        memcpy(vrbe->super.dst, out_dst, out_dst_len);
+        vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+        vrbe->super.dst_len = out_dst_len;
+        bucket = _fwd_hash(vrbe->super.src, vrbe->super.src_len,
+                           vrbe->super.tag);
+        _links[i].fwd_next = _fwd[bucket];
+        _fwd[bucket] = i;
+        bucket = _rev_hash(out_netif, vrbe->out_tag);
+        _links[i].rev_next = _rev[bucket];
+        _rev[bucket] = i;
+        _wheel_insert(i);
+        DEBUG("6lo vrb: creating entry (%s, ",
+              gnrc_netif_addr_to_str(vrbe->super.src,
+                                     vrbe->super.src_len,
+                                     addr_str));
+        DEBUG("%s, %u, %u) => ",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str),
+              (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+        DEBUG("(%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+    }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
     if (vrbe == NULL) {
         gnrc_sixlowpan_frag_stats_get()->vrb_full++;
@@ -170,10 +337,12 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    if (_initialized) {
+        uint8_t i = _find(src, src_len, src_tag);
+
+        if (i != NONE) {
+            gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
             DEBUG("6lo vrb: got VRB to (%s, %u)\n",
                   gnrc_netif_addr_to_str(vrbe->super.dst,
                                          vrbe->super.dst_len,
@@ -192,7 +361,12 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
     DEBUG("6lo vrb: trying to get entry for reverse label switching (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+    if (!_initialized) {
+        DEBUG("6lo vrb: no entry found\n");
+        return NULL;
+    }
+    for (uint8_t i = _rev[_rev_hash(netif, tag)]; i != NONE;
+         i = _links[i].rev_next) {
         gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
 
         if ((vrbe->out_tag == tag) && (vrbe->out_netif == netif) &&
@@ -209,24 +383,70 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
 
 }
 
+void gnrc_sixlowpan_frag_vrb_set_arrival(gnrc_sixlowpan_frag_vrb_t *vrb,
+                                         uint32_t arrival)
+{
+    uint8_t i = vrb - _vrb;
+
+    assert(i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE);
+    vrb->super.arrival = arrival;
+    if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        _wheel_remove(i);
+        _wheel_insert(i);
+    }
+}
+
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        _remove(vrb - _vrb);
+    }
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
+        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
+    }
+    vrb->super.src_len = 0;
+}
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
+    uint32_t passed;
+    unsigned slot;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        if (!gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i]) &&
-            (now_usec - _vrb[i].super.arrival) > CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US) {
-            DEBUG("6lo vrb: entry (%s, ",
-                  gnrc_netif_addr_to_str(_vrb[i].super.src,
-                                         _vrb[i].super.src_len,
-                                         addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(_vrb[i].super.dst,
-                                         _vrb[i].super.dst_len,
-                                         addr_str),
-                  (unsigned)_vrb[i].super.datagram_size, _vrb[i].super.tag);
-            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+    if (!_initialized) {
+        return;
+    }
+    passed = (now_usec - _slot_start) / SLOT_US;
+    slot = _slot;
+    _slot = (_slot + passed) % WHEEL_SIZE;
+    _slot_start += passed * SLOT_US;
+    /* visit the slots passed since the last call up to the current one, but
+     * each at most once */
+    for (unsigned n = MIN(passed, WHEEL_SIZE - 1U) + 1; n > 0; n--) {
+        for (uint8_t i = _wheel[slot]; i != NONE;) {
+            uint8_t next = _links[i].wheel_next;
+
+            if (_timed_out(&_vrb[i], now_usec)) {
+                DEBUG("6lo vrb: entry (%s, ",
+                      gnrc_netif_addr_to_str(_vrb[i].super.src,
+                                             _vrb[i].super.src_len,
+                                             addr_str));
+                DEBUG("%s, %u, %u) timed out\n",
+                      gnrc_netif_addr_to_str(_vrb[i].super.dst,
+                                             _vrb[i].super.dst_len,
+                                             addr_str),
+                      (unsigned)_vrb[i].super.datagram_size,
+                      _vrb[i].super.tag);
+                gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+            }
+            else {
+                /* not due yet or arrival was updated since filing */
+                _wheel_remove(i);
+                _wheel_insert(i);
+            }
+            i = next;
         }
+        slot = (slot + 1) % WHEEL_SIZE;
     }
 }
 
@@ -234,6 +454,7 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    _initialized = false;
 }
 #endif
 
@@ -19,6 +19,8 @@
 #include <stdbool.h>
 
 #include "byteorder.h"
+#include "container.h"
+#include "macros/utils.h"
 #include "net/ipv6/hdr.h"
 #include "net/ipv6/ext.h"
 #include "net/gnrc.h"
@@ -121,6 +123,48 @@
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+/* contexts of the last flow sent, only used by the 6LoWPAN thread */
+static gnrc_sixlowpan_ctx_memo_t _src_ctx_memo;
+static gnrc_sixlowpan_ctx_memo_t _dst_ctx_memo;
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE)
+/* longest IPHC header with a UDP NHC header: dispatch, CID extension, TF,
+ * next header, hop limit, two full addresses and the NHC with both ports
+ * inline */
+#define TEMPLATE_HDR_MAX_LEN        (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + 4 + 1 + 1 + \
+                                     (2 * sizeof(ipv6_addr_t)) + 7)
+
+/* everything the compressed headers of a packet depend on, but the UDP
+ * checksum */
+typedef struct {
+    ipv6_addr_t src;
+    ipv6_addr_t dst;
+    uint32_t ctx_seq;
+    network_uint32_t v_tc_fl;
+    network_uint16_t src_port;
+    network_uint16_t dst_port;
+    kernel_pid_t iface;
+    uint8_t nh;
+    uint8_t hl;
+    uint8_t src_l2addr_len;
+    uint8_t dst_l2addr_len;
+    uint8_t src_l2addr[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint8_t dst_l2addr[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+} _template_key_t;
+
+typedef struct {
+    _template_key_t key;
+    uint8_t hdr[TEMPLATE_HDR_MAX_LEN];
+    uint8_t len;            /* 0 if unused */
+} _template_t;
+
+/* only used by the 6LoWPAN thread */
+static _template_t _templates[CONFIG_GNRC_SIXLOWPAN_IPHC_TEMPLATE_NUMOF];
+static uint8_t _template_next;
+static unsigned _template_hits;
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE) */
+
 static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 {
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -1097,7 +1141,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 
     /* check for available contexts */
     if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+        src_ctx = gnrc_sixlowpan_ctx_lookup_memo(&_src_ctx_memo, &(ipv6_hdr->src));
         /* do not use source context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
         if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
@@ -1111,7 +1155,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     }
 
     if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+        dst_ctx = gnrc_sixlowpan_ctx_lookup_memo(&_dst_ctx_memo, &(ipv6_hdr->dst));
         /* do not use destination context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
         if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
@@ -1614,6 +1658,118 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE)
+static bool _udp_snip(const gnrc_pktsnip_t *pkt)
+{
+    const gnrc_pktsnip_t *udp = pkt->next->next;
+
+    return IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_NHC) && IS_USED(MODULE_GNRC_UDP) &&
+           (udp != NULL) && (udp->type == GNRC_NETTYPE_UDP) &&
+           (udp->size >= sizeof(udp_hdr_t));
+}
+
+/* fills the template key of a packet, returns false if the headers of the
+ * packet can not be taken from a template */
+static bool _template_key(_template_key_t *key, const gnrc_pktsnip_t *pkt,
+                          const gnrc_netif_hdr_t *netif_hdr,
+                          const gnrc_netif_t *iface)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+
+    if ((pkt->next->size != sizeof(ipv6_hdr_t)) ||
+        (_compressible_nh(ipv6_hdr->nh) &&
+         ((ipv6_hdr->nh != PROTNUM_UDP) || !_udp_snip(pkt)))) {
+        /* only single IPv6 headers followed by UDP or an uncompressed next
+         * header */
+        return false;
+    }
+    /* padding is compared too */
+    memset(key, 0, sizeof(*key));
+    key->src = ipv6_hdr->src;
+    key->dst = ipv6_hdr->dst;
+    key->ctx_seq = gnrc_sixlowpan_ctx_seq();
+    key->v_tc_fl = ipv6_hdr->v_tc_fl;
+    key->iface = iface->pid;
+    key->nh = ipv6_hdr->nh;
+    key->hl = ipv6_hdr->hl;
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        const udp_hdr_t *udp_hdr = pkt->next->next->data;
+
+        key->src_port = udp_hdr->src_port;
+        key->dst_port = udp_hdr->dst_port;
+    }
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    /* the IID of the source is derived from it */
+    key->src_l2addr_len = MIN(iface->l2addr_len, sizeof(key->src_l2addr));
+    memcpy(key->src_l2addr, iface->l2addr, key->src_l2addr_len);
+#endif
+    key->dst_l2addr_len = MIN(netif_hdr->dst_l2addr_len, sizeof(key->dst_l2addr));
+    memcpy(key->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           key->dst_l2addr_len);
+    return true;
+}
+
+static const _template_t *_template_get(const _template_key_t *key)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_templates); i++) {
+        if ((_templates[i].len > 0) &&
+            (memcmp(&_templates[i].key, key, sizeof(*key)) == 0)) {
+            return &_templates[i];
+        }
+    }
+    return NULL;
+}
+
+static void _template_add(const _template_key_t *key, const uint8_t *hdr,
+                          size_t len)
+{
+    _template_t *template = &_templates[_template_next];
+
+    if ((len > sizeof(template->hdr)) || (key->ctx_seq & 1) ||
+        (key->ctx_seq != gnrc_sixlowpan_ctx_seq())) {
+        /* the contexts changed while compressing */
+        return;
+    }
+    template->key = *key;
+    memcpy(template->hdr, hdr, len);
+    template->len = len;
+    _template_next = (_template_next + 1) % ARRAY_SIZE(_templates);
+}
+
+/* writes the compressed headers of pkt from a template, returns the length
+ * of the compressed headers, 0 if there is no template, -1 on error */
+static ssize_t _template_encode(gnrc_pktsnip_t *pkt, const _template_t *template,
+                                uint8_t *iphc_hdr)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+
+    memcpy(iphc_hdr, template->hdr, template->len);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        gnrc_pktsnip_t *udp = pkt->next->next;
+        const udp_hdr_t *udp_hdr = udp->data;
+
+        /* the checksum comes last in the UDP NHC header */
+        memcpy(&iphc_hdr[template->len - sizeof(udp_hdr->checksum)],
+               &udp_hdr->checksum, sizeof(udp_hdr->checksum));
+        if (!_remove_header(pkt, udp, sizeof(udp_hdr_t))) {
+            return -1;
+        }
+    }
+#else
+    (void)ipv6_hdr;
+#endif
+    DEBUG("6lo iphc: compressed headers taken from template\n");
+    _template_hits++;
+    return template->len;
+}
+
+unsigned gnrc_sixlowpan_iphc_template_hits(void)
+{
+    return _template_hits;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE) */
+
 static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
                                     const gnrc_netif_hdr_t *netif_hdr,
                                     gnrc_netif_t *iface)
@@ -1660,6 +1816,23 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
     }
 
     iphc_hdr = dispatch->data;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE)
+    _template_key_t key;
+    bool cacheable = _template_key(&key, pkt, netif_hdr, iface);
+    const _template_t *template = (cacheable) ? _template_get(&key) : NULL;
+
+    if (template != NULL) {
+        ssize_t res = _template_encode(pkt, template, iphc_hdr);
+
+        if (res < 0) {
+            DEBUG("6lo iphc: error on compressing next header\n");
+            gnrc_pktbuf_release(dispatch);
+            return NULL;
+        }
+        inline_pos = res;
+        goto out;
+    }
+#endif
     inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
 
     if (inline_pos == 0) {
@@ -1714,6 +1887,12 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
         }
         inline_pos += local_pos;
     }
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_TEMPLATE)
+    if (cacheable) {
+        _template_add(&key, iphc_hdr, inline_pos);
+    }
+out:
 #endif
 
     /* shrink dispatch allocation to final size */
@@ -0,0 +1,634 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_dao_table
+ * @{
+ *
+ * @file
+ * @brief       RPL downward route table
+ *
+ * Routes are kept in a pool of entries linked by index. Each used entry is in
+ * the chain of its hash bucket and in the list of the wheel slot it expires
+ * in, free entries are chained through their bucket link. For every prefix
+ * length a counter of the routes with that length is kept, so lookups only
+ * probe the lengths in use, longest first.
+ *
+ * A merged route has a single expiry for all its targets, so only routes that
+ * expire in the same tick are merged. Refreshing a target of a merged route
+ * to another expiry splits it off again.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "container.h"
+#include "mutex.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/rpl/dao_table.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define NONE            (UINT16_MAX)
+#define NH_NONE         (UINT8_MAX)
+#define BUCKET_MASK     (CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS - 1)
+
+/* route was merged from two halves of its prefix */
+#define FLAG_AGGR       (0x01U)
+
+static_assert((CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS & BUCKET_MASK) == 0,
+              "CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS must be a power of two");
+static_assert(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF < NONE,
+              "CONFIG_GNRC_RPL_DAO_TABLE_NUMOF too large");
+static_assert(CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF < NH_NONE,
+              "CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF too large");
+
+typedef struct {
+    ipv6_addr_t target;     /**< prefix, bits beyond len are zero */
+    uint32_t expires;       /**< tick the route expires at */
+    uint16_t bucket_next;   /**< next entry in bucket or free list */
+    uint16_t wheel_prev;    /**< previous entry in wheel slot */
+    uint16_t wheel_next;    /**< next entry in wheel slot */
+    uint8_t len;            /**< prefix length of target */
+    uint8_t next_hop;       /**< index of next hop, NH_NONE if unused */
+    uint8_t flags;          /**< FLAG_AGGR */
+} _entry_t;
+
+typedef struct {
+    ipv6_addr_t addr;       /**< link-local address of the child */
+    kernel_pid_t iface;     /**< interface to the child */
+    uint16_t refs;          /**< routes over this next hop, 0 if unused */
+} _next_hop_t;
+
+static _entry_t _entries[CONFIG_GNRC_RPL_DAO_TABLE_NUMOF];
+static _next_hop_t _next_hops[CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF];
+static uint16_t _buckets[CONFIG_GNRC_RPL_DAO_TABLE_BUCKETS];
+static uint16_t _wheel[CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE];
+/* routes per prefix length and a bit per length with routes */
+static uint16_t _len_count[IPV6_ADDR_BIT_LEN + 1];
+static uint32_t _lens[(IPV6_ADDR_BIT_LEN / 32) + 1];
+static uint16_t _free;
+static uint16_t _used;
+static uint16_t _dropped;
+static uint32_t _now;
+static bool _initialized;
+static mutex_t _lock = MUTEX_INIT;
+
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+static void _init(void)
+{
+    /* zero-initialized memory is an empty table but for the links */
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        _entries[i].next_hop = NH_NONE;
+        _entries[i].bucket_next = (i + 1 < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF)
+                                ? i + 1 : NONE;
+    }
+    memset(_buckets, 0xff, sizeof(_buckets));
+    memset(_wheel, 0xff, sizeof(_wheel));
+    _free = 0;
+    _initialized = true;
+}
+
+static void _lock_table(void)
+{
+    mutex_lock(&_lock);
+    if (!_initialized) {
+        _init();
+    }
+}
+
+static void _prefix(ipv6_addr_t *out, const ipv6_addr_t *addr, uint8_t len)
+{
+    ipv6_addr_set_unspecified(out);
+    ipv6_addr_init_prefix(out, addr, len);
+}
+
+static unsigned _hash(const ipv6_addr_t *prefix, uint8_t len)
+{
+    uint32_t hash = prefix->u32[0].u32 ^ prefix->u32[1].u32 ^
+                    prefix->u32[2].u32 ^ prefix->u32[3].u32 ^ len;
+
+    /* Fibonacci hashing, the upper bits are mixed best */
+    return ((hash * 2654435769U) >> 16) & BUCKET_MASK;
+}
+
+/* finds a route by its prefix, which has to be zero beyond len */
+static uint16_t _find(const ipv6_addr_t *prefix, uint8_t len)
+{
+    for (uint16_t i = _buckets[_hash(prefix, len)]; i != NONE;
+         i = _entries[i].bucket_next) {
+        if ((_entries[i].len == len) &&
+            ipv6_addr_equal(&_entries[i].target, prefix)) {
+            return i;
+        }
+    }
+    return NONE;
+}
+
+/* finds the route with the longest prefix in [min_len, max_len] covering addr */
+static uint16_t _match(const ipv6_addr_t *addr, unsigned min_len,
+                       unsigned max_len)
+{
+    for (int w = ARRAY_SIZE(_lens) - 1; w >= 0; w--) {
+        uint32_t bits = _lens[w];
+
+        while (bits) {
+            unsigned bit = bitarithm_msb(bits);
+            unsigned len = (w * 32) + bit;
+
+            bits &= ~(1UL << bit);
+            if (len > max_len) {
+                continue;
+            }
+            if (len < min_len) {
+                return NONE;
+            }
+
+            ipv6_addr_t prefix;
+            _prefix(&prefix, addr, len);
+            uint16_t i = _find(&prefix, len);
+            if (i != NONE) {
+                return i;
+            }
+        }
+    }
+    return NONE;
+}
+
+static uint8_t _next_hop_get(const ipv6_addr_t *addr, kernel_pid_t iface)
+{
+    uint8_t free = NH_NONE;
+
+    for (uint8_t i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF; i++) {
+        if (_next_hops[i].refs == 0) {
+            if (free == NH_NONE) {
+                free = i;
+            }
+        }
+        else if ((_next_hops[i].iface == iface) &&
+                 ipv6_addr_equal(&_next_hops[i].addr, addr)) {
+            return i;
+        }
+    }
+    if (free != NH_NONE) {
+        _next_hops[free].addr = *addr;
+        _next_hops[free].iface = iface;
+    }
+    return free;
+}
+
+static void _wheel_remove(uint16_t i)
+{
+    _entry_t *entry = &_entries[i];
+
+    if (entry->wheel_prev != NONE) {
+        _entries[entry->wheel_prev].wheel_next = entry->wheel_next;
+    }
+    else {
+        _wheel[entry->expires % CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE] =
+            entry->wheel_next;
+    }
+    if (entry->wheel_next != NONE) {
+        _entries[entry->wheel_next].wheel_prev = entry->wheel_prev;
+    }
+}
+
+static void _wheel_insert(uint16_t i, uint32_t expires)
+{
+    uint16_t *slot = &_wheel[expires % CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE];
+
+    _entries[i].expires = expires;
+    _entries[i].wheel_prev = NONE;
+    _entries[i].wheel_next = *slot;
+    if (*slot != NONE) {
+        _entries[*slot].wheel_prev = i;
+    }
+    *slot = i;
+}
+
+static uint32_t _expires(uint32_t ltime)
+{
+    uint32_t ticks = (ltime + CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC - 1) /
+                     CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC;
+
+    return _now + ((ticks > 0) ? ticks : 1);
+}
+
+static uint16_t _insert(const ipv6_addr_t *prefix, uint8_t len, uint8_t nh,
+                        uint32_t expires, uint8_t flags)
+{
+    uint16_t i = _free;
+
+    if (i == NONE) {
+        return NONE;
+    }
+    _free = _entries[i].bucket_next;
+
+    _entry_t *entry = &_entries[i];
+    unsigned bucket = _hash(prefix, len);
+
+    entry->target = *prefix;
+    entry->len = len;
+    entry->next_hop = nh;
+    entry->flags = flags;
+    entry->bucket_next = _buckets[bucket];
+    _buckets[bucket] = i;
+    _wheel_insert(i, expires);
+    _next_hops[nh].refs++;
+    if (_len_count[len]++ == 0) {
+        _lens[len / 32] |= 1UL << (len % 32);
+    }
+    _used++;
+    return i;
+}
+
+static void _remove(uint16_t i)
+{
+    _entry_t *entry = &_entries[i];
+    uint16_t *link = &_buckets[_hash(&entry->target, entry->len)];
+
+    while (*link != i) {
+        assert(*link != NONE);
+        link = &_entries[*link].bucket_next;
+    }
+    *link = entry->bucket_next;
+    _wheel_remove(i);
+    _next_hops[entry->next_hop].refs--;
+    if (--_len_count[entry->len] == 0) {
+        _lens[entry->len / 32] &= ~(1UL << (entry->len % 32));
+    }
+    entry->next_hop = NH_NONE;
+    entry->bucket_next = _free;
+    _free = i;
+    _used--;
+}
+
+static void _set_expires(uint16_t i, uint32_t expires)
+{
+    _wheel_remove(i);
+    _wheel_insert(i, expires);
+}
+
+static void _buddy(ipv6_addr_t *out, const ipv6_addr_t *prefix, uint8_t len)
+{
+    *out = *prefix;
+    out->u8[(len - 1) / 8] ^= 0x80 >> ((len - 1) % 8);
+}
+
+/* merges a route with the other half of its parent prefix while possible */
+static void _aggregate(uint16_t i)
+{
+    while (_entries[i].len > CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN) {
+        _entry_t *entry = &_entries[i];
+        ipv6_addr_t buddy;
+
+        _buddy(&buddy, &entry->target, entry->len);
+
+        /* a target must not be kept alive by the refreshes of another one */
+        uint16_t j = _find(&buddy, entry->len);
+        if ((j == NONE) || (_entries[j].next_hop != entry->next_hop) ||
+            (_entries[j].expires != entry->expires)) {
+            return;
+        }
+
+        ipv6_addr_t prefix;
+        uint8_t len = entry->len - 1;
+        uint8_t nh = entry->next_hop;
+        uint32_t expires = entry->expires;
+
+        _prefix(&prefix, &entry->target, len);
+        DEBUG("rpl dao table: merge into %s/%u\n",
+              ipv6_addr_to_str(addr_str, &prefix, sizeof(addr_str)), len);
+        /* keep the next hop referenced while both halves are gone */
+        _next_hops[nh].refs++;
+        _remove(i);
+        _remove(j);
+        i = _insert(&prefix, len, nh, expires, FLAG_AGGR);
+        _next_hops[nh].refs--;
+        assert(i != NONE);
+    }
+}
+
+/* removes the target prefix/len from the merged route i, keeping the rest
+ * of the merged route, and leaves at least reserve entries free. Fails without
+ * changing anything if the table has not enough space */
+static int _split(uint16_t i, const ipv6_addr_t *target, uint8_t len,
+                  unsigned reserve)
+{
+    _entry_t *entry = &_entries[i];
+    uint8_t nh = entry->next_hop;
+    uint8_t merged_len = entry->len;
+    uint32_t expires = entry->expires;
+
+    /* the merged route is replaced by one route for each bit of the target
+     * prefix beyond merged_len */
+    if ((CONFIG_GNRC_RPL_DAO_TABLE_NUMOF - _used) + 1U <
+        (unsigned)(len - merged_len) + reserve) {
+        DEBUG("rpl dao table: no space to split\n");
+        return -ENOMEM;
+    }
+    DEBUG("rpl dao table: split %s/%u\n",
+          ipv6_addr_to_str(addr_str, &entry->target, sizeof(addr_str)),
+          merged_len);
+    /* keep the next hop referenced while the merged route is gone, the
+     * entry itself is reused by the first half inserted below */
+    _next_hops[nh].refs++;
+    _remove(i);
+    for (uint8_t l = merged_len + 1; l <= len; l++) {
+        ipv6_addr_t prefix, buddy;
+
+        _prefix(&prefix, target, l);
+        _buddy(&buddy, &prefix, l);
+        uint16_t j = _insert(&buddy, l, nh, expires,
+                             (l < IPV6_ADDR_BIT_LEN) ? FLAG_AGGR : 0);
+        (void)j;
+        assert(j != NONE);
+    }
+    _next_hops[nh].refs--;
+    return 0;
+}
+
+/* finds the route other than keep that expires first, the table is only
+ * searched when it is full, so a scan of the pool is good enough */
+static uint16_t _soonest(uint16_t keep)
+{
+    uint16_t res = NONE;
+
+    for (uint16_t i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        if ((i == keep) || (_entries[i].next_hop == NH_NONE)) {
+            continue;
+        }
+        if ((res == NONE) ||
+            ((_entries[i].expires - _now) < (_entries[res].expires - _now))) {
+            res = i;
+        }
+    }
+    return res;
+}
+
+/* removes the target prefix/len from the merged route i, keeping the rest
+ * of the merged route. If there is no space to split it, the routes expiring
+ * first are evicted, as the other targets of the merged route are still
+ * valid. Fails without changing anything if the table is too small */
+static int _split_or_evict(uint16_t i, const ipv6_addr_t *target, uint8_t len,
+                           unsigned reserve)
+{
+    if (CONFIG_GNRC_RPL_DAO_TABLE_NUMOF <
+        (unsigned)(len - _entries[i].len) + reserve) {
+        return -ENOMEM;
+    }
+    while (_split(i, target, len, reserve) < 0) {
+        uint16_t j = _soonest(i);
+
+        assert(j != NONE);
+        DEBUG("rpl dao table: evict %s/%u\n",
+              ipv6_addr_to_str(addr_str, &_entries[j].target, sizeof(addr_str)),
+              _entries[j].len);
+        _remove(j);
+        _dropped++;
+    }
+    return 0;
+}
+
+/* finds a merged route covering target/len */
+static uint16_t _merged(const ipv6_addr_t *target, uint8_t len)
+{
+    if (len <= CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN) {
+        return NONE;
+    }
+
+    uint16_t i = _match(target, CONFIG_GNRC_RPL_DAO_TABLE_AGGR_MIN_LEN,
+                        len - 1);
+
+    return ((i != NONE) && (_entries[i].flags & FLAG_AGGR)) ? i : NONE;
+}
+
+static void _del(const ipv6_addr_t *prefix, uint8_t len)
+{
+    uint16_t i = _find(prefix, len);
+
+    if (i != NONE) {
+        _remove(i);
+    }
+    else if ((i = _merged(prefix, len)) == NONE) {
+        return;
+    }
+    else if (_split_or_evict(i, prefix, len, 0) < 0) {
+        /* the target expires with the merged route */
+        _dropped++;
+        return;
+    }
+    gnrc_ipv6_nib_changed();
+}
+
+int gnrc_rpl_dao_table_add(const ipv6_addr_t *target, uint8_t len,
+                           const ipv6_addr_t *next_hop, kernel_pid_t iface,
+                           uint32_t ltime)
+{
+    ipv6_addr_t prefix;
+    int res = 0;
+
+    assert(len <= IPV6_ADDR_BIT_LEN);
+    _prefix(&prefix, target, len);
+    _lock_table();
+    if (ltime == 0) {
+        _del(&prefix, len);
+        goto out;
+    }
+
+    uint8_t nh = _next_hop_get(next_hop, iface);
+    if (nh == NH_NONE) {
+        DEBUG("rpl dao table: no space for next hop\n");
+        res = -ENOMEM;
+        goto out;
+    }
+
+    uint32_t expires = _expires(ltime);
+    uint16_t i = _find(&prefix, len);
+
+    if (i == NONE) {
+        uint16_t merged = _merged(&prefix, len);
+
+        if (merged != NONE) {
+            if (_entries[merged].next_hop != nh) {
+                /* the target moved to another child */
+                if (_split_or_evict(merged, &prefix, len, 1) < 0) {
+                    _dropped++;
+                    res = -ENOMEM;
+                    goto out;
+                }
+            }
+            else if (_entries[merged].expires == expires) {
+                /* the target is part of a merged route already */
+                goto out;
+            }
+            else if (_split(merged, &prefix, len, 1) < 0) {
+                /* the route of the target expires early, the next refresh
+                 * may find space again */
+                _dropped++;
+                res = -ENOMEM;
+                goto out;
+            }
+            /* else: the target is split off to keep its own expiry, the
+             * rest of the merged route is routed as before */
+        }
+        if ((i = _insert(&prefix, len, nh, expires, 0)) == NONE) {
+            DEBUG("rpl dao table: table full\n");
+            _dropped++;
+            res = -ENOMEM;
+            goto out;
+        }
+    }
+    else if (_entries[i].next_hop == nh) {
+        /* the route stays the same, only its lifetime changes, which may
+         * allow to merge it with a route refreshed in the same tick */
+        _set_expires(i, expires);
+        _aggregate(i);
+        goto out;
+    }
+    else {
+        _next_hops[_entries[i].next_hop].refs--;
+        _next_hops[nh].refs++;
+        _entries[i].next_hop = nh;
+        _set_expires(i, expires);
+    }
+    _aggregate(i);
+    gnrc_ipv6_nib_changed();
+out:
+    mutex_unlock(&_lock);
+    return res;
+}
+
+void gnrc_rpl_dao_table_del(const ipv6_addr_t *target, uint8_t len)
+{
+    ipv6_addr_t prefix;
+
+    assert(len <= IPV6_ADDR_BIT_LEN);
+    _prefix(&prefix, target, len);
+    _lock_table();
+    _del(&prefix, len);
+    mutex_unlock(&_lock);
+}
+
+void gnrc_rpl_dao_table_flush(kernel_pid_t iface)
+{
+    bool changed = false;
+
+    _lock_table();
+    for (uint16_t i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        if ((_entries[i].next_hop != NH_NONE) &&
+            ((iface == 0) || (_next_hops[_entries[i].next_hop].iface == iface))) {
+            _remove(i);
+            changed = true;
+        }
+    }
+    if (changed) {
+        gnrc_ipv6_nib_changed();
+    }
+    mutex_unlock(&_lock);
+}
+
+static void _get(uint16_t i, gnrc_ipv6_nib_ft_t *fte)
+{
+    const _next_hop_t *nh = &_next_hops[_entries[i].next_hop];
+
+    fte->dst = _entries[i].target;
+    fte->dst_len = _entries[i].len;
+    fte->next_hop = nh->addr;
+    fte->iface = nh->iface;
+    fte->primary = 0;
+}
+
+bool gnrc_rpl_dao_table_get_route(const ipv6_addr_t *dst, unsigned min_len,
+                                  gnrc_ipv6_nib_ft_t *fte)
+{
+    bool res = false;
+
+    _lock_table();
+    uint16_t i = _match(dst, min_len, IPV6_ADDR_BIT_LEN);
+    if (i != NONE) {
+        _get(i, fte);
+        res = true;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+bool gnrc_rpl_dao_table_iter(void **state, gnrc_ipv6_nib_ft_t *fte)
+{
+    uintptr_t i = (uintptr_t)*state;
+    bool res = false;
+
+    _lock_table();
+    for (; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        if (_entries[i].next_hop != NH_NONE) {
+            _get(i, fte);
+            res = true;
+            i++;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    *state = (void *)i;
+    return res;
+}
+
+unsigned gnrc_rpl_dao_table_tick(void)
+{
+    bool changed = false;
+    unsigned used;
+
+    _lock_table();
+    _now++;
+    for (uint16_t i = _wheel[_now % CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE];
+         i != NONE;) {
+        uint16_t next = _entries[i].wheel_next;
+
+        /* the slot also holds routes due in later turns of the wheel */
+        if ((int32_t)(_entries[i].expires - _now) <= 0) {
+            DEBUG("rpl dao table: %s/%u expired\n",
+                  ipv6_addr_to_str(addr_str, &_entries[i].target,
+                                   sizeof(addr_str)), _entries[i].len);
+            _remove(i);
+            changed = true;
+        }
+        i = next;
+    }
+    if (changed) {
+        gnrc_ipv6_nib_changed();
+    }
+    used = _used;
+    mutex_unlock(&_lock);
+    return used;
+}
+
+void gnrc_rpl_dao_table_stats(gnrc_rpl_dao_table_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->size = sizeof(_entries) + sizeof(_next_hops) + sizeof(_buckets) +
+                  sizeof(_wheel) + sizeof(_len_count) + sizeof(_lens);
+    stats->numof = CONFIG_GNRC_RPL_DAO_TABLE_NUMOF;
+    _lock_table();
+    stats->used = _used;
+    stats->dropped = _dropped;
+    for (uint16_t i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        if ((_entries[i].next_hop != NH_NONE) &&
+            (_entries[i].flags & FLAG_AGGR)) {
+            stats->aggregated++;
+        }
+    }
+    for (uint8_t i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF; i++) {
+        if (_next_hops[i].refs > 0) {
+            stats->next_hops++;
+        }
+    }
+    mutex_unlock(&_lock);
+}
@@ -37,6 +37,9 @@
 #include "gnrc_rpl_internal/globals.h"
 
 #include "net/gnrc/rpl.h"
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+#include "net/gnrc/rpl/dao_table.h"
+#endif
 #include "net/gnrc/rpl/rpble.h"
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p.h"
@@ -66,6 +69,11 @@ static gnrc_netreg_entry_t _me_icmpv6_reg;
 static gnrc_netreg_entry_t _me_routing_reg;
 #endif /* MODULE_GNRC_NETAPI_NOTIFY*/
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+static evtimer_msg_event_t _dao_table_tick;
+static bool _dao_table_tick_pending;
+#endif
+
 static mutex_t _inst_id_mutex = MUTEX_INIT;
 static uint8_t _instance_id;
 
@@ -394,6 +402,15 @@ static void *_event_loop(void *args)
                 instance = msg.content.ptr;
                 _dodag_float_timeout(&instance->dodag);
                 break;
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+            case GNRC_RPL_MSG_TYPE_DAO_TABLE_TICK:
+                DEBUG("RPL: GNRC_RPL_MSG_TYPE_DAO_TABLE_TICK received\n");
+                _dao_table_tick_pending = false;
+                if (gnrc_rpl_dao_table_tick() > 0) {
+                    gnrc_rpl_dao_table_tick_start();
+                }
+                break;
+#endif
             case GNRC_RPL_MSG_TYPE_TRICKLE_MSG:
                 DEBUG("RPL: GNRC_RPL_MSG_TYPE_TRICKLE_MSG received\n");
                 trickle = msg.content.ptr;
@@ -438,6 +455,20 @@ void _update_lifetime(void)
 }
 #endif
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+void gnrc_rpl_dao_table_tick_start(void)
+{
+    if (_dao_table_tick_pending) {
+        return;
+    }
+    ((evtimer_event_t *)&_dao_table_tick)->offset =
+        CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC * MS_PER_SEC;
+    _dao_table_tick.msg.type = GNRC_RPL_MSG_TYPE_DAO_TABLE_TICK;
+    evtimer_add_msg(&gnrc_rpl_evtimer, &_dao_table_tick, gnrc_rpl_pid);
+    _dao_table_tick_pending = true;
+}
+#endif
+
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
@@ -42,6 +42,9 @@
 #endif
 
 #include "net/gnrc/rpl.h"
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+#include "net/gnrc/rpl/dao_table.h"
+#endif
 #include "gnrc_rpl_internal/validation.h"
 
 #ifdef MODULE_GNRC_RPL_P2P
@@ -510,6 +513,22 @@ static inline char *_ip_addr_str(ipv6_addr_t *addr)
     return ipv6_addr_to_str(addr_str, addr, sizeof(addr_str));
 }
 
+static void _add_route(gnrc_rpl_dodag_t *dodag, ipv6_addr_t *target, uint8_t len,
+                       ipv6_addr_t *next_hop, uint32_t ltime)
+{
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+    if (gnrc_rpl_dao_table_add(target, len, next_hop, dodag->iface, ltime) == 0) {
+        gnrc_rpl_dao_table_tick_start();
+    }
+    else {
+        DEBUG("RPL: no space left in downward route table\n");
+    }
+#else
+    gnrc_ipv6_nib_ft_del(target, len);
+    gnrc_ipv6_nib_ft_add(target, len, next_hop, dodag->iface, ltime);
+#endif
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt,
                            uint16_t len,
@@ -639,10 +658,8 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
             DEBUG("RPL: adding FT entry %s/%d\n", _ip_addr_str(&(target->target)),
                   target->prefix_length);
 
-            gnrc_ipv6_nib_ft_del(&(target->target), target->prefix_length);
-            gnrc_ipv6_nib_ft_add(&(target->target), target->prefix_length, src,
-                                 dodag->iface,
-                                 dodag->default_lifetime * dodag->lifetime_unit);
+            _add_route(dodag, &(target->target), target->prefix_length, src,
+                       dodag->default_lifetime * dodag->lifetime_unit);
             break;
 
         case (GNRC_RPL_OPT_TRANSIT):
@@ -660,12 +677,9 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
                 DEBUG("RPL: updating FT entry %s/%d\n", _ip_addr_str(&(first_target->target)),
                       first_target->prefix_length);
 
-                gnrc_ipv6_nib_ft_del(&(first_target->target),
-                                     first_target->prefix_length);
-                gnrc_ipv6_nib_ft_add(&(first_target->target),
-                                     first_target->prefix_length, src,
-                                     dodag->iface,
-                                     transit->path_lifetime * dodag->lifetime_unit);
+                _add_route(dodag, &(first_target->target),
+                           first_target->prefix_length, src,
+                           transit->path_lifetime * dodag->lifetime_unit);
 
                 first_target = (gnrc_rpl_opt_target_t *)(((uint8_t *)(first_target)) +
                                                          sizeof(gnrc_rpl_opt_t) +
@@ -1129,6 +1143,29 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
         }
     }
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+    /* add targets of the sub-DODAG */
+    ft_state = NULL;
+    while (gnrc_rpl_dao_table_iter(&ft_state, &fte)) {
+        if (fte.iface != dodag->iface) {
+            continue;
+        }
+        DEBUG("RPL: Send DAO - building transit option\n");
+
+        if ((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            return;
+        }
+        DEBUG("RPL: Send DAO - building target %s/%d\n",
+              _ip_addr_str(&fte.dst), fte.dst_len);
+
+        if ((pkt = _dao_target_build(pkt, &fte.dst, fte.dst_len)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            return;
+        }
+    }
+#endif
+
     /* add own address */
     DEBUG("RPL: Send DAO - building target %s/128\n", _ip_addr_str(me));
     if ((pkt = _dao_target_build(pkt, me, IPV6_ADDR_BIT_LEN)) == NULL) {
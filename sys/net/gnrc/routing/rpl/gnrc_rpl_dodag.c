@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl/dao_table.h"
 #include "net/gnrc/rpl/dodag.h"
 #include "net/gnrc/rpl/structs.h"
 #include "gnrc_rpl_internal/globals.h"
@@ -135,10 +136,32 @@ bool gnrc_rpl_instance_remove_by_id(uint8_t instance_id)
     return false;
 }
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+/* the downward route table does not know the DODAG a route was learned in,
+ * so the routes over an interface are removed with the last DODAG on it */
+static void _dao_table_flush(gnrc_rpl_dodag_t *dodag)
+{
+    if (dodag->iface == KERNEL_PID_UNDEF) {
+        return;
+    }
+    for (uint8_t i = 0; i < GNRC_RPL_INSTANCES_NUMOF; ++i) {
+        if ((gnrc_rpl_instances[i].state != 0) &&
+            (&gnrc_rpl_instances[i].dodag != dodag) &&
+            (gnrc_rpl_instances[i].dodag.iface == dodag->iface)) {
+            return;
+        }
+    }
+    gnrc_rpl_dao_table_flush(dodag->iface);
+}
+#endif
+
 void gnrc_rpl_dodag_remove(gnrc_rpl_dodag_t *dodag)
 {
 #ifdef MODULE_GNRC_RPL_P2P
     gnrc_rpl_p2p_ext_remove(dodag);
+#endif
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE)
+    _dao_table_flush(dodag);
 #endif
     gnrc_rpl_dodag_remove_all_parents(dodag);
     trickle_stop(&dodag->trickle);
@@ -19,6 +19,7 @@
  */
 
 #include "evtimer.h"
+#include "modules.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,8 +50,21 @@ extern evtimer_msg_t gnrc_rpl_evtimer;
  * @brief   Message type for floating DODAG timeouts.
  */
 #define GNRC_RPL_MSG_TYPE_DODAG_FLOAT_TIMEOUT  (0x0907)
+/**
+ * @brief   Message type for advancing the downward route table.
+ */
+#define GNRC_RPL_MSG_TYPE_DAO_TABLE_TICK      (0x0908)
 /** @} */
 
+#if IS_USED(MODULE_GNRC_RPL_DAO_TABLE) || defined(DOXYGEN)
+/**
+ * @brief   Starts advancing the downward route table, if not started yet.
+ *
+ * Stops by itself when the table is empty.
+ */
+void gnrc_rpl_dao_table_tick_start(void);
+#endif
+
 /**
  * @brief   Interval in milliseconds to probe a parent with DIS messages.
  */
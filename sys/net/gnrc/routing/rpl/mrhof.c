@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function.
+ *
+ * Implementation of MRHOF (RFC 6719) with the ETX metric. No DAG metric
+ * container is exchanged, so the rank a parent advertises is used as its path
+ * cost (RFC 6719, section 3.5). The ETX of the link to a parent is taken from
+ * the neighbor statistics of the interface, which are kept in the same fixed
+ * point format (ETX * 128) as the RPL ETX metric.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "mrhof.h"
+#include "of0.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* RFC 6551, section 6.1 */
+#define ROUTING_MCT_ETX         (7U)
+#define DEFAULT_LINK_METRIC     (NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR)
+
+static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static int which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dio_t *);
+static void reset(gnrc_rpl_dodag_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    .ocp = 0x1,
+    .calc_rank = calc_rank,
+    .parent_cmp = parent_cmp,
+    .which_dodag = which_dodag,
+    .reset = reset,
+    .parent_state_callback = NULL,
+    .init = NULL,
+    .process_dio = NULL
+};
+
+/* preferred parent of each instance, the hysteresis applies to it */
+static ipv6_addr_t _preferred[GNRC_RPL_INSTANCES_NUMOF];
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+static ipv6_addr_t *_preferred_of(gnrc_rpl_dodag_t *dodag)
+{
+    return &_preferred[dodag->instance - gnrc_rpl_instances];
+}
+
+static int _get_l2addr(gnrc_netif_t *netif, const ipv6_addr_t *addr,
+                       uint8_t *l2addr)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    void *state = NULL;
+
+    while (gnrc_ipv6_nib_nc_iter(netif->pid, &state, &nce)) {
+        if ((nce.l2addr_len > 0) && ipv6_addr_equal(&nce.ipv6, addr)) {
+            memcpy(l2addr, nce.l2addr, nce.l2addr_len);
+            return nce.l2addr_len;
+        }
+    }
+    if (ipv6_addr_is_link_local(addr)) {
+        /* parents are addressed by a link-local address mostly derived from
+         * their L2 address, so it is known without neighbor cache entry */
+        return gnrc_netif_ipv6_iid_to_addr(netif, (const eui64_t *)&addr->u64[1],
+                                           l2addr);
+    }
+    return -ENOENT;
+}
+
+static void _update_link_metric(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+    netstats_nb_t stats;
+    int l2addr_len;
+
+    if (netif != NULL) {
+        l2addr_len = _get_l2addr(netif, &parent->addr, l2addr);
+        if ((l2addr_len > 0) &&
+            netstats_nb_get(&netif->netif, l2addr, l2addr_len, &stats) &&
+            (stats.etx > 0)) {
+            parent->link_metric = stats.etx;
+            parent->link_metric_type = ROUTING_MCT_ETX;
+            return;
+        }
+    }
+    /* keep the last known metric, nothing was sent to the parent yet */
+    if (parent->link_metric_type != ROUTING_MCT_ETX) {
+        parent->link_metric = DEFAULT_LINK_METRIC;
+        parent->link_metric_type = ROUTING_MCT_ETX;
+    }
+}
+
+static uint16_t _path_cost(gnrc_rpl_parent_t *parent)
+{
+    _update_link_metric(parent);
+
+    /* RFC 6719, section 3.2.2 */
+    if ((parent->rank == GNRC_RPL_INFINITE_RANK) ||
+        (parent->link_metric > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC)) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    uint32_t cost = (uint32_t)parent->rank + parent->link_metric;
+
+    if (cost > CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return cost;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    *_preferred_of(dodag) = ipv6_addr_unspecified;
+}
+
+uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
+{
+    uint16_t cost;
+
+    if (base_rank == 0) {
+        if (dodag->parents == NULL) {
+            reset(dodag);
+            return GNRC_RPL_INFINITE_RANK;
+        }
+
+        /* called right after the parents were sorted, so this is the
+         * preferred parent from now on */
+        *_preferred_of(dodag) = dodag->parents->addr;
+        cost = _path_cost(dodag->parents);
+        if (cost == GNRC_RPL_INFINITE_RANK) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+        base_rank = dodag->parents->rank;
+    }
+    else {
+        cost = 0;
+    }
+
+    uint16_t add;
+
+    if (dodag->parents != NULL) {
+        add = dodag->instance->min_hop_rank_inc;
+    }
+    else {
+        add = CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE;
+    }
+
+    if ((uint16_t)(base_rank + add) < base_rank) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    /* RFC 6719, section 3.3 */
+    return (cost > base_rank + add) ? cost : base_rank + add;
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    uint32_t cost1 = _path_cost(parent1);
+    uint32_t cost2 = _path_cost(parent2);
+    ipv6_addr_t *preferred = _preferred_of(parent1->dodag);
+
+    /* RFC 6719, section 3.2.2: only switch to a parent that is better than
+     * the preferred parent by at least PARENT_SWITCH_THRESHOLD */
+    if (ipv6_addr_equal(&parent1->addr, preferred)) {
+        cost1 = (cost1 > CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD)
+              ? cost1 - CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD : 0;
+    }
+    else if (ipv6_addr_equal(&parent2->addr, preferred)) {
+        cost2 = (cost2 > CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD)
+              ? cost2 - CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD : 0;
+    }
+
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+int which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dio_t *dio)
+{
+    /* RFC 6719, section 3.2.3: no metric container to compare the path
+     * costs with, so fall back to the rules of OF0 */
+    return gnrc_rpl_get_of0()->which_dodag(d1, dio);
+}
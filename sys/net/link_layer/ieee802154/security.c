@@ -21,6 +21,7 @@
 #include "crypto/ciphers.h"
 #include "crypto/modes/ecb.h"
 #include "crypto/modes/cbc.h"
+#include "macros/math.h"
 #include "net/ieee802154_security.h"
 
 const ieee802154_radio_cipher_ops_t ieee802154_radio_cipher_ops = {
@@ -389,6 +390,85 @@ static void _ctr_mic(ieee802154_sec_context_t *ctx,
     _ecb(ctx, tmp1, tmp2, mic, (uint8_t *)A0, mic_size);
 }
 
+/**
+ * @brief   Get the precomputed keystream for the frame to encrypt next
+ *
+ * @return  The encrypted counter blocks A0, A1, ... one after another
+ * @return  NULL, if there is no keystream for the frame
+ */
+static const uint8_t *_keystream(const ieee802154_sec_context_t *ctx,
+                                 const uint8_t *key,
+                                 const uint8_t *src_address,
+                                 uint16_t m_len)
+{
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM)
+    const ieee802154_sec_keystream_t *ks = &ctx->keystream;
+    uint8_t numof = 1;
+
+    if (_req_encryption(ctx->security_level)) {
+        numof += DIV_ROUND_UP(m_len, IEEE802154_SEC_BLOCK_SIZE);
+    }
+    if ((ks->numof >= numof) &&
+        (ks->frame_counter == ctx->frame_counter) &&
+        (ks->security_level == ctx->security_level) &&
+        (memcmp(ks->src_addr, src_address, sizeof(ks->src_addr)) == 0) &&
+        (memcmp(ks->key, key, sizeof(ks->key)) == 0)) {
+        return ks->blocks[0];
+    }
+#else
+    (void)ctx;
+    (void)key;
+    (void)src_address;
+    (void)m_len;
+#endif
+    return NULL;
+}
+
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM)
+void ieee802154_sec_precompute(ieee802154_sec_context_t *ctx,
+                               const uint8_t *src_address)
+{
+    ieee802154_sec_keystream_t *ks = &ctx->keystream;
+    ieee802154_sec_ccm_block_t A[IEEE802154_SEC_KEYSTREAM_BLOCKS];
+    const uint8_t *key;
+    uint8_t numof;
+
+    if (_req_encryption(ctx->security_level)) {
+        numof = IEEE802154_SEC_KEYSTREAM_BLOCKS;
+    }
+    else if (_req_mac(ctx->security_level)) {
+        numof = 1;
+    }
+    else {
+        return;
+    }
+    if ((ctx->frame_counter == 0xFFFFFFFF) ||
+        !(key = _get_encryption_key(ctx, NULL, 0, NULL)) ||
+        (_keystream(ctx, key, src_address,
+                    (numof - 1) * IEEE802154_SEC_BLOCK_SIZE) != NULL)) {
+        return;
+    }
+    _set_key(ctx, key);
+    _init_ctr_A0(&A[0], ctx->frame_counter, ctx->security_level, src_address);
+    for (unsigned i = 1; i < numof; i++) {
+        A[i] = A[i - 1];
+        _advance_ctr_Ai(&A[i]);
+    }
+    /* all blocks in one go, hardware ciphers may be faster that way */
+    if (ctx->dev.cipher_ops->ecb) {
+        ctx->dev.cipher_ops->ecb(&ctx->dev, ks->blocks[0], (uint8_t *)A, numof);
+    }
+    else {
+        _sec_ecb(&ctx->dev, ks->blocks[0], (uint8_t *)A, numof);
+    }
+    memcpy(ks->key, key, sizeof(ks->key));
+    memcpy(ks->src_addr, src_address, sizeof(ks->src_addr));
+    ks->frame_counter = ctx->frame_counter;
+    ks->security_level = ctx->security_level;
+    ks->numof = numof;
+}
+#endif
+
 void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
 {
     /* device driver can override this */
@@ -401,6 +481,9 @@ void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
     memset(ctx->key_source, 0, sizeof(ctx->key_source));
     ctx->key_index = 0;
     ctx->frame_counter = 0;
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEYSTREAM)
+    ctx->keystream.numof = 0;
+#endif
     uint8_t key[] = CONFIG_IEEE802154_SEC_DEFAULT_KEY;
     assert(sizeof(key) >= IEEE802154_SEC_KEY_LENGTH);
     assert(CIPHER_MAX_CONTEXT_SIZE >= IEEE802154_SEC_KEY_LENGTH);
@@ -445,6 +528,7 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
     uint16_t a_len = *header_size + aux_size;
     uint16_t m_len = payload_size;
     ieee802154_sec_ccm_block_t ccm; /* Ai or Bi */
+    const uint8_t *ks = _keystream(ctx, key, src_address, m_len);
 
     /* compute MIC */
     if (_req_mac(ctx->security_level)) {
@@ -452,13 +536,23 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
         _comp_mic(ctx, mic, &ccm, a, a_len, m, m_len);
 
         /* encrypt MIC */
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
-        _ctr_mic(ctx, &ccm, mic, *mic_size);
+        if (ks) {
+            _memxor(mic, ks, *mic_size);
+        }
+        else {
+            _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
+            _ctr_mic(ctx, &ccm, mic, *mic_size);
+        }
     }
     /* encrypt payload */
     if (_req_encryption(ctx->security_level)) {
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
-        _ctr(ctx, &ccm, m, m_len);
+        if (ks) {
+            _memxor(m, ks + IEEE802154_SEC_BLOCK_SIZE, m_len);
+        }
+        else {
+            _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
+            _ctr(ctx, &ccm, m, m_len);
+        }
     }
     *header_size += aux_size;
     ctx->frame_counter++;
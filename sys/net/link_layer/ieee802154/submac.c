@@ -292,6 +292,10 @@ static ieee802154_fsm_state_t _fsm_state_prepare(ieee802154_submac_t *submac,
         }
 
         while (ieee802154_radio_request_transmit(dev) == -EBUSY) {}
+        if ((ftype == IEEE802154_FCF_TYPE_DATA) && submac->cb->tx_pending &&
+            (_does_handle_ack(dev) || !submac->wait_for_ack)) {
+            submac->cb->tx_pending(submac);
+        }
         return IEEE802154_FSM_STATE_TX;
     case IEEE802154_FSM_EV_RX_DONE:
     case IEEE802154_FSM_EV_CRC_ERROR:
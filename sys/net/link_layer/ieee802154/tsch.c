@@ -0,0 +1,918 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "container.h"
+#include "macros/utils.h"
+#include "random.h"
+
+#include "net/ieee802154/tsch.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+/* preamble, SFD and PHY header of the 2.4 GHz O-QPSK PHY */
+#define PHY_OVERHEAD            (6U)
+#define BYTE_TIME_US            (2U * IEEE802154_SYMBOL_TIME_US)
+
+/* queue index of an EB sent in the current slot */
+#define FRAME_EB                (IEEE802154_TSCH_NONE - 1)
+
+/* IE descriptors, IEEE 802.15.4-2015, section 7.4 */
+#define IE_TYPE_PAYLOAD         (0x8000)
+#define IE_HDR_LEN_MASK         (0x007f)
+#define IE_HDR_ID(desc)         (((desc) >> 7) & 0xff)
+#define IE_HDR_ID_HT1           (0x7e)
+#define IE_HDR_ID_HT2           (0x7f)
+#define IE_PAYLOAD_LEN_MASK     (0x07ff)
+#define IE_PAYLOAD_GROUP(desc)  (((desc) >> 11) & 0xf)
+#define IE_PAYLOAD_GROUP_MLME   (0x1)
+#define IE_PAYLOAD_GROUP_PT     (0xf)
+#define IE_SUB_LONG             (0x8000)
+#define IE_SUB_SHORT_LEN_MASK   (0x00ff)
+#define IE_SUB_SHORT_ID(desc)   (((desc) >> 8) & 0x7f)
+#define IE_SUB_LONG_LEN_MASK    (0x07ff)
+#define IE_SUB_ID_TSCH_SYNC     (0x1a)
+#define IE_TSCH_SYNC_LEN        (6U)
+
+#define ASN_LEN                 (5U)
+
+enum {
+    SLOT_IDLE,          /* no active slot in the schedule */
+    SLOT_WAIT,          /* waiting for the next active slot */
+    SLOT_TX_OFFSET,     /* frame written, waiting for macTsTxOffset */
+    SLOT_TX,            /* sending the frame */
+    SLOT_ACK_WAIT,      /* listening for the ACK */
+    SLOT_RX_OFFSET,     /* waiting for macTsRxOffset */
+    SLOT_RX,            /* listening for a frame */
+    SLOT_ACK_DELAY,     /* ACK written, waiting for macTsTxAckDelay */
+    SLOT_ACK_TX,        /* sending the ACK */
+};
+
+static const uint8_t _hopping_seq[] = CONFIG_IEEE802154_TSCH_HOPPING_SEQUENCE;
+
+static inline uint32_t _now(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static inline uint32_t _airtime(size_t psdu_len)
+{
+    return (psdu_len + IEEE802154_FCS_LEN + PHY_OVERHEAD) * BYTE_TIME_US;
+}
+
+static inline uint32_t _eb_period(void)
+{
+    return random_uint32_range(CONFIG_IEEE802154_TSCH_EB_PERIOD_MS * 750U,
+                               CONFIG_IEEE802154_TSCH_EB_PERIOD_MS * 1250U);
+}
+
+static inline void _put_u16(uint8_t *buf, uint16_t val)
+{
+    buf[0] = val & 0xff;
+    buf[1] = val >> 8;
+}
+
+static inline uint16_t _get_u16(const uint8_t *buf)
+{
+    return buf[0] | (buf[1] << 8);
+}
+
+static void _timer_cb(void *arg)
+{
+    ieee802154_tsch_bh_request(arg);
+}
+
+static void _set_timer(ieee802154_tsch_t *tsch, uint32_t at)
+{
+    int32_t wait = (int32_t)(at - _now());
+
+    tsch->deadline = at;
+    ztimer_set(ZTIMER_USEC, &tsch->timer, (wait > 0) ? (uint32_t)wait : 0);
+}
+
+static void _radio_idle(ieee802154_tsch_t *tsch)
+{
+    ieee802154_radio_set_idle(&tsch->submac->dev, true);
+}
+
+static int _set_channel(ieee802154_tsch_t *tsch, uint8_t channel)
+{
+    ieee802154_submac_t *submac = tsch->submac;
+    const ieee802154_phy_conf_t conf = {
+        .phy_mode = submac->phy_mode,
+        .channel = channel,
+        .page = submac->channel_page,
+        .pow = submac->tx_pow,
+    };
+
+    tsch->channel = channel;
+    return ieee802154_radio_config_phy(&submac->dev, &conf);
+}
+
+static bool _eb_due(const ieee802154_tsch_t *tsch)
+{
+    return (tsch->state == IEEE802154_TSCH_STATE_JOINED) &&
+           ((int32_t)(_now() - tsch->next_eb) >= 0);
+}
+
+static bool _addr_equal(uint8_t addr_len, const uint8_t *addr,
+                        uint8_t other_len, const uint8_t *other)
+{
+    return (addr_len == other_len) && (memcmp(addr, other, addr_len) == 0);
+}
+
+static bool _has_tx_cell(const ieee802154_tsch_t *tsch, const uint8_t *addr,
+                         uint8_t addr_len)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+        const ieee802154_tsch_cell_t *cell = &tsch->cells[i];
+
+        if ((cell->slotframe != IEEE802154_TSCH_NONE) &&
+            (cell->options & IEEE802154_TSCH_LINK_TX) &&
+            _addr_equal(cell->addr_len, cell->addr, addr_len, addr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* find the cell of the slot at tsch->asn after tsch->slot_start, slots that
+ * already passed are skipped */
+static void _schedule(ieee802154_tsch_t *tsch)
+{
+    uint32_t now = _now();
+
+    while (1) {
+        uint32_t delta = UINT32_MAX;
+
+        for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+            const ieee802154_tsch_cell_t *cell = &tsch->cells[i];
+            uint16_t length;
+
+            if (cell->slotframe == IEEE802154_TSCH_NONE) {
+                continue;
+            }
+            length = tsch->slotframes[cell->slotframe];
+            delta = MIN(delta, (cell->slot_offset + length - (tsch->asn % length)) % length);
+        }
+        if (delta == UINT32_MAX) {
+            DEBUG("TSCH: empty schedule\n");
+            tsch->slot_state = SLOT_IDLE;
+            return;
+        }
+        tsch->asn += delta;
+        tsch->slot_start += delta * IEEE802154_TSCH_TS_LENGTH_US;
+        if ((int32_t)(tsch->slot_start + (IEEE802154_TSCH_TS_RX_OFFSET_US / 2) - now) >= 0) {
+            break;
+        }
+        DEBUG("TSCH: missed slot %" PRIu32 "\n", (uint32_t)tsch->asn);
+        tsch->asn++;
+        tsch->slot_start += IEEE802154_TSCH_TS_LENGTH_US;
+    }
+    tsch->slot_state = SLOT_WAIT;
+    _set_timer(tsch, tsch->slot_start);
+}
+
+/* schedule anew from the current time after the schedule changed */
+static void _reschedule(ieee802154_tsch_t *tsch)
+{
+    if ((tsch->state != IEEE802154_TSCH_STATE_JOINED) ||
+        ((tsch->slot_state != SLOT_WAIT) && (tsch->slot_state != SLOT_IDLE))) {
+        /* the schedule is picked up at the end of the current slot */
+        return;
+    }
+    if (tsch->slot_state == SLOT_WAIT) {
+        int32_t ahead = (int32_t)(tsch->slot_start - _now());
+
+        if (ahead > 0) {
+            uint32_t slots = ahead / IEEE802154_TSCH_TS_LENGTH_US;
+
+            tsch->asn -= slots;
+            tsch->slot_start -= slots * IEEE802154_TSCH_TS_LENGTH_US;
+        }
+    }
+    _schedule(tsch);
+}
+
+static void _next_slot(ieee802154_tsch_t *tsch)
+{
+    _radio_idle(tsch);
+    if (tsch->rx_ready) {
+        tsch->rx_ready = false;
+        tsch->cb->rx_done(tsch);
+    }
+    tsch->asn++;
+    tsch->slot_start += IEEE802154_TSCH_TS_LENGTH_US;
+    _schedule(tsch);
+}
+
+static void _sync(ieee802154_tsch_t *tsch, size_t len)
+{
+    int32_t drift = (int32_t)(tsch->rx_time - (tsch->slot_start +
+                                               IEEE802154_TSCH_TS_TX_OFFSET_US +
+                                               _airtime(len)));
+
+    if ((drift > -(int32_t)(IEEE802154_TSCH_TS_RX_WAIT_US / 2)) &&
+        (drift < (int32_t)(IEEE802154_TSCH_TS_RX_WAIT_US / 2))) {
+        DEBUG("TSCH: drift %" PRId32 " us\n", drift);
+        tsch->slot_start += drift;
+        tsch->last_sync = tsch->rx_time;
+    }
+}
+
+static uint8_t _select_frame(ieee802154_tsch_t *tsch,
+                             const ieee802154_tsch_cell_t *cell)
+{
+    uint8_t res = IEEE802154_TSCH_NONE;
+
+    if ((cell->addr_len == 0) && _eb_due(tsch)) {
+        return FRAME_EB;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->queue); i++) {
+        ieee802154_tsch_frame_t *frame = &tsch->queue[i];
+
+        if (frame->len == 0) {
+            continue;
+        }
+        if (cell->addr_len == 0) {
+            /* cells for any neighbor only take frames that have no cell of
+             * their own */
+            if ((frame->addr_len != 0) &&
+                _has_tx_cell(tsch, frame->addr, frame->addr_len)) {
+                continue;
+            }
+        }
+        else if (!_addr_equal(cell->addr_len, cell->addr,
+                              frame->addr_len, frame->addr)) {
+            continue;
+        }
+        if ((cell->options & IEEE802154_TSCH_LINK_SHARED) && (frame->backoff > 0)) {
+            frame->backoff--;
+            continue;
+        }
+        if ((res == IEEE802154_TSCH_NONE) ||
+            ((int16_t)(frame->order - tsch->queue[res].order) < 0)) {
+            res = i;
+        }
+    }
+    return res;
+}
+
+static void _slot_tx(ieee802154_tsch_t *tsch)
+{
+    ieee802154_submac_t *submac = tsch->submac;
+    uint8_t eb[IEEE802154_TSCH_EB_LEN];
+    iolist_t psdu = { .iol_next = NULL };
+
+    if (tsch->frame == FRAME_EB) {
+        psdu.iol_base = eb;
+        psdu.iol_len = ieee802154_tsch_eb_write(eb, &submac->ext_addr, submac->panid,
+                                                tsch->eb_seq++, tsch->asn,
+                                                tsch->join_metric);
+        tsch->next_eb = _now() + _eb_period();
+    }
+    else {
+        psdu.iol_base = tsch->queue[tsch->frame].psdu;
+        psdu.iol_len = tsch->queue[tsch->frame].len;
+    }
+    _set_channel(tsch, ieee802154_tsch_channel(tsch->asn,
+                                               tsch->cells[tsch->cell].channel_offset));
+    ieee802154_radio_write(&submac->dev, &psdu);
+    tsch->slot_state = SLOT_TX_OFFSET;
+    _set_timer(tsch, tsch->slot_start + IEEE802154_TSCH_TS_TX_OFFSET_US);
+}
+
+static void _slot_rx(ieee802154_tsch_t *tsch)
+{
+    _set_channel(tsch, ieee802154_tsch_channel(tsch->asn,
+                                               tsch->cells[tsch->cell].channel_offset));
+    tsch->slot_state = SLOT_RX_OFFSET;
+    _set_timer(tsch, tsch->slot_start + IEEE802154_TSCH_TS_RX_OFFSET_US);
+}
+
+static void _slot_begin(ieee802154_tsch_t *tsch)
+{
+    uint8_t rx_cell = IEEE802154_TSCH_NONE;
+
+    if (!tsch->coordinator &&
+        ((_now() - tsch->last_sync) > (CONFIG_IEEE802154_TSCH_DESYNC_TIMEOUT_MS * 1000U))) {
+        DEBUG("TSCH: lost time source\n");
+        ieee802154_tsch_scan(tsch);
+        return;
+    }
+
+    /* slotframes with lower handle take precedence, TX cells with a frame to
+     * send before RX cells */
+    for (unsigned handle = 0; handle < ARRAY_SIZE(tsch->slotframes); handle++) {
+        if (tsch->slotframes[handle] == 0) {
+            continue;
+        }
+        uint16_t slot_offset = tsch->asn % tsch->slotframes[handle];
+
+        for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+            const ieee802154_tsch_cell_t *cell = &tsch->cells[i];
+
+            if ((cell->slotframe != handle) || (cell->slot_offset != slot_offset)) {
+                continue;
+            }
+            if (cell->options & IEEE802154_TSCH_LINK_TX) {
+                tsch->frame = _select_frame(tsch, cell);
+                if (tsch->frame != IEEE802154_TSCH_NONE) {
+                    tsch->cell = i;
+                    _slot_tx(tsch);
+                    return;
+                }
+            }
+            if ((cell->options & IEEE802154_TSCH_LINK_RX) &&
+                (rx_cell == IEEE802154_TSCH_NONE)) {
+                rx_cell = i;
+            }
+        }
+    }
+    if (rx_cell == IEEE802154_TSCH_NONE) {
+        _next_slot(tsch);
+        return;
+    }
+    tsch->cell = rx_cell;
+    _slot_rx(tsch);
+}
+
+static void _tx_end(ieee802154_tsch_t *tsch, bool acked)
+{
+    if (tsch->frame != FRAME_EB) {
+        ieee802154_tsch_frame_t *frame = &tsch->queue[tsch->frame];
+        ieee802154_tx_info_t info = { .retrans = frame->retries };
+
+        if (acked) {
+            frame->len = 0;
+            info.status = TX_STATUS_SUCCESS;
+            tsch->cb->tx_done(tsch, info.status, &info);
+        }
+        else if (frame->retries >= CONFIG_IEEE802154_TSCH_MAX_FRAME_RETRIES) {
+            DEBUG("TSCH: dropping frame %u after %u retries\n", tsch->frame,
+                  frame->retries);
+            frame->len = 0;
+            info.status = TX_STATUS_NO_ACK;
+            tsch->cb->tx_done(tsch, info.status, &info);
+        }
+        else {
+            frame->retries++;
+            if (tsch->cells[tsch->cell].options & IEEE802154_TSCH_LINK_SHARED) {
+                frame->backoff = random_uint32_range(0, 1U << frame->be);
+                frame->be = MIN(frame->be + 1U, CONFIG_IEEE802154_TSCH_MAX_BE);
+            }
+        }
+    }
+    _next_slot(tsch);
+}
+
+static void _join(ieee802154_tsch_t *tsch, size_t len, uint64_t asn,
+                  uint8_t join_metric)
+{
+    le_uint16_t pan;
+
+    if (ieee802154_get_src(tsch->rx_buf, tsch->time_source, &pan) !=
+        IEEE802154_LONG_ADDRESS_LEN) {
+        return;
+    }
+    DEBUG("TSCH: joined at ASN %" PRIu32 "\n", (uint32_t)asn);
+    tsch->state = IEEE802154_TSCH_STATE_JOINED;
+    tsch->asn = asn;
+    tsch->slot_start = tsch->rx_time - IEEE802154_TSCH_TS_TX_OFFSET_US - _airtime(len);
+    tsch->join_metric = MIN(join_metric, UINT8_MAX - 1U) + 1;
+    tsch->last_sync = tsch->rx_time;
+    tsch->next_eb = tsch->rx_time + _eb_period();
+    tsch->asn++;
+    tsch->slot_start += IEEE802154_TSCH_TS_LENGTH_US;
+    _schedule(tsch);
+}
+
+static void _rx_scan(ieee802154_tsch_t *tsch, int len)
+{
+    uint64_t asn;
+    uint8_t join_metric;
+    le_uint16_t pan = { 0 };
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+
+    if ((len > 0) &&
+        (ieee802154_tsch_eb_parse(tsch->rx_buf, len, &asn, &join_metric) == 0) &&
+        (ieee802154_get_src(tsch->rx_buf, src, &pan) > 0) &&
+        (byteorder_ltohs(pan) == tsch->submac->panid)) {
+        _join(tsch, len, asn, join_metric);
+    }
+    if (tsch->state == IEEE802154_TSCH_STATE_SCANNING) {
+        ieee802154_radio_set_rx(&tsch->submac->dev);
+    }
+}
+
+static void _rx_slot(ieee802154_tsch_t *tsch, int len)
+{
+    ieee802154_submac_t *submac = tsch->submac;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t pan;
+    int src_len;
+
+    if ((len <= 0) || (ieee802154_get_frame_hdr_len(tsch->rx_buf) == 0)) {
+        _next_slot(tsch);
+        return;
+    }
+    src_len = ieee802154_get_src(tsch->rx_buf, src, &pan);
+    if (!tsch->coordinator &&
+        _addr_equal(src_len, src, sizeof(tsch->time_source), tsch->time_source)) {
+        _sync(tsch, len);
+    }
+    if (((tsch->rx_buf[0] & IEEE802154_FCF_TYPE_MASK) != IEEE802154_FCF_TYPE_DATA) ||
+        (ieee802154_dst_filter(tsch->rx_buf, submac->panid, submac->short_addr,
+                               &submac->ext_addr) != 0)) {
+        _next_slot(tsch);
+        return;
+    }
+    tsch->rx_len = len;
+    tsch->rx_ready = true;
+    if (tsch->rx_buf[0] & IEEE802154_FCF_ACK_REQ) {
+        uint8_t ack[IEEE802154_ACK_FRAME_LEN - IEEE802154_FCS_LEN] = {
+            IEEE802154_FCF_TYPE_ACK, 0x00, ieee802154_get_seq(tsch->rx_buf)
+        };
+        iolist_t psdu = {
+            .iol_base = ack,
+            .iol_len = sizeof(ack),
+            .iol_next = NULL,
+        };
+
+        ieee802154_radio_write(&submac->dev, &psdu);
+        tsch->slot_state = SLOT_ACK_DELAY;
+        _set_timer(tsch, tsch->rx_time + IEEE802154_TSCH_TS_TX_ACK_DELAY_US);
+        return;
+    }
+    _next_slot(tsch);
+}
+
+static void _rx_ack(ieee802154_tsch_t *tsch, int len)
+{
+    const uint8_t *psdu = tsch->queue[tsch->frame].psdu;
+
+    if ((len >= (int)(IEEE802154_ACK_FRAME_LEN - IEEE802154_FCS_LEN)) &&
+        ((tsch->rx_buf[0] & IEEE802154_FCF_TYPE_MASK) == IEEE802154_FCF_TYPE_ACK) &&
+        (ieee802154_get_seq(tsch->rx_buf) == ieee802154_get_seq(psdu))) {
+        _tx_end(tsch, true);
+        return;
+    }
+    /* some other frame, keep listening until the ACK timeout */
+    ieee802154_radio_set_rx(&tsch->submac->dev);
+}
+
+void ieee802154_tsch_init(ieee802154_tsch_t *tsch, ieee802154_submac_t *submac,
+                          const ieee802154_tsch_cb_t *cb)
+{
+    ieee802154_dev_t *dev = &submac->dev;
+
+    memset(tsch, 0, sizeof(*tsch));
+    tsch->submac = submac;
+    tsch->cb = cb;
+    tsch->timer.callback = _timer_cb;
+    tsch->timer.arg = tsch;
+    tsch->frame = IEEE802154_TSCH_NONE;
+    ztimer_acquire(ZTIMER_USEC);
+
+    /* TSCH filters, acknowledges and retransmits frames itself */
+    ieee802154_radio_set_frame_filter_mode(dev, IEEE802154_FILTER_PROMISC);
+    if (ieee802154_radio_has_frame_retrans(dev)) {
+        ieee802154_radio_set_frame_retrans(dev, 0);
+    }
+    if (ieee802154_radio_has_frame_retrans(dev) || ieee802154_radio_has_auto_csma(dev)) {
+        ieee802154_radio_set_csma_params(dev, NULL, -1);
+    }
+    ieee802154_tsch_schedule_minimal(tsch);
+    ieee802154_tsch_scan(tsch);
+}
+
+void ieee802154_tsch_start(ieee802154_tsch_t *tsch)
+{
+    uint32_t now = _now();
+
+    ztimer_remove(ZTIMER_USEC, &tsch->timer);
+    _radio_idle(tsch);
+    tsch->state = IEEE802154_TSCH_STATE_JOINED;
+    tsch->coordinator = true;
+    tsch->join_metric = 0;
+    tsch->asn = 0;
+    tsch->slot_start = now + IEEE802154_TSCH_TS_LENGTH_US;
+    tsch->last_sync = now;
+    tsch->next_eb = now;
+    _schedule(tsch);
+}
+
+void ieee802154_tsch_scan(ieee802154_tsch_t *tsch)
+{
+    ztimer_remove(ZTIMER_USEC, &tsch->timer);
+    _radio_idle(tsch);
+    tsch->state = IEEE802154_TSCH_STATE_SCANNING;
+    tsch->slot_state = SLOT_IDLE;
+    tsch->coordinator = false;
+    _set_channel(tsch, _hopping_seq[0]);
+    ieee802154_radio_set_rx(&tsch->submac->dev);
+}
+
+void ieee802154_tsch_schedule_minimal(ieee802154_tsch_t *tsch)
+{
+    static const ieee802154_tsch_cell_t minimal = {
+        .slot_offset = 0,
+        .channel_offset = 0,
+        .options = IEEE802154_TSCH_LINK_TX | IEEE802154_TSCH_LINK_RX |
+                   IEEE802154_TSCH_LINK_SHARED | IEEE802154_TSCH_LINK_TIMEKEEPING,
+        .slotframe = 0,
+        .addr_len = 0,
+    };
+
+    memset(tsch->slotframes, 0, sizeof(tsch->slotframes));
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+        tsch->cells[i].slotframe = IEEE802154_TSCH_NONE;
+    }
+    ieee802154_tsch_slotframe_add(tsch, 0, CONFIG_IEEE802154_TSCH_MINIMAL_SLOTFRAME_LENGTH);
+    ieee802154_tsch_cell_add(tsch, &minimal);
+}
+
+int ieee802154_tsch_slotframe_add(ieee802154_tsch_t *tsch, uint8_t handle,
+                                  uint16_t length)
+{
+    if ((handle >= ARRAY_SIZE(tsch->slotframes)) || (length == 0)) {
+        return -EINVAL;
+    }
+    if (tsch->slotframes[handle] != 0) {
+        return -EEXIST;
+    }
+    tsch->slotframes[handle] = length;
+    return 0;
+}
+
+void ieee802154_tsch_slotframe_remove(ieee802154_tsch_t *tsch, uint8_t handle)
+{
+    if (handle >= ARRAY_SIZE(tsch->slotframes)) {
+        return;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+        if (tsch->cells[i].slotframe == handle) {
+            tsch->cells[i].slotframe = IEEE802154_TSCH_NONE;
+        }
+    }
+    tsch->slotframes[handle] = 0;
+    _reschedule(tsch);
+}
+
+int ieee802154_tsch_cell_add(ieee802154_tsch_t *tsch,
+                             const ieee802154_tsch_cell_t *cell)
+{
+    if ((cell->slotframe >= ARRAY_SIZE(tsch->slotframes)) ||
+        (cell->slot_offset >= tsch->slotframes[cell->slotframe]) ||
+        (cell->addr_len > sizeof(cell->addr))) {
+        return -EINVAL;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+        if (tsch->cells[i].slotframe == IEEE802154_TSCH_NONE) {
+            tsch->cells[i] = *cell;
+            _reschedule(tsch);
+            return 0;
+        }
+    }
+    return -ENOMEM;
+}
+
+void ieee802154_tsch_cell_remove(ieee802154_tsch_t *tsch, uint8_t handle,
+                                 uint16_t slot_offset)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->cells); i++) {
+        if ((tsch->cells[i].slotframe == handle) &&
+            (tsch->cells[i].slot_offset == slot_offset)) {
+            tsch->cells[i].slotframe = IEEE802154_TSCH_NONE;
+        }
+    }
+    _reschedule(tsch);
+}
+
+int ieee802154_tsch_send(ieee802154_tsch_t *tsch, const iolist_t *iolist)
+{
+    ieee802154_tsch_frame_t *frame = NULL;
+    size_t len = iolist_size(iolist);
+    le_uint16_t pan;
+    int addr_len;
+
+    if (tsch->state != IEEE802154_TSCH_STATE_JOINED) {
+        return -ENETDOWN;
+    }
+    if (len > sizeof(frame->psdu)) {
+        return -EINVAL;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(tsch->queue); i++) {
+        if (tsch->queue[i].len == 0) {
+            frame = &tsch->queue[i];
+            break;
+        }
+    }
+    if (frame == NULL) {
+        return -EBUSY;
+    }
+    iolist_to_buffer(iolist, frame->psdu, sizeof(frame->psdu));
+    if ((len < IEEE802154_MIN_FRAME_LEN) ||
+        (ieee802154_get_frame_hdr_len(frame->psdu) == 0) ||
+        ((addr_len = ieee802154_get_dst(frame->psdu, frame->addr, &pan)) < 0)) {
+        return -EINVAL;
+    }
+    if ((addr_len == IEEE802154_ADDR_BCAST_LEN) &&
+        (memcmp(frame->addr, ieee802154_addr_bcast, IEEE802154_ADDR_BCAST_LEN) == 0)) {
+        addr_len = 0;
+    }
+    frame->addr_len = addr_len;
+    frame->len = len;
+    frame->order = tsch->order++;
+    frame->retries = 0;
+    frame->be = CONFIG_IEEE802154_TSCH_MIN_BE;
+    frame->backoff = 0;
+    return len + IEEE802154_FCS_LEN;
+}
+
+int ieee802154_tsch_read_frame(ieee802154_tsch_t *tsch, void *buf, size_t len,
+                               ieee802154_rx_info_t *info)
+{
+    int res = tsch->rx_len;
+
+    if (buf != NULL) {
+        if (len < tsch->rx_len) {
+            res = -ENOBUFS;
+        }
+        else {
+            memcpy(buf, tsch->rx_buf, tsch->rx_len);
+            if (info != NULL) {
+                *info = tsch->rx_info;
+            }
+        }
+    }
+    tsch->rx_len = 0;
+    return res;
+}
+
+uint8_t ieee802154_tsch_channel(uint64_t asn, uint8_t channel_offset)
+{
+    return _hopping_seq[(asn + channel_offset) % ARRAY_SIZE(_hopping_seq)];
+}
+
+size_t ieee802154_tsch_eb_write(uint8_t *buf, const eui64_t *src, uint16_t panid,
+                                uint8_t seq, uint64_t asn, uint8_t join_metric)
+{
+    le_uint16_t pan = byteorder_htols(panid);
+    size_t pos = ieee802154_set_frame_hdr(buf, src->uint8, sizeof(*src), NULL, 0,
+                                          pan, pan, IEEE802154_FCF_TYPE_BEACON, seq);
+
+    buf[1] = (buf[1] & ~IEEE802154_FCF_VERS_MASK) | IEEE802154_FCF_VERS_V2 |
+             IEEE802154_FCF_IE_PRESENT;
+    _put_u16(&buf[pos], IE_HDR_ID_HT1 << 7);
+    pos += 2;
+    _put_u16(&buf[pos], IE_TYPE_PAYLOAD | (IE_PAYLOAD_GROUP_MLME << 11) |
+                        (2 + IE_TSCH_SYNC_LEN));
+    pos += 2;
+    _put_u16(&buf[pos], (IE_SUB_ID_TSCH_SYNC << 8) | IE_TSCH_SYNC_LEN);
+    pos += 2;
+    for (unsigned i = 0; i < ASN_LEN; i++) {
+        buf[pos++] = asn >> (8 * i);
+    }
+    buf[pos++] = join_metric;
+    return pos;
+}
+
+static int _parse_sync_ie(const uint8_t *buf, size_t len, uint64_t *asn,
+                          uint8_t *join_metric)
+{
+    size_t pos = 0;
+
+    while (pos + 2 <= len) {
+        uint16_t desc = _get_u16(&buf[pos]);
+        size_t ie_len = (desc & IE_SUB_LONG) ? (desc & IE_SUB_LONG_LEN_MASK)
+                                             : (desc & IE_SUB_SHORT_LEN_MASK);
+
+        pos += 2;
+        if (pos + ie_len > len) {
+            break;
+        }
+        if (!(desc & IE_SUB_LONG) && (IE_SUB_SHORT_ID(desc) == IE_SUB_ID_TSCH_SYNC) &&
+            (ie_len >= IE_TSCH_SYNC_LEN)) {
+            *asn = 0;
+            for (unsigned i = 0; i < ASN_LEN; i++) {
+                *asn |= (uint64_t)buf[pos + i] << (8 * i);
+            }
+            *join_metric = buf[pos + ASN_LEN];
+            return 0;
+        }
+        pos += ie_len;
+    }
+    return -EINVAL;
+}
+
+int ieee802154_tsch_eb_parse(const uint8_t *buf, size_t len, uint64_t *asn,
+                             uint8_t *join_metric)
+{
+    size_t pos;
+
+    if ((len < IEEE802154_MIN_FRAME_LEN) ||
+        ((buf[0] & IEEE802154_FCF_TYPE_MASK) != IEEE802154_FCF_TYPE_BEACON) ||
+        ((buf[1] & IEEE802154_FCF_VERS_MASK) != IEEE802154_FCF_VERS_V2) ||
+        !(buf[1] & IEEE802154_FCF_IE_PRESENT) ||
+        (buf[0] & IEEE802154_FCF_SECURITY_EN) ||
+        ((pos = ieee802154_get_frame_hdr_len(buf)) == 0)) {
+        return -EINVAL;
+    }
+    /* skip header IEs */
+    while (1) {
+        uint16_t desc;
+
+        if (pos + 2 > len) {
+            return -EINVAL;
+        }
+        desc = _get_u16(&buf[pos]);
+        pos += 2;
+        if (IE_HDR_ID(desc) == IE_HDR_ID_HT1) {
+            break;
+        }
+        if (IE_HDR_ID(desc) == IE_HDR_ID_HT2) {
+            return -EINVAL;
+        }
+        pos += desc & IE_HDR_LEN_MASK;
+    }
+    /* search the MLME payload IEs */
+    while (pos + 2 <= len) {
+        uint16_t desc = _get_u16(&buf[pos]);
+        size_t ie_len = desc & IE_PAYLOAD_LEN_MASK;
+
+        pos += 2;
+        if (!(desc & IE_TYPE_PAYLOAD) || (IE_PAYLOAD_GROUP(desc) == IE_PAYLOAD_GROUP_PT) ||
+            (pos + ie_len > len)) {
+            break;
+        }
+        if ((IE_PAYLOAD_GROUP(desc) == IE_PAYLOAD_GROUP_MLME) &&
+            (_parse_sync_ie(&buf[pos], ie_len, asn, join_metric) == 0)) {
+            return 0;
+        }
+        pos += ie_len;
+    }
+    return -EINVAL;
+}
+
+void ieee802154_tsch_radio_event(ieee802154_tsch_t *tsch, ieee802154_trx_ev_t ev)
+{
+    switch (ev) {
+    case IEEE802154_RADIO_INDICATION_RX_DONE:
+        tsch->rx_time = _now();
+        break;
+    case IEEE802154_RADIO_CONFIRM_TX_DONE:
+        tsch->tx_time = _now();
+        break;
+    default:
+        break;
+    }
+}
+
+void ieee802154_tsch_bh_process(ieee802154_tsch_t *tsch)
+{
+    ieee802154_dev_t *dev = &tsch->submac->dev;
+
+    if (tsch->slot_state == SLOT_IDLE) {
+        return;
+    }
+    if ((int32_t)(_now() - tsch->deadline) < 0) {
+        /* stale request of a timer that was set anew */
+        _set_timer(tsch, tsch->deadline);
+        return;
+    }
+
+    switch (tsch->slot_state) {
+    case SLOT_WAIT:
+        _slot_begin(tsch);
+        break;
+    case SLOT_TX_OFFSET:
+        if (ieee802154_radio_request_transmit(dev) < 0) {
+            _tx_end(tsch, false);
+            break;
+        }
+        tsch->slot_state = SLOT_TX;
+        /* in case TX done is not signaled */
+        _set_timer(tsch, tsch->slot_start + IEEE802154_TSCH_TS_LENGTH_US);
+        break;
+    case SLOT_TX:
+        ieee802154_radio_confirm_transmit(dev, NULL);
+        _tx_end(tsch, false);
+        break;
+    case SLOT_ACK_WAIT:
+        _tx_end(tsch, false);
+        break;
+    case SLOT_RX_OFFSET:
+        ieee802154_radio_set_rx(dev);
+        tsch->slot_state = SLOT_RX;
+        /* not all radios signal the start of a frame, so listen until the
+         * longest frame would have ended */
+        _set_timer(tsch, tsch->slot_start + IEEE802154_TSCH_TS_RX_OFFSET_US +
+                         IEEE802154_TSCH_TS_RX_WAIT_US + IEEE802154_TSCH_TS_MAX_TX_US);
+        break;
+    case SLOT_ACK_DELAY:
+        if (ieee802154_radio_request_transmit(dev) < 0) {
+            _next_slot(tsch);
+            break;
+        }
+        tsch->slot_state = SLOT_ACK_TX;
+        _set_timer(tsch, tsch->slot_start + IEEE802154_TSCH_TS_LENGTH_US);
+        break;
+    case SLOT_RX:
+    case SLOT_ACK_TX:
+        _next_slot(tsch);
+        break;
+    default:
+        break;
+    }
+}
+
+void ieee802154_tsch_tx_done_cb(ieee802154_tsch_t *tsch)
+{
+    ieee802154_dev_t *dev = &tsch->submac->dev;
+    ieee802154_tx_info_t info;
+
+    if (ieee802154_radio_confirm_transmit(dev, &info) < 0) {
+        return;
+    }
+    switch (tsch->slot_state) {
+    case SLOT_TX:
+        if ((tsch->frame == FRAME_EB) ||
+            !(tsch->queue[tsch->frame].psdu[0] & IEEE802154_FCF_ACK_REQ)) {
+            _tx_end(tsch, true);
+            break;
+        }
+        ieee802154_radio_set_rx(dev);
+        tsch->slot_state = SLOT_ACK_WAIT;
+        _set_timer(tsch, tsch->tx_time + IEEE802154_TSCH_TS_TX_ACK_DELAY_US +
+                         IEEE802154_TSCH_TS_ACK_WAIT_US +
+                         _airtime(IEEE802154_ACK_FRAME_LEN - IEEE802154_FCS_LEN));
+        break;
+    case SLOT_ACK_TX:
+        _next_slot(tsch);
+        break;
+    default:
+        break;
+    }
+}
+
+void ieee802154_tsch_rx_done_cb(ieee802154_tsch_t *tsch)
+{
+    ieee802154_dev_t *dev = &tsch->submac->dev;
+    int len = -EINVAL;
+
+    _radio_idle(tsch);
+    if ((tsch->state == IEEE802154_TSCH_STATE_SCANNING) ||
+        (tsch->slot_state == SLOT_RX) || (tsch->slot_state == SLOT_ACK_WAIT)) {
+        len = ieee802154_radio_len(dev);
+    }
+    /* keep the frame the upper layer did not read yet */
+    if ((len <= 0) || (len > (int)sizeof(tsch->rx_buf)) || (tsch->rx_len != 0)) {
+        ieee802154_radio_read(dev, NULL, 0, NULL);
+        len = -EINVAL;
+    }
+    else {
+        len = ieee802154_radio_read(dev, tsch->rx_buf, len, &tsch->rx_info);
+    }
+
+    if (tsch->state == IEEE802154_TSCH_STATE_SCANNING) {
+        _rx_scan(tsch, len);
+    }
+    else if (tsch->slot_state == SLOT_RX) {
+        _rx_slot(tsch, len);
+    }
+    else if (tsch->slot_state == SLOT_ACK_WAIT) {
+        _rx_ack(tsch, len);
+    }
+}
+
+void ieee802154_tsch_crc_error_cb(ieee802154_tsch_t *tsch)
+{
+    _radio_idle(tsch);
+    ieee802154_radio_read(&tsch->submac->dev, NULL, 0, NULL);
+    if (tsch->state == IEEE802154_TSCH_STATE_SCANNING) {
+        ieee802154_radio_set_rx(&tsch->submac->dev);
+    }
+    else if (tsch->slot_state == SLOT_RX) {
+        _next_slot(tsch);
+    }
+    else if (tsch->slot_state == SLOT_ACK_WAIT) {
+        _tx_end(tsch, false);
+    }
+}
+
+/** @} */
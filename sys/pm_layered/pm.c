@@ -24,6 +24,10 @@
 #include "irq.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#if MODULE_PM_LAYERED_RESIDENCY
+#include "time_units.h"
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -55,6 +59,48 @@
  */
 static pm_blocker_t pm_blocker = { .blockers = PM_BLOCKER_INITIAL };
 
+#if MODULE_PM_LAYERED_RESIDENCY
+static const uint32_t _min_residency_us[PM_NUM_MODES] = PM_MODE_MIN_RESIDENCY_US;
+
+static uint32_t _scale_us(uint32_t ticks, uint32_t us_per_tick)
+{
+    if (ticks > UINT32_MAX / us_per_tick) {
+        return UINT32_MAX;
+    }
+    return ticks * us_per_tick;
+}
+
+/**
+ * @brief   Get the time in microseconds until the next timer expires
+ */
+static uint32_t _time_to_next_us(void)
+{
+    uint32_t res = UINT32_MAX;
+    uint32_t next;
+
+#if MODULE_ZTIMER_USEC
+    next = ztimer_time_to_next(ZTIMER_USEC);
+    if (next < res) {
+        res = next;
+    }
+#endif
+#if MODULE_ZTIMER_MSEC
+    next = _scale_us(ztimer_time_to_next(ZTIMER_MSEC), US_PER_MS);
+    if (next < res) {
+        res = next;
+    }
+#endif
+#if MODULE_ZTIMER_SEC
+    next = _scale_us(ztimer_time_to_next(ZTIMER_SEC), US_PER_SEC);
+    if (next < res) {
+        res = next;
+    }
+#endif
+
+    return res;
+}
+#endif
+
 void pm_set_lowest(void)
 {
     unsigned mode = PM_NUM_MODES;
@@ -68,6 +114,17 @@ void pm_set_lowest(void)
         mode--;
     }
 
+#if MODULE_PM_LAYERED_RESIDENCY
+    /* skip modes that would be left again before they pay off */
+    if (mode < PM_NUM_MODES) {
+        uint32_t time_to_next = _time_to_next_us();
+        while ((mode + 1 < PM_NUM_MODES) &&
+               (_min_residency_us[mode] > time_to_next)) {
+            mode++;
+        }
+    }
+#endif
+
     if (mode != PM_NUM_MODES) {
         pm_set(mode);
     }
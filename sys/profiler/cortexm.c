@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       Periodic timer based sampling backend for Cortex-M
+ *
+ * Threads run on the process stack (PSP), ISRs on the main stack. On
+ * exception entry the hardware stacks R0-R3, R12, LR, PC and xPSR, so the
+ * interrupted PC of the thread is found at offset 6 of the frame the PSP
+ * points to. This holds for the extended (FPU) frame as well.
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "cpu.h"
+#include "periph/timer.h"
+#include "profiler.h"
+#include "thread.h"
+
+/**
+ * @brief   Index of the stacked PC in the exception frame
+ */
+#define EXC_FRAME_PC_IDX    (6U)
+
+static bool _interrupted_isr(void)
+{
+#ifdef SCB_ICSR_RETTOBASE_Msk
+    /* RETTOBASE is set if the sampling ISR is the only active exception */
+    return !(SCB->ICSR & SCB_ICSR_RETTOBASE_Msk);
+#else
+    /* ARMv6-M and ARMv8-M baseline can't tell. If the sampling ISR preempted
+     * another ISR, the sample ends up at the PC the thread was interrupted at
+     * by the outer ISR. */
+    return false;
+#endif
+}
+
+static void _sample_cb(void *arg, int chan)
+{
+    (void)arg;
+    (void)chan;
+
+    thread_t *active = thread_get_active();
+
+    if ((active == NULL) || _interrupted_isr()) {
+        profiler_sample(0, PROFILER_PID_ISR);
+        return;
+    }
+
+    const uint32_t *frame = (const uint32_t *)__get_PSP();
+    profiler_sample(frame[EXC_FRAME_PC_IDX], active->pid);
+}
+
+int profiler_arch_start(unsigned rate_hz)
+{
+    if ((rate_hz == 0) || (rate_hz > CONFIG_PROFILER_TIMER_FREQ)) {
+        return -EINVAL;
+    }
+
+    uint32_t ticks = CONFIG_PROFILER_TIMER_FREQ / rate_hz;
+
+    if (timer_init(CONFIG_PROFILER_TIMER, CONFIG_PROFILER_TIMER_FREQ,
+                   _sample_cb, NULL) != 0) {
+        return -ENODEV;
+    }
+
+    return timer_set_periodic(CONFIG_PROFILER_TIMER, 0, ticks,
+                              TIM_FLAG_RESET_ON_MATCH | TIM_FLAG_RESET_ON_SET);
+}
+
+void profiler_arch_stop(void)
+{
+    timer_stop(CONFIG_PROFILER_TIMER);
+}
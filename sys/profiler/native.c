@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       SIGPROF based sampling backend for native
+ *
+ * The signal is deliberately not dispatched through the native interrupt
+ * emulation: that one defers signals arriving during syscalls or ISRs and
+ * only knows the PC of the thread context it switched away from. Instead,
+ * the PC is taken right from the signal context. The signal stays blocked
+ * while interrupts are disabled, as any other native interrupt.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "irq.h"
+#include "native_internal.h"
+#include "profiler.h"
+#include "thread.h"
+
+static void _sigprof_handler(int sig, siginfo_t *info, void *context)
+{
+    (void)sig;
+    (void)info;
+
+    thread_t *active = thread_get_active();
+    kernel_pid_t pid = ((_native_in_isr != 0) || (active == NULL))
+                     ? PROFILER_PID_ISR : active->pid;
+
+    profiler_sample(_context_get_fptr(context), pid);
+}
+
+static int _set_itimer(unsigned rate_hz)
+{
+    struct itimerval itv = { 0 };
+
+    if (rate_hz) {
+        itv.it_interval.tv_usec = 1000000LU / rate_hz;
+        itv.it_value = itv.it_interval;
+    }
+
+    _native_syscall_enter();
+    int res = setitimer(ITIMER_PROF, &itv, NULL);
+    _native_syscall_leave();
+
+    return (res == 0) ? 0 : -errno;
+}
+
+int profiler_arch_start(unsigned rate_hz)
+{
+    struct sigaction sa;
+
+    if ((rate_hz == 0) || (rate_hz > 1000000LU)) {
+        return -EINVAL;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    /* as for the native interrupts: don't nest into other handlers */
+    sigfillset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART | SA_ONSTACK | SA_SIGINFO;
+    sa.sa_sigaction = _sigprof_handler;
+
+    unsigned state = irq_disable();
+    _native_syscall_enter();
+    int res = sigaction(SIGPROF, &sa, NULL);
+    if (res == 0) {
+        /* irq_enable() restores _native_sig_set, so whitelist it there */
+        sigdelset(&_native_sig_set, SIGPROF);
+    }
+    _native_syscall_leave();
+    irq_restore(state);
+
+    if (res != 0) {
+        return -errno;
+    }
+
+    return _set_itimer(rate_hz);
+}
+
+void profiler_arch_stop(void)
+{
+    _set_itimer(0);
+
+    unsigned state = irq_disable();
+    _native_syscall_enter();
+    sigaddset(&_native_sig_set, SIGPROF);
+    signal(SIGPROF, SIG_IGN);
+    _native_syscall_leave();
+    irq_restore(state);
+}
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_profiler
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler sample buffer and dump
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "atomic_utils.h"
+#include "container.h"
+#include "irq.h"
+#include "profiler.h"
+#include "thread.h"
+
+#if (CONFIG_PROFILER_BUFSIZE & (CONFIG_PROFILER_BUFSIZE - 1)) != 0
+#  error "CONFIG_PROFILER_BUFSIZE must be a power of two"
+#endif
+
+/* The buffer is a single producer (the sampling ISR) single consumer ring
+ * buffer: _head is only written by the producer, _tail only by the consumer.
+ * Both are free running and wrap around naturally. */
+static profiler_sample_t _samples[CONFIG_PROFILER_BUFSIZE];
+static unsigned _head;
+static unsigned _tail;
+static uint32_t _total;
+static uint32_t _dropped;
+static bool _running;
+
+void profiler_sample(uintptr_t pc, kernel_pid_t pid)
+{
+    unsigned head = atomic_load_unsigned(&_head);
+
+    _total++;
+    if (head - atomic_load_unsigned(&_tail) >= CONFIG_PROFILER_BUFSIZE) {
+        _dropped++;
+        return;
+    }
+
+    _samples[head & (CONFIG_PROFILER_BUFSIZE - 1)] = (profiler_sample_t){
+        .pc = pc,
+        .pid = pid,
+    };
+    atomic_store_unsigned(&_head, head + 1);
+}
+
+int profiler_start(void)
+{
+    if (_running) {
+        return -EALREADY;
+    }
+
+    int res = profiler_arch_start(CONFIG_PROFILER_SAMPLE_RATE_HZ);
+    if (res == 0) {
+        _running = true;
+    }
+
+    return res;
+}
+
+void profiler_stop(void)
+{
+    if (_running) {
+        profiler_arch_stop();
+        _running = false;
+    }
+}
+
+bool profiler_is_running(void)
+{
+    return _running;
+}
+
+size_t profiler_read(profiler_sample_t *dest, size_t max_samples)
+{
+    unsigned tail = atomic_load_unsigned(&_tail);
+    unsigned head = atomic_load_unsigned(&_head);
+    size_t n = 0;
+
+    while ((tail != head) && (n < max_samples)) {
+        dest[n++] = _samples[tail & (CONFIG_PROFILER_BUFSIZE - 1)];
+        tail++;
+    }
+    atomic_store_unsigned(&_tail, tail);
+
+    return n;
+}
+
+uint32_t profiler_total(void)
+{
+    unsigned state = irq_disable();
+    uint32_t res = _total;
+    irq_restore(state);
+
+    return res;
+}
+
+uint32_t profiler_dropped(void)
+{
+    unsigned state = irq_disable();
+    uint32_t res = _dropped;
+    irq_restore(state);
+
+    return res;
+}
+
+void profiler_reset(void)
+{
+    unsigned state = irq_disable();
+    _tail = _head;
+    _total = 0;
+    _dropped = 0;
+    irq_restore(state);
+}
+
+void profiler_dump(void)
+{
+    profiler_sample_t chunk[8];
+
+    printf("profiler: rate=%u total=%" PRIu32 " dropped=%" PRIu32 "\n",
+           (unsigned)CONFIG_PROFILER_SAMPLE_RATE_HZ,
+           profiler_total(), profiler_dropped());
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+        if (thread != NULL) {
+            const char *name = thread_get_name(thread);
+            printf("profiler: thread %d %s\n", (int)pid, name ? name : "-");
+        }
+    }
+
+    /* Samples keep coming in while dumping if the profiler is running. Only
+     * dump what was in the buffer when starting to avoid dumping forever. */
+    size_t left = atomic_load_unsigned(&_head) - atomic_load_unsigned(&_tail);
+    while (left > 0) {
+        size_t n = profiler_read(chunk, (left < ARRAY_SIZE(chunk)) ? left : ARRAY_SIZE(chunk));
+        if (n == 0) {
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            printf("profiler: sample %d 0x%08" PRIxPTR "\n",
+                   (int)chunk[i].pid, chunk[i].pc);
+        }
+        left -= n;
+    }
+
+    puts("profiler: end");
+}
@@ -26,6 +26,9 @@
 #include "shell.h"
 #include "trickle.h"
 #include "utlist.h"
+#ifdef MODULE_GNRC_RPL_DAO_TABLE
+#include "net/gnrc/rpl/dao_table.h"
+#endif
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -376,6 +379,25 @@ int _gnrc_rpl_set_pio(char *inst_id, bool status)
     return 0;
 }
 
+#ifdef MODULE_GNRC_RPL_DAO_TABLE
+static int _gnrc_rpl_routes(void)
+{
+    gnrc_rpl_dao_table_stats_t stats;
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+
+    while (gnrc_rpl_dao_table_iter(&state, &fte)) {
+        gnrc_ipv6_nib_ft_print(&fte);
+    }
+    gnrc_rpl_dao_table_stats(&stats);
+    printf("%u/%u routes (%u merged) over %u next hops, %u bytes, "
+           "%u dropped\n",
+           stats.used, stats.numof, stats.aggregated, stats.next_hops,
+           (unsigned)stats.size, stats.dropped);
+    return 0;
+}
+#endif
+
 static int _gnrc_rpl(int argc, char **argv)
 {
     if ((argc < 2) || (strcmp(argv[1], "show") == 0)) {
@@ -440,6 +462,11 @@ static int _gnrc_rpl(int argc, char **argv)
         }
     }
 #endif
+#ifdef MODULE_GNRC_RPL_DAO_TABLE
+    else if (strcmp(argv[1], "routes") == 0) {
+        return _gnrc_rpl_routes();
+    }
+#endif
 #ifdef MODULE_NETSTATS_RPL
     else if (strcmp(argv[1], "stats") == 0) {
         return _stats();
@@ -458,6 +485,9 @@ static int _gnrc_rpl(int argc, char **argv)
     printf("* rm <instance_id>\t\t\t- delete the given instance and related dodag\n");
     printf("* root <inst_id> <dodag_id>\t\t- add a dodag to a new or existing instance\n");
     printf("* router <instance_id>\t\t\t- operate as router in the instance\n");
+#ifdef MODULE_GNRC_RPL_DAO_TABLE
+    printf("* routes\t\t\t\t- show downward routes\n");
+#endif
     printf("* send dis\t\t\t\t- send a multicast DIS\n");
     printf("* send dis <VID_flags> <version> <instance_id> <dodag_id> - send a multicast DIS with SOL option\n");
 
@@ -50,6 +50,14 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
            (long unsigned)sfr.acks.aborts,
            (long unsigned)sfr.acks.forwarded);
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    printf("SFR dgs acked: %u, time: avg: %lu ms, max: %lu ms\n",
+           stats->sfr_datagrams,
+           (long unsigned)(stats->sfr_datagrams
+                           ? (stats->sfr_time_sum / stats->sfr_datagrams)
+                           : 0),
+           (long unsigned)stats->sfr_time_max);
+#endif
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
     return 0;
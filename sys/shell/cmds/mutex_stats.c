@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to list mutex contention statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex_stats.h"
+#include "shell.h"
+
+static int _mutex_stats_handler(int argc, char **argv)
+{
+    if (argc == 1) {
+        mutex_stats_print();
+        return 0;
+    }
+
+    if ((argc == 2) && !strcmp(argv[1], "reset")) {
+        mutex_stats_reset();
+        return 0;
+    }
+
+    printf("usage: %s [reset]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(mutex_stats, "List mutex contention statistics",
+              _mutex_stats_handler);
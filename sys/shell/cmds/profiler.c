@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to control the sampling profiler
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "profiler.h"
+#include "shell.h"
+
+static int _usage(const char *cmd)
+{
+    printf("usage: %s <start|stop|status|dump|reset>\n", cmd);
+    return 1;
+}
+
+static int _profiler_handler(int argc, char **argv)
+{
+    if (argc != 2) {
+        return _usage(argv[0]);
+    }
+
+    if (!strcmp(argv[1], "start")) {
+        int res = profiler_start();
+        if (res != 0) {
+            printf("error: failed to start profiler (%d)\n", res);
+            return 1;
+        }
+    }
+    else if (!strcmp(argv[1], "stop")) {
+        profiler_stop();
+    }
+    else if (!strcmp(argv[1], "status")) {
+        printf("%s, %" PRIu32 " samples taken, %" PRIu32 " dropped\n",
+               profiler_is_running() ? "running" : "stopped",
+               profiler_total(), profiler_dropped());
+    }
+    else if (!strcmp(argv[1], "dump")) {
+        profiler_dump();
+    }
+    else if (!strcmp(argv[1], "reset")) {
+        profiler_reset();
+    }
+    else {
+        return _usage(argv[0]);
+    }
+
+    return 0;
+}
+
+SHELL_COMMAND(profiler, "Control the sampling profiler", _profiler_handler);
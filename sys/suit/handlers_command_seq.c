@@ -44,6 +44,16 @@
 #include "suit/transport/vfs.h"
 #endif
 #include "suit/transport/mock.h"
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+#include "suit/transport/pipeline.h"
+#endif
+#if defined(MODULE_SUIT_TRANSPORT_DELTA) && defined(MODULE_RIOTBOOT_SLOT)
+#include "riotboot/slot.h"
+#include "suit/transport/delta.h"
+#endif
+#ifdef MODULE_SUIT_TRANSPORT_DECOMPRESS
+#include "suit/transport/decompress.h"
+#endif
 
 #if defined(MODULE_PROGRESS_BAR)
 #include "progress_bar.h"
@@ -295,6 +305,12 @@ static int _dtv_set_param(suit_manifest_t *manifest, int key,
             case SUIT_PARAMETER_URI:
                 ref = &comp->param_uri;
                 break;
+            case SUIT_PARAMETER_UNPACK_INFO:
+                ref = &comp->param_unpack_info;
+                break;
+            case SUIT_PARAMETER_COMPRESSION_INFO:
+                ref = &comp->param_compression_info;
+                break;
             default:
                 LOG_DEBUG("Unsupported parameter %" PRIi32 "\n", param_key);
                 return SUIT_ERR_UNSUPPORTED;
@@ -386,6 +402,15 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
 
     _print_download_progress(manifest, offset, len, image_size);
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    /* written and finished by the writer thread */
+    int res = suit_pipeline_put(offset, buf, len, more);
+    if ((res == 0) && !more) {
+        /* the digest of the whole payload is known after the fetch */
+        suit_component_set_flag(comp, SUIT_COMPONENT_STATE_DIGESTED);
+    }
+    return res;
+#else
     int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
     if (!more) {
         LOG_INFO("Finalizing payload store\n");
@@ -393,9 +418,62 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
         res = suit_storage_finish(comp->storage_backend, manifest);
     }
     return res;
+#endif
 }
+
+#if defined(MODULE_SUIT_TRANSPORT_DELTA) && defined(MODULE_RIOTBOOT_SLOT)
+static suit_delta_t _delta;
+#endif
+#ifdef MODULE_SUIT_TRANSPORT_DECOMPRESS
+static suit_decompress_t _decompress;
+#endif
 #endif
 
+static int _get_unpack_info(suit_manifest_t *manifest, suit_component_t *comp,
+                            uint32_t *unpack)
+{
+    nanocbor_value_t param_unpack;
+
+    *unpack = 0;
+    if (suit_param_ref_to_cbor(manifest, &comp->param_unpack_info,
+                               &param_unpack) == 0) {
+        /* plain payload */
+        return SUIT_OK;
+    }
+    if (nanocbor_get_uint32(&param_unpack, unpack) < 0) {
+        return SUIT_ERR_INVALID_MANIFEST;
+    }
+    /* deltas are applied against the running riotboot slot */
+    if (!IS_USED(MODULE_SUIT_TRANSPORT_DELTA) || !IS_USED(MODULE_RIOTBOOT_SLOT) ||
+            (*unpack != SUIT_UNPACK_DELTA)) {
+        LOG_ERROR("Unsupported unpack algorithm %" PRIu32 "\n", *unpack);
+        return SUIT_ERR_UNSUPPORTED;
+    }
+    return SUIT_OK;
+}
+
+static int _get_compression_info(suit_manifest_t *manifest,
+                                 suit_component_t *comp, int32_t *compression)
+{
+    nanocbor_value_t param_compression;
+
+    *compression = 0;
+    if (suit_param_ref_to_cbor(manifest, &comp->param_compression_info,
+                               &param_compression) == 0) {
+        /* uncompressed payload */
+        return SUIT_OK;
+    }
+    if (nanocbor_get_int32(&param_compression, compression) < 0) {
+        return SUIT_ERR_INVALID_MANIFEST;
+    }
+    if (!IS_USED(MODULE_SUIT_TRANSPORT_DECOMPRESS) ||
+            (*compression != SUIT_COMPRESSION_HEATSHRINK)) {
+        LOG_ERROR("Unsupported compression %" PRIi32 "\n", *compression);
+        return SUIT_ERR_UNSUPPORTED;
+    }
+    return SUIT_OK;
+}
+
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
                       nanocbor_value_t *_it)
 {
@@ -438,11 +516,55 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
     LOG_DEBUG("_dtv_fetch() fetching \"%s\" (url_len=%" PRIuSIZE ")\n", manifest->urlbuf,
               url_len);
 
+    uint32_t unpack;
+    res = _get_unpack_info(manifest, comp, &unpack);
+    if (res) {
+        return res;
+    }
+
+    int32_t compression;
+    res = _get_compression_info(manifest, comp, &compression);
+    if (res) {
+        return res;
+    }
+
     if (_start_storage(manifest, comp) < 0) {
         LOG_ERROR("Unable to start storage backend\n");
         return SUIT_ERR_STORAGE;
     }
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    /* a digest from an earlier use of the component must not be trusted */
+    suit_component_clear_flag(comp, SUIT_COMPONENT_STATE_DIGESTED);
+    if (suit_pipeline_start(manifest, comp->storage_backend) < 0) {
+        LOG_ERROR("Unable to start storage pipeline\n");
+        return SUIT_ERR_STORAGE;
+    }
+#endif
+
+#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS)
+    coap_blockwise_cb_t cb = _storage_helper;
+    void *cb_arg = manifest;
+#if defined(MODULE_SUIT_TRANSPORT_DELTA) && defined(MODULE_RIOTBOOT_SLOT)
+    if (unpack == SUIT_UNPACK_DELTA) {
+        /* the delta is applied against the running image */
+        int slot = riotboot_slot_current();
+        suit_delta_init(&_delta, riotboot_slot_get_hdr(slot),
+                        riotboot_slot_size(slot), _storage_helper, manifest);
+        cb = suit_delta_apply;
+        cb_arg = &_delta;
+    }
+#endif
+#ifdef MODULE_SUIT_TRANSPORT_DECOMPRESS
+    if (compression == SUIT_COMPRESSION_HEATSHRINK) {
+        /* expanded before a delta is applied */
+        suit_decompress_init(&_decompress, cb, cb_arg);
+        cb = suit_decompress_apply;
+        cb_arg = &_decompress;
+    }
+#endif
+#endif
+
     res = -1;
 
     if (0) {}
@@ -450,8 +572,7 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
-                                         _storage_helper,
-                                         manifest);
+                                         cb, cb_arg);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
@@ -461,14 +582,25 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_VFS
     else if (strncmp(manifest->urlbuf, "file://", 7) == 0) {
-        res = suit_transport_vfs_fetch(manifest, _storage_helper, manifest);
+        res = suit_transport_vfs_fetch(manifest, cb, cb_arg);
     }
 #endif
     else {
         LOG_WARNING("suit: unsupported URL scheme!\n)");
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+        suit_pipeline_finish(comp->fetch_digest);
+#endif
         return res;
     }
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    /* wait for the writer thread also if the fetch failed */
+    int write_res = suit_pipeline_finish(comp->fetch_digest);
+    if (res == 0) {
+        res = write_res;
+    }
+#endif
+
     suit_component_set_flag(comp, SUIT_COMPONENT_STATE_FETCHED);
 
     if (res) {
@@ -479,6 +611,17 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return res;
     }
 
+#if defined(MODULE_SUIT_TRANSPORT_DECOMPRESS) && \
+    (defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS))
+    if (compression == SUIT_COMPRESSION_HEATSHRINK) {
+        LOG_INFO("Fetched %" PRIuSIZE " compressed bytes for %" PRIuSIZE
+                 " bytes, saved %" PRIuSIZE " bytes\n", _decompress.received,
+                 _decompress.offset,
+                 _decompress.offset > _decompress.received
+                     ? _decompress.offset - _decompress.received : 0);
+    }
+#endif
+
     LOG_DEBUG("Update OK\n");
     return SUIT_OK;
 }
@@ -509,6 +652,13 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
+#ifdef MODULE_SUIT_TRANSPORT_PIPELINE
+    if (suit_component_check_flag(component, SUIT_COMPONENT_STATE_DIGESTED)) {
+        /* no need to read back what was hashed while fetching */
+        memcpy(payload_digest, component->fetch_digest, sizeof(payload_digest));
+    }
+    else
+#endif
     if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
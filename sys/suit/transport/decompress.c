@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_suit_transport_decompress
+ * @{
+ *
+ * @file
+ * @brief       SUIT compressed payloads
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "suit/transport/decompress.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* hand all data the decoder can produce to the next stage */
+static int _drain(suit_decompress_t *ctx)
+{
+    HSD_poll_res poll_res;
+
+    do {
+        size_t len = 0;
+        poll_res = heatshrink_decoder_poll(&ctx->decoder, ctx->buf,
+                                           sizeof(ctx->buf), &len);
+        if (poll_res < 0) {
+            DEBUG("suit_decompress: poll failed: %d\n", (int)poll_res);
+            return -EINVAL;
+        }
+        if (len) {
+            int res = ctx->cb(ctx->arg, ctx->offset, ctx->buf, len, 1);
+            if (res < 0) {
+                return res;
+            }
+            ctx->offset += len;
+        }
+    } while (poll_res == HSDR_POLL_MORE);
+
+    return 0;
+}
+
+void suit_decompress_init(suit_decompress_t *ctx, coap_blockwise_cb_t cb,
+                          void *arg)
+{
+    heatshrink_decoder_reset(&ctx->decoder);
+    ctx->cb = cb;
+    ctx->arg = arg;
+    ctx->offset = 0;
+    ctx->received = 0;
+}
+
+int suit_decompress_apply(void *arg, size_t offset, uint8_t *buf, size_t len,
+                          int more)
+{
+    suit_decompress_t *ctx = arg;
+    (void)offset;
+
+    ctx->received += len;
+    while (len) {
+        size_t sunk = 0;
+        if (heatshrink_decoder_sink(&ctx->decoder, buf, len, &sunk) < 0) {
+            return -EINVAL;
+        }
+        buf += sunk;
+        len -= sunk;
+
+        int res = _drain(ctx);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (more) {
+        return 0;
+    }
+
+    HSD_finish_res finish_res;
+    while ((finish_res = heatshrink_decoder_finish(&ctx->decoder)) == HSDR_FINISH_MORE) {
+        size_t before = ctx->offset;
+        int res = _drain(ctx);
+        if (res < 0) {
+            return res;
+        }
+        if (ctx->offset == before) {
+            /* no progress, the payload is truncated */
+            return -EINVAL;
+        }
+    }
+    if (finish_res < 0) {
+        return -EINVAL;
+    }
+
+    DEBUG("suit_decompress: expanded %" PRIuSIZE " to %" PRIuSIZE " bytes\n",
+          ctx->received, ctx->offset);
+    /* lets the receiver check the size and finish the storage */
+    return ctx->cb(ctx->arg, ctx->offset, ctx->buf, 0, 0);
+}
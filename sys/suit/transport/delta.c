@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_suit_transport_delta
+ * @{
+ *
+ * @file
+ * @brief       SUIT delta payloads
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "suit/transport/delta.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _source_erase(void *dev, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)offset;
+    (void)len;
+    /* the running image is never written */
+    return -EROFS;
+}
+
+static int _source_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    suit_delta_t *delta = dev;
+
+    if ((offset > delta->source_len) || (len > delta->source_len - offset)) {
+        DEBUG("suit_delta: source read beyond image: 0x%" PRIxSIZE " + %" PRIuSIZE "\n",
+              offset, len);
+        return -EINVAL;
+    }
+    memcpy(dest, delta->source + offset, len);
+    return 0;
+}
+
+static int _source_write(void *dev, uint8_t *src, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)src;
+    (void)offset;
+    (void)len;
+    return -EROFS;
+}
+
+static int _flush(void *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _target_erase(void *dev, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)offset;
+    (void)len;
+    /* the storage backend erases ahead of writing */
+    return 0;
+}
+
+static int _target_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    (void)dev;
+    (void)dest;
+    (void)offset;
+    (void)len;
+    /* the storage backend may still buffer the data, see the note in the
+     * module documentation */
+    DEBUG("suit_delta: delta copies from the target window\n");
+    return -ENOTSUP;
+}
+
+static int _target_write(void *dev, uint8_t *src, size_t offset, size_t len)
+{
+    suit_delta_t *delta = dev;
+
+    if (offset != delta->offset) {
+        return -EINVAL;
+    }
+    int res = delta->cb(delta->arg, offset, src, len, 1);
+    if (res < 0) {
+        return res;
+    }
+    delta->offset += len;
+    return 0;
+}
+
+static const vcdiff_driver_t _source_driver = {
+    .erase = _source_erase,
+    .read = _source_read,
+    .write = _source_write,
+    .flush = _flush,
+};
+
+static const vcdiff_driver_t _target_driver = {
+    .erase = _target_erase,
+    .read = _target_read,
+    .write = _target_write,
+    .flush = _flush,
+};
+
+void suit_delta_init(suit_delta_t *delta, const void *source, size_t source_len,
+                     coap_blockwise_cb_t cb, void *arg)
+{
+    memset(delta, 0, sizeof(*delta));
+    delta->source = source;
+    delta->source_len = source_len;
+    delta->cb = cb;
+    delta->arg = arg;
+
+    vcdiff_init(&delta->vcdiff);
+    vcdiff_set_source_driver(&delta->vcdiff, &_source_driver, delta);
+    vcdiff_set_target_driver(&delta->vcdiff, &_target_driver, delta);
+}
+
+int suit_delta_apply(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more)
+{
+    suit_delta_t *delta = arg;
+    (void)offset;
+
+    int res = vcdiff_apply_delta(&delta->vcdiff, buf, len);
+    if (res < 0) {
+        DEBUG("suit_delta: decoding failed: %d\n", res);
+        return res;
+    }
+    if (more) {
+        return 0;
+    }
+
+    res = vcdiff_finish(&delta->vcdiff);
+    if (res < 0) {
+        DEBUG("suit_delta: incomplete delta: %d\n", res);
+        return res;
+    }
+    DEBUG("suit_delta: reconstructed %" PRIuSIZE " bytes\n", delta->offset);
+    /* lets the receiver check the size and finish the storage */
+    return delta->cb(delta->arg, delta->offset, buf, 0, 0);
+}
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_suit_transport_pipeline
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload storage implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "log.h"
+#include "macros/utils.h"
+#include "sema.h"
+#include "thread.h"
+
+#include "suit/transport/pipeline.h"
+
+#ifndef SUIT_PIPELINE_STACKSIZE
+/* storage backends writing to a file system need a larger stack */
+#define SUIT_PIPELINE_STACKSIZE (THREAD_STACKSIZE_LARGE)
+#endif
+
+#ifndef SUIT_PIPELINE_PRIO
+/* lower than the worker, so writing only takes time the worker spends
+ * waiting for the next block */
+#define SUIT_PIPELINE_PRIO      (THREAD_PRIORITY_MAIN)
+#endif
+
+/**
+ * @brief   A block handed to the writer thread
+ */
+typedef struct {
+    size_t offset;  /**< offset of the block in the payload */
+    size_t len;     /**< length of the block */
+    bool more;      /**< false for the last block of the payload */
+    uint8_t data[CONFIG_SUIT_PIPELINE_BUF_SIZE];    /**< block data */
+} _block_t;
+
+static _block_t _blocks[2];
+static uint8_t _put_idx;
+static uint8_t _get_idx;
+/* counts blocks free to fill and blocks ready to be written */
+static sema_t _free;
+static sema_t _filled;
+
+static const suit_manifest_t *_manifest;
+static suit_storage_t *_storage;
+/* first error of the storage backend */
+static int _res;
+static sha256_context_t _sha256;
+/* number of bytes hashed so far, the offset the next block has to start at */
+static size_t _hashed;
+/* a block was handed in out of order, the digest does not match the payload */
+static bool _out_of_order;
+
+static char _stack[SUIT_PIPELINE_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+static void *_writer_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        sema_wait(&_filled);
+        _block_t *block = &_blocks[_get_idx];
+        _get_idx = (_get_idx + 1) % ARRAY_SIZE(_blocks);
+
+        /* skip the rest of the payload after an error */
+        if (_res == 0) {
+            _res = suit_storage_write(_storage, _manifest, block->data,
+                                      block->offset, block->len);
+        }
+        if ((_res == 0) && !block->more) {
+            LOG_INFO("Finalizing payload store\n");
+            _res = suit_storage_finish(_storage, _manifest);
+        }
+
+        sema_post(&_free);
+    }
+
+    return NULL;
+}
+
+int suit_pipeline_start(const suit_manifest_t *manifest,
+                        suit_storage_t *storage)
+{
+    if (_pid == KERNEL_PID_UNDEF) {
+        sema_create(&_free, ARRAY_SIZE(_blocks));
+        sema_create(&_filled, 0);
+        _pid = thread_create(_stack, sizeof(_stack), SUIT_PIPELINE_PRIO, 0,
+                             _writer_thread, NULL, "suit writer");
+        if (_pid < 0) {
+            _pid = KERNEL_PID_UNDEF;
+            return -ENOMEM;
+        }
+    }
+
+    _manifest = manifest;
+    _storage = storage;
+    _res = 0;
+    _hashed = 0;
+    _out_of_order = false;
+    sha256_init(&_sha256);
+
+    return 0;
+}
+
+int suit_pipeline_put(size_t offset, const uint8_t *buf, size_t len, bool more)
+{
+    /* The digest only matches the stored payload if the blocks are
+     * contiguous. E.g. a short block followed by a block at the next full
+     * block size offset would leave a gap in the storage. */
+    if (_out_of_order || (offset != _hashed)) {
+        LOG_ERROR("suit_pipeline: block at %" PRIuSIZE ", expected %" PRIuSIZE
+                  "\n", offset, _hashed);
+        _out_of_order = true;
+        return -EINVAL;
+    }
+
+    /* hash while the writer thread is busy with the previous block */
+    sha256_update(&_sha256, buf, len);
+    _hashed += len;
+
+    do {
+        size_t n = MIN(len, sizeof(_blocks[0].data));
+
+        sema_wait(&_free);
+        if (_res < 0) {
+            sema_post(&_free);
+            return _res;
+        }
+
+        _block_t *block = &_blocks[_put_idx];
+        _put_idx = (_put_idx + 1) % ARRAY_SIZE(_blocks);
+        memcpy(block->data, buf, n);
+        block->offset = offset;
+        block->len = n;
+        block->more = more || (n < len);
+        sema_post(&_filled);
+
+        offset += n;
+        buf += n;
+        len -= n;
+    } while (len);
+
+    return 0;
+}
+
+int suit_pipeline_finish(uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    /* the writer is done once all blocks are free again */
+    for (unsigned i = 0; i < ARRAY_SIZE(_blocks); i++) {
+        sema_wait(&_free);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_blocks); i++) {
+        sema_post(&_free);
+    }
+
+    sha256_final(&_sha256, digest);
+    return _out_of_order ? -EINVAL : _res;
+}
@@ -54,8 +54,16 @@ void trickle_interval(trickle_t *trickle)
     /* old_interval == trickle->I / 2 */
     trickle->t = random_uint32_range(old_interval, trickle->I);
 
+#if MODULE_ZTIMER_SLACK
+    /* RFC 6206 allows to transmit anywhere in [I/2, I), so the transmission
+     * may share the wakeup of another timer up to the end of the interval */
+    ztimer_set_msg_with_slack(ZTIMER_MSEC, &trickle->msg_timer,
+                              (trickle->t + diff), (trickle->I - trickle->t - 1),
+                              &trickle->msg, trickle->pid);
+#else
     ztimer_set_msg(ZTIMER_MSEC, &trickle->msg_timer, (trickle->t + diff),
                    &trickle->msg, trickle->pid);
+#endif
 }
 
 void trickle_reset_timer(trickle_t *trickle)
@@ -27,6 +27,8 @@
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
+#include "irq.h"
+#include "macros/utils.h"
 #include "modules.h"
 #include "mutex.h"
 #include "sched.h"
@@ -75,6 +77,56 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Lookup tables of all mounted file systems
+ *
+ * Both tables hold the mounts sorted by decreasing length of the mount point
+ * and are terminated by NULL. One of them is in use, the other one is
+ * rebuilt from _vfs_mounts_list on each (un)mount, so _find_mount() can
+ * search the table in use without holding _mount_mutex.
+ */
+static vfs_mount_t *_mount_tables[2][CONFIG_VFS_MOUNT_TABLE_NUMOF + 1];
+
+/**
+ * @internal
+ * @brief Index of the table in _mount_tables in use
+ */
+static uint8_t _mount_table_cur;
+
+/**
+ * @internal
+ * @brief There are more mounts than fit into the lookup table
+ */
+static bool _mount_table_overflow;
+
+/**
+ * @internal
+ * @brief Sequence counter of the mount table
+ *
+ * Odd while mounts are being changed. Lookups done while it changes are
+ * retried.
+ */
+static uint32_t _mount_seq;
+
+#if IS_USED(MODULE_VFS_DENTRY_CACHE)
+/**
+ * @internal
+ * @brief Cached mount of a directory
+ *
+ * Only directories with no mount point below them are cached, so all paths
+ * in the directory belong to the same mount.
+ */
+typedef struct {
+    vfs_mount_t *mountp;    /**< mount of the directory, NULL if unused */
+    uint32_t seq;           /**< _mount_seq the entry is valid for */
+    uint8_t len;            /**< length of the directory name */
+    char dir[CONFIG_VFS_DENTRY_PATH_MAX]; /**< directory, without trailing '/' */
+} vfs_dentry_t;
+
+static vfs_dentry_t _vfs_dentries[CONFIG_VFS_DENTRY_CACHE_NUMOF];
+#endif
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -134,6 +186,28 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
  */
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path);
 
+/**
+ * @internal
+ * @brief Make _find_mount() wait until the mounts are changed
+ * @pre   _mount_mutex is held
+ */
+static void _mount_change_begin(void);
+
+/**
+ * @internal
+ * @brief Publish changed mounts to _find_mount()
+ * @pre   _mount_mutex is held and _mount_change_begin() was called
+ */
+static void _mount_change_end(void);
+
+/**
+ * @internal
+ * @brief Let _find_mount() continue with the mounts it used before
+ * @pre   _mount_mutex is held, _mount_change_begin() was called and the
+ *        mounts were not changed since
+ */
+static void _mount_change_abort(void);
+
 /**
  * @internal
  * @brief Check that a given fd number is valid
@@ -148,6 +222,259 @@ static inline int _fd_is_valid(int fd);
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
+{
+    if (filp->f_op->lseek == NULL) {
+        /* driver does not implement lseek() */
+        /* default seek functionality is naive */
+        switch (whence) {
+            case SEEK_SET:
+                break;
+            case SEEK_CUR:
+                off += filp->pos;
+                break;
+            case SEEK_END:
+                /* we could use fstat here, but most file system drivers will
+                 * likely already implement lseek in a more efficient fashion */
+                return -EINVAL;
+            default:
+                return -EINVAL;
+        }
+        if (off < 0) {
+            /* the resulting file offset would be negative */
+            return -EINVAL;
+        }
+        filp->pos = off;
+
+        return off;
+    }
+    return filp->f_op->lseek(filp, off, whence);
+}
+
+#if IS_USED(MODULE_VFS_BUFFERED)
+/**
+ * @internal
+ * @brief State of a file buffer
+ */
+enum {
+    VFS_BUFFER_EMPTY,   /**< buffer holds no data */
+    VFS_BUFFER_READ,    /**< buffer holds data read ahead */
+    VFS_BUFFER_WRITE,   /**< buffer holds data not yet written */
+};
+
+/**
+ * @internal
+ * @brief Read/write buffer of a file descriptor
+ *
+ * With data read ahead, the file system's position is at the end of the
+ * buffered data. With data to write, it is at the start of the buffered data.
+ */
+struct vfs_buffer {
+    size_t len;         /**< number of valid bytes in data */
+    size_t cur;         /**< read position in data */
+    uint8_t state;      /**< VFS_BUFFER_EMPTY, _READ or _WRITE */
+    bool sequential;    /**< last operation was a read at the current position */
+    bool used;          /**< buffer is assigned to a file descriptor */
+    uint8_t data[CONFIG_VFS_BUFFER_SIZE]; /**< buffered data */
+};
+
+static struct vfs_buffer _vfs_buffers[CONFIG_VFS_BUFFER_NUMOF];
+
+static void _buffer_reset(struct vfs_buffer *buf)
+{
+    buf->len = 0;
+    buf->cur = 0;
+    buf->state = VFS_BUFFER_EMPTY;
+}
+
+/**
+ * @internal
+ * @brief Empty the buffer and move the file system's position to the
+ *        position seen by the application
+ *
+ * Read-ahead starts over after this, as the file is no longer read
+ * sequentially.
+ */
+static int _buffer_sync(vfs_file_t *filp)
+{
+    struct vfs_buffer *buf = filp->buffer;
+    int res = 0;
+
+    buf->sequential = false;
+    if (buf->state == VFS_BUFFER_READ) {
+        /* give back what was read ahead but not consumed */
+        off_t unread = buf->len - buf->cur;
+        if (unread) {
+            off_t pos = _lseek(filp, -unread, SEEK_CUR);
+            res = (pos < 0) ? pos : 0;
+        }
+    }
+    else if (buf->state == VFS_BUFFER_WRITE) {
+        for (size_t done = 0; done < buf->len;) {
+            ssize_t written = filp->f_op->write(filp, &buf->data[done],
+                                                buf->len - done);
+            if (written <= 0) {
+                /* keep what is left, so a later call can try again */
+                memmove(buf->data, &buf->data[done], buf->len - done);
+                buf->len -= done;
+                return (written < 0) ? written : -EIO;
+            }
+            done += written;
+        }
+    }
+
+    _buffer_reset(buf);
+    return res;
+}
+
+static ssize_t _buffer_read(vfs_file_t *filp, void *dest, size_t count)
+{
+    struct vfs_buffer *buf = filp->buffer;
+    uint8_t *_dest = dest;
+    size_t done = 0;
+
+    if (buf->state == VFS_BUFFER_WRITE) {
+        int res = _buffer_sync(filp);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    if (buf->state == VFS_BUFFER_READ) {
+        done = MIN(count, buf->len - buf->cur);
+        memcpy(_dest, &buf->data[buf->cur], done);
+        buf->cur += done;
+        if (buf->cur == buf->len) {
+            _buffer_reset(buf);
+        }
+        if (done == count) {
+            return done;
+        }
+    }
+
+    /* the buffer is empty now, read ahead only if the file is read
+     * sequentially and the request does not fill the buffer anyway */
+    ssize_t res;
+    if (!buf->sequential || (count - done >= sizeof(buf->data))) {
+        buf->sequential = true;
+        res = filp->f_op->read(filp, &_dest[done], count - done);
+        if (res < 0) {
+            return done ? (ssize_t)done : res;
+        }
+        return done + res;
+    }
+
+    res = filp->f_op->read(filp, buf->data, sizeof(buf->data));
+    if (res <= 0) {
+        return done ? (ssize_t)done : res;
+    }
+
+    size_t n = MIN(count - done, (size_t)res);
+    memcpy(&_dest[done], buf->data, n);
+    if (n < (size_t)res) {
+        buf->len = res;
+        buf->cur = n;
+        buf->state = VFS_BUFFER_READ;
+    }
+    return done + n;
+}
+
+static ssize_t _buffer_write(vfs_file_t *filp, const void *src, size_t count)
+{
+    struct vfs_buffer *buf = filp->buffer;
+
+    buf->sequential = false;
+    if ((buf->state == VFS_BUFFER_READ) ||
+        (buf->len + count > sizeof(buf->data))) {
+        int res = _buffer_sync(filp);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    if (count >= sizeof(buf->data)) {
+        return filp->f_op->write(filp, src, count);
+    }
+
+    memcpy(&buf->data[buf->len], src, count);
+    buf->len += count;
+    buf->state = VFS_BUFFER_WRITE;
+    return count;
+}
+
+static int _buffer_set(vfs_file_t *filp, bool enable)
+{
+    if (!enable) {
+        if (filp->buffer == NULL) {
+            return 0;
+        }
+        int res = _buffer_sync(filp);
+        if (res < 0) {
+            return res;
+        }
+        filp->buffer->used = false;
+        filp->buffer = NULL;
+        return 0;
+    }
+
+    if (filp->buffer != NULL) {
+        return 0;
+    }
+
+    int res = -ENOMEM;
+    mutex_lock(&_open_mutex);
+    for (unsigned i = 0; i < CONFIG_VFS_BUFFER_NUMOF; i++) {
+        if (!_vfs_buffers[i].used) {
+            _vfs_buffers[i].used = true;
+            _vfs_buffers[i].sequential = false;
+            _buffer_reset(&_vfs_buffers[i]);
+            filp->buffer = &_vfs_buffers[i];
+            res = 0;
+            break;
+        }
+    }
+    mutex_unlock(&_open_mutex);
+    return res;
+}
+
+static int _sync(vfs_file_t *filp)
+{
+    return filp->buffer ? _buffer_sync(filp) : 0;
+}
+
+static ssize_t _read(vfs_file_t *filp, void *dest, size_t count)
+{
+    if (filp->buffer) {
+        return _buffer_read(filp, dest, count);
+    }
+    return filp->f_op->read(filp, dest, count);
+}
+
+static ssize_t _write(vfs_file_t *filp, const void *src, size_t count)
+{
+    if (filp->buffer) {
+        return _buffer_write(filp, src, count);
+    }
+    return filp->f_op->write(filp, src, count);
+}
+#else
+static inline int _sync(vfs_file_t *filp)
+{
+    (void)filp;
+    return 0;
+}
+
+static inline ssize_t _read(vfs_file_t *filp, void *dest, size_t count)
+{
+    return filp->f_op->read(filp, dest, count);
+}
+
+static inline ssize_t _write(vfs_file_t *filp, const void *src, size_t count)
+{
+    return filp->f_op->write(filp, src, count);
+}
+#endif
+
 int vfs_close(int fd)
 {
     DEBUG("vfs_close: %d\n", fd);
@@ -156,10 +483,19 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+#if IS_USED(MODULE_VFS_BUFFERED)
+    if (filp->buffer) {
+        /* the file is closed even if the buffered data can not be written */
+        res = _buffer_sync(filp);
+        filp->buffer->used = false;
+        filp->buffer = NULL;
+    }
+#endif
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
-        res = filp->f_op->close(filp);
+        int close_res = filp->f_op->close(filp);
+        res = (res < 0) ? res : close_res;
     }
     _free_fd(fd);
     return res;
@@ -180,6 +516,12 @@ int vfs_fcntl(int fd, int cmd, int arg)
             /* Get file flags */
             DEBUG("vfs_fcntl: GETFL: %d\n", filp->flags);
             return filp->flags;
+#if IS_USED(MODULE_VFS_BUFFERED)
+        case VFS_F_SETBUF:
+            return _buffer_set(filp, arg != 0);
+        case VFS_F_GETBUF:
+            return filp->buffer != NULL;
+#endif
         default:
             break;
     }
@@ -205,6 +547,11 @@ int vfs_fstat(int fd, struct stat *buf)
         /* driver does not implement fstat() */
         return -EINVAL;
     }
+    /* the size reported must include data still in the buffer */
+    res = _sync(filp);
+    if (res < 0) {
+        return res;
+    }
     memset(buf, 0, sizeof(*buf));
     return filp->f_op->fstat(filp, buf);
 }
@@ -250,31 +597,11 @@ off_t vfs_lseek(int fd, off_t off, int whence)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
-    if (filp->f_op->lseek == NULL) {
-        /* driver does not implement lseek() */
-        /* default seek functionality is naive */
-        switch (whence) {
-            case SEEK_SET:
-                break;
-            case SEEK_CUR:
-                off += filp->pos;
-                break;
-            case SEEK_END:
-                /* we could use fstat here, but most file system drivers will
-                 * likely already implement lseek in a more efficient fashion */
-                return -EINVAL;
-            default:
-                return -EINVAL;
-        }
-        if (off < 0) {
-            /* the resulting file offset would be negative */
-            return -EINVAL;
-        }
-        filp->pos = off;
-
-        return off;
+    res = _sync(filp);
+    if (res < 0) {
+        return res;
     }
-    return filp->f_op->lseek(filp, off, whence);
+    return _lseek(filp, off, whence);
 }
 
 int vfs_open(const char *name, int flags, mode_t mode)
@@ -353,7 +680,43 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         return res;
     }
 
-    return filp->f_op->read(filp, dest, count);
+    return _read(filp, dest, count);
+}
+
+ssize_t vfs_read_iolist(int fd, iolist_t *snip, void *buf, size_t count)
+{
+    DEBUG("vfs_read_iolist: %d, %p, %p, %" PRIuSIZE "\n",
+          fd, (void *)snip, buf, count);
+    vfs_file_t *filp = NULL;
+
+    int res = _prep_read(fd, buf, &filp);
+    if (res) {
+        DEBUG("vfs_read_iolist: can't open file - %d\n", res);
+        return res;
+    }
+
+    ssize_t len;
+    if (filp->f_op->map) {
+        const void *data = NULL;
+        /* give back what was read ahead, the file system has to be at the
+         * position the application expects */
+        res = _sync(filp);
+        if (res < 0) {
+            return res;
+        }
+        len = filp->f_op->map(filp, &data, count);
+        snip->iol_base = (void *)data;
+    }
+    else {
+        len = _read(filp, buf, count);
+        snip->iol_base = buf;
+    }
+
+    if (len < 0) {
+        return len;
+    }
+    snip->iol_len = len;
+    return len;
 }
 
 ssize_t vfs_readline(int fd, char *dst, size_t len_max)
@@ -369,7 +732,7 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
 
     const char *start = dst;
     while (len_max) {
-        int res = filp->f_op->read(filp, dst, 1);
+        int res = _read(filp, dst, 1);
         if (res < 0) {
             break;
         }
@@ -410,7 +773,7 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+    return _write(filp, src, count);
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -441,6 +804,10 @@ int vfs_fsync(int fd)
         /* File not open for writing */
         return -EBADF;
     }
+    res = _sync(filp);
+    if (res < 0) {
+        return res;
+    }
     if (filp->f_op->fsync == NULL) {
         /* driver does not implement fsync() */
         return -EINVAL;
@@ -599,7 +966,9 @@ int vfs_mount(vfs_mount_t *mountp)
         }
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
+    _mount_change_begin();
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _mount_change_end();
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -621,20 +990,24 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         DEBUG("vfs_umount: invalid fs\n");
         return -EINVAL;
     }
+    /* check_mount() released the mutex as the fs is mounted */
+    mutex_lock(&_mount_mutex);
+    /* lookups starting from here wait for us, those in progress retry */
+    _mount_change_begin();
     DEBUG("vfs_umount: -> \"%s\" open=%u\n", mountp->mount_point,
           (unsigned)atomic_load_u16(&mountp->open_files));
+    int res = 0;
     if (atomic_load_u16(&mountp->open_files) > 0 && !force) {
-        mutex_unlock(&_mount_mutex);
-        return -EBUSY;
+        res = -EBUSY;
+        goto fail;
     }
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->umount != NULL) {
-            int res = mountp->fs->fs_op->umount(mountp);
+            res = mountp->fs->fs_op->umount(mountp);
             if (res < 0) {
                 /* umount failed */
                 DEBUG("vfs_umount: ERR %d!\n", res);
-                mutex_unlock(&_mount_mutex);
-                return res;
+                goto fail;
             }
         }
     }
@@ -643,11 +1016,18 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
     if (node == NULL) {
         /* not found */
         DEBUG("vfs_umount: ERR not mounted!\n");
-        mutex_unlock(&_mount_mutex);
-        return -EINVAL;
+        res = -EINVAL;
+        goto fail;
     }
+    _mount_change_end();
     mutex_unlock(&_mount_mutex);
     return 0;
+
+fail:
+    /* nothing was removed, the mount table and cached lookups stay valid */
+    _mount_change_abort();
+    mutex_unlock(&_mount_mutex);
+    return res;
 }
 
 int vfs_rename(const char *from_path, const char *to_path)
@@ -895,6 +1275,35 @@ int vfs_statvfs(const char *restrict path, struct statvfs *restrict buf)
     return res;
 }
 
+int vfs_maintain(const char *path)
+{
+    DEBUG("vfs_maintain: \"%s\"\n", path);
+    if (path == NULL) {
+        return -EINVAL;
+    }
+    const char *rel_path;
+    vfs_mount_t *mountp;
+    int res;
+    res = _find_mount(&mountp, path, &rel_path);
+    /* _find_mount implicitly increments the open_files count on success */
+    if (res < 0) {
+        /* No mount point maps to the requested file name */
+        DEBUG("vfs_maintain: no matching mount\n");
+        return res;
+    }
+    if ((mountp->fs->fs_op == NULL) || (mountp->fs->fs_op->maintain == NULL)) {
+        DEBUG("vfs_maintain: maintain not supported by fs!\n");
+        res = -ENOTSUP;
+    }
+    else {
+        res = mountp->fs->fs_op->maintain(mountp);
+    }
+    /* remember to decrement the open_files count */
+    uint16_t before = atomic_fetch_sub_u16(&mountp->open_files, 1);
+    assume(before > 0);
+    return res;
+}
+
 int vfs_bind(int fd, int flags, const vfs_file_ops_t *f_op, void *private_data)
 {
     DEBUG("vfs_bind: %d, %d, %p, %p\n", fd, flags, (void*)f_op, private_data);
@@ -1130,23 +1539,49 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     filp->f_op = f_op;
     filp->flags = flags;
     filp->pos = 0;
+#if IS_USED(MODULE_VFS_BUFFERED)
+    filp->buffer = NULL;
+#endif
     filp->private_data.ptr = private_data;
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+/**
+ * @internal
+ * @brief Check whether @p mountp is the mount point of @p name or one of its
+ *        parent directories
+ */
+static bool _mount_matches(const vfs_mount_t *mountp, const char *name,
+                           size_t name_len)
 {
-    size_t longest_match = 0;
-    size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
+    size_t len = mountp->mount_point_len;
+
+    if (len > name_len) {
+        /* path name is shorter than the mount point name */
+        return false;
+    }
+    if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
+        /* name does not have a directory separator where mount point name ends */
+        return false;
+    }
+    /* mount_point is a prefix of name */
+    return strncmp(name, mountp->mount_point, len) == 0;
+}
 
+/**
+ * @internal
+ * @brief Find the mount of @p name by walking _vfs_mounts_list
+ * @pre   _mount_mutex is held
+ */
+static vfs_mount_t *_find_mount_in_list(const char *name, size_t name_len)
+{
     clist_node_t *node = _vfs_mounts_list.next;
     if (node == NULL) {
         /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+        return NULL;
     }
     vfs_mount_t *mountp = NULL;
+    size_t longest_match = 0;
     do {
         node = node->next;
         vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
@@ -1155,16 +1590,7 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             /* Already found a longer prefix */
             continue;
         }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
-            continue;
-        }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
-        }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
+        if (_mount_matches(it, name, name_len)) {
             /* special check for mount_point == "/" */
             if (len > 1) {
                 longest_match = len;
@@ -1172,26 +1598,221 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             mountp = it;
         }
     } while (node != _vfs_mounts_list.next);
-    if (mountp == NULL) {
-        /* not found */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+    return mountp;
+}
+
+/**
+ * @internal
+ * @brief Rebuild the mount lookup table from _vfs_mounts_list and make it
+ *        the one in use
+ * @pre   _mount_mutex is held
+ */
+static void _mount_table_update(void)
+{
+    uint8_t next = !_mount_table_cur;
+    vfs_mount_t **table = _mount_tables[next];
+    unsigned numof = 0;
+
+    _mount_table_overflow = false;
+    clist_node_t *node = _vfs_mounts_list.next;
+    if (node != NULL) {
+        do {
+            node = node->next;
+            vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+            if (numof == CONFIG_VFS_MOUNT_TABLE_NUMOF) {
+                _mount_table_overflow = true;
+                break;
+            }
+            /* insertion sort by decreasing mount point length */
+            unsigned i = numof++;
+            for (; (i > 0) && (table[i - 1]->mount_point_len < it->mount_point_len); i--) {
+                table[i] = table[i - 1];
+            }
+            table[i] = it;
+        } while (node != _vfs_mounts_list.next);
     }
-    /* Increment open files counter for this mount */
-    uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
-    /* We cannot use assume() here, an overflow could occur in absence of
-     * any bugs and should also be checked for in production code. We use
-     * expect() here, which was actually written for unit tests but works
-     * here as well */
-    expect(before < UINT16_MAX);
-    mutex_unlock(&_mount_mutex);
+    table[numof] = NULL;
+
+    _mount_table_cur = next;
+}
+
+static void _mount_change_begin(void)
+{
+    atomic_fetch_add_u32(&_mount_seq, 1);
+}
+
+static void _mount_change_end(void)
+{
+    _mount_table_update();
+    atomic_fetch_add_u32(&_mount_seq, 1);
+}
+
+static void _mount_change_abort(void)
+{
+    /* lookups that saw the sequence number before the change attempt are
+     * still valid, as nothing changed */
+    atomic_fetch_sub_u32(&_mount_seq, 1);
+}
+
+#if IS_USED(MODULE_VFS_DENTRY_CACHE)
+static vfs_dentry_t *_dentry_slot(const char *dir, size_t len)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)dir[i]) * 16777619u;
+    }
+    return &_vfs_dentries[hash % CONFIG_VFS_DENTRY_CACHE_NUMOF];
+}
+
+static vfs_mount_t *_dentry_lookup(const char *dir, size_t len, uint32_t seq)
+{
+    vfs_dentry_t *entry = _dentry_slot(dir, len);
+    vfs_mount_t *mountp = NULL;
+
+    /* entries are written by all threads looking up paths */
+    unsigned irq_state = irq_disable();
+    if ((entry->mountp != NULL) && (entry->seq == seq) && (entry->len == len) &&
+        (memcmp(entry->dir, dir, len) == 0)) {
+        mountp = entry->mountp;
+    }
+    irq_restore(irq_state);
+    return mountp;
+}
+
+static void _dentry_add(const char *dir, size_t len, uint32_t seq,
+                        vfs_mount_t *mountp)
+{
+    vfs_dentry_t *entry = _dentry_slot(dir, len);
+
+    unsigned irq_state = irq_disable();
+    entry->mountp = mountp;
+    entry->seq = seq;
+    entry->len = len;
+    memcpy(entry->dir, dir, len);
+    irq_restore(irq_state);
+}
+#endif
+
+/**
+ * @internal
+ * @brief Find the mount of @p name in the lookup table in use
+ *
+ * May return a wrong result if the mounts are changed concurrently, the
+ * caller has to check _mount_seq afterwards.
+ */
+static vfs_mount_t *_find_mount_in_table(const char *name, size_t name_len,
+                                         uint32_t seq)
+{
+    vfs_mount_t *const *table = _mount_tables[_mount_table_cur];
+    vfs_mount_t *mountp = NULL;
+
+#if IS_USED(MODULE_VFS_DENTRY_CACHE)
+    /* directory part of name, without trailing '/' */
+    size_t dir_len = name_len;
+    while ((dir_len > 0) && (name[dir_len - 1] != '/')) {
+        dir_len--;
+    }
+    dir_len = dir_len ? dir_len - 1 : 0;
+    bool cacheable = dir_len < CONFIG_VFS_DENTRY_PATH_MAX;
+
+    if (cacheable) {
+        mountp = _dentry_lookup(name, dir_len, seq);
+        if (mountp) {
+            return mountp;
+        }
+    }
+#else
+    (void)seq;
+#endif
+
+    /* the first match is the longest one */
+    for (unsigned i = 0; table[i] != NULL; i++) {
+#if IS_USED(MODULE_VFS_DENTRY_CACHE)
+        size_t len = table[i]->mount_point_len;
+        if ((len > dir_len) && (len > 1) && (table[i]->mount_point[dir_len] == '/') &&
+            (strncmp(table[i]->mount_point, name, dir_len) == 0)) {
+            /* mount point below the directory, paths in it may belong to
+             * different mounts */
+            cacheable = false;
+        }
+#endif
+        if (_mount_matches(table[i], name, name_len)) {
+            mountp = table[i];
+            break;
+        }
+    }
+
+#if IS_USED(MODULE_VFS_DENTRY_CACHE)
+    if (cacheable && mountp) {
+        _dentry_add(name, dir_len, seq, mountp);
+    }
+#endif
+    return mountp;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t name_len = strlen(name);
+    vfs_mount_t *mountp;
+
+    while (1) {
+        uint32_t seq = atomic_load_u32(&_mount_seq);
+        if (seq & 1) {
+            /* mounts are being changed, wait until it is done */
+            mutex_lock(&_mount_mutex);
+            mutex_unlock(&_mount_mutex);
+            continue;
+        }
+
+        bool locked = _mount_table_overflow;
+        if (locked) {
+            mutex_lock(&_mount_mutex);
+            mountp = _find_mount_in_list(name, name_len);
+        }
+        else {
+            mountp = _find_mount_in_table(name, name_len, seq);
+        }
+
+        if (mountp == NULL) {
+            if (locked) {
+                mutex_unlock(&_mount_mutex);
+            }
+            if (atomic_load_u32(&_mount_seq) != seq) {
+                continue;
+            }
+            /* not found */
+            return -ENOENT;
+        }
+
+        /* Increment open files counter for this mount */
+        uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
+        /* We cannot use assume() here, an overflow could occur in absence of
+         * any bugs and should also be checked for in production code. We use
+         * expect() here, which was actually written for unit tests but works
+         * here as well */
+        expect(before < UINT16_MAX);
+        if (locked) {
+            mutex_unlock(&_mount_mutex);
+        }
+
+        /* vfs_umount() checks open_files after incrementing _mount_seq, so
+         * either it sees our reference or we see its change */
+        if (atomic_load_u32(&_mount_seq) == seq) {
+            break;
+        }
+        atomic_fetch_sub_u16(&mountp->open_files, 1);
+    }
+
     *mountpp = mountp;
 
     if (rel_path != NULL) {
         if (mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) {
             *rel_path = name;
+        } else if (mountp->mount_point_len > 1) {
+            *rel_path = name + mountp->mount_point_len;
         } else {
-            *rel_path = name + longest_match;
+            *rel_path = name;
         }
     }
     return 0;
@@ -37,7 +37,8 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t slack);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
@@ -156,7 +157,8 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -192,7 +194,7 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
+    _add_entry_to_list(clock, &timer->base, slack);
     _ztimer_update(clock);
 
     irq_restore(state);
@@ -213,7 +215,21 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    return _ztimer_set(clock, timer, val, 0);
+}
+
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack)
+{
+    return _ztimer_set(clock, timer, val, slack);
+}
+#endif
+
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t slack)
 {
     uint32_t delta_sum = 0;
 
@@ -237,6 +253,15 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         list = list->next;
     }
 
+    /* If the next timer expires within the slack of the new entry, let the
+     * new entry expire together with it to save a wakeup */
+    if (slack && list->next &&
+        (list->next->offset + delta_sum) - entry->offset <= slack) {
+        delta_sum += list->next->offset;
+        entry->offset = delta_sum;
+        list = list->next;
+    }
+
     /* Insert into list */
     entry->next = list->next;
     entry->offset -= delta_sum;
@@ -501,6 +526,21 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 }
 
+uint32_t ztimer_time_to_next(ztimer_clock_t *clock)
+{
+    uint32_t res = UINT32_MAX;
+    unsigned state = irq_disable();
+
+    if (clock->list.next) {
+        uint32_t target = clock->list.offset + clock->list.next->offset;
+        int32_t diff = (int32_t)(target - ztimer_now(clock));
+        res = (diff > 0) ? (uint32_t)diff : 0;
+    }
+
+    irq_restore(state);
+    return res;
+}
+
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
     const ztimer_base_t *entry = &clock->list;
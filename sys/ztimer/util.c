@@ -106,6 +106,16 @@ void ztimer_set_msg(ztimer_clock_t *clock, ztimer_t *timer, uint32_t offset,
     ztimer_set(clock, timer, offset);
 }
 
+#if MODULE_ZTIMER_SLACK
+void ztimer_set_msg_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t offset, uint32_t slack, msg_t *msg,
+                               kernel_pid_t target_pid)
+{
+    _setup_msg(timer, msg, target_pid);
+    ztimer_set_with_slack(clock, timer, offset, slack);
+}
+#endif
+
 int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg,
                                uint32_t timeout)
 {
@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the GNRC IPv6 data path
+ *
+ * Ethernet frames are injected into a `netdev_test` device and the time until
+ * the resulting frame is handed back to the device for sending is measured:
+ *
+ * - `gnrc_ipv6_fwd`: a UDP datagram to an off-link destination is forwarded
+ *   to a static next hop
+ * - `gnrc_udp_echo`: a UDP datagram to the node is echoed back by a
+ *   `sock_udp` echo server
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define ECHO_PORT           (7U)
+#define PAYLOAD_LEN         (64U)
+#define FRAME_LEN           (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                             sizeof(udp_hdr_t) + PAYLOAD_LEN)
+
+static const uint8_t _own_mac[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const uint8_t _nbr_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+static const ipv6_addr_t _nbr_link_local = { .u8 = {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00,
+    } };
+static const ipv6_addr_t _fwd_src = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01,
+        0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01,
+    } };
+static const ipv6_addr_t _fwd_dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd,
+        0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00,
+    } };
+
+static netdev_test_t _netdev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _echo_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _fwd_frame[FRAME_LEN];
+static uint8_t _echo_frame[FRAME_LEN];
+static const uint8_t *_rx_frame;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static void _build_frame(uint8_t *frame, const ipv6_addr_t *src,
+                         const ipv6_addr_t *dst, uint16_t dst_port)
+{
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    uint8_t *payload = frame + FRAME_LEN - PAYLOAD_LEN;
+
+    memcpy(eth.dst, _own_mac, sizeof(eth.dst));
+    memcpy(eth.src, _nbr_mac, sizeof(eth.src));
+    eth.type = byteorder_htons(ETHERTYPE_IPV6);
+
+    memset(&ipv6, 0, sizeof(ipv6));
+    ipv6_hdr_set_version(&ipv6);
+    ipv6.len = byteorder_htons(sizeof(udp) + PAYLOAD_LEN);
+    ipv6.nh = PROTNUM_UDP;
+    ipv6.hl = 64;
+    ipv6.src = *src;
+    ipv6.dst = *dst;
+
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        payload[i] = i;
+    }
+    udp.src_port = byteorder_htons(0xf0b0);
+    udp.dst_port = byteorder_htons(dst_port);
+    udp.length = ipv6.len;
+    udp.checksum = byteorder_htons(0);
+
+    uint16_t csum = ipv6_hdr_inet_csum(0, &ipv6, PROTNUM_UDP,
+                                       sizeof(udp) + PAYLOAD_LEN);
+    csum = inet_csum(csum, (uint8_t *)&udp, sizeof(udp));
+    csum = inet_csum(csum, payload, PAYLOAD_LEN);
+    csum = ~csum;
+    udp.checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+
+    memcpy(frame, &eth, sizeof(eth));
+    memcpy(frame + sizeof(eth), &ipv6, sizeof(ipv6));
+    memcpy(frame + sizeof(eth) + sizeof(ipv6), &udp, sizeof(udp));
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = iolist_size(iolist);
+    const uint8_t *l2_payload = iolist->iol_next ? iolist->iol_next->iol_base
+                                                 : NULL;
+
+    (void)dev;
+    /* only count the UDP datagrams we triggered, ignore NDP and friends */
+    if ((len == FRAME_LEN) && (l2_payload != NULL) &&
+        (((const ipv6_hdr_t *)l2_payload)->nh == PROTNUM_UDP)) {
+        mutex_unlock(&_sent);
+    }
+    return len;
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+
+    if (buf == NULL) {
+        return FRAME_LEN;
+    }
+    if (len < (int)FRAME_LEN) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _rx_frame, FRAME_LEN);
+    return FRAME_LEN;
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_own_mac));
+    memcpy(value, _own_mac, sizeof(_own_mac));
+    return sizeof(_own_mac);
+}
+
+static void *_echo_thread(void *arg)
+{
+    static uint8_t buf[PAYLOAD_LEN];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+
+    (void)arg;
+    local.port = ECHO_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    while (1) {
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT,
+                                    &remote);
+        if (res >= 0) {
+            sock_udp_send(&sock, buf, res, &remote);
+        }
+    }
+
+    return NULL;
+}
+
+static void _inject(void *arg)
+{
+    _rx_frame = arg;
+    netdev_trigger_event_isr(&_netdev.netdev.netdev);
+    mutex_lock(&_sent);
+}
+
+static void _run(const char *name, uint8_t *frame)
+{
+    const benchmark_case_t bench = {
+        .name = name,
+        .func = _inject,
+        .arg = frame,
+    };
+    benchmark_stats_t stats;
+
+    expect(benchmark_run(&bench, &stats) == 0);
+    benchmark_print_json(name, &stats);
+    benchmark_print_rate_json(name, &stats);
+}
+
+static void _init(void)
+{
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_send_cb(&_netdev, _netdev_send);
+    netdev_test_set_recv_cb(&_netdev, _netdev_recv);
+    netdev_test_set_isr_cb(&_netdev, _netdev_isr);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "bench_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    gnrc_ipv6_nib_init();
+    gnrc_ipv6_nib_init_iface(&_netif);
+    gnrc_ipv6_nib_iface_up(&_netif);
+
+    /* skip DAD for the link-local address */
+    expect(!ipv6_addr_is_unspecified(&_netif.ipv6.addrs[0]));
+    _netif.ipv6.addrs_flags[0] &= ~GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_MASK;
+    _netif.ipv6.addrs_flags[0] |= GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+
+    /* static neighbor and route, so no address resolution is needed */
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif.pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_fwd_dst, 64, &_nbr_link_local,
+                                _netif.pid, 0) == 0);
+
+    _build_frame(_fwd_frame, &_fwd_src, &_fwd_dst, ECHO_PORT + 1);
+    _build_frame(_echo_frame, &_nbr_link_local, &_netif.ipv6.addrs[0],
+                 ECHO_PORT);
+
+    thread_create(_echo_stack, sizeof(_echo_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _echo_thread, NULL, "udp_echo");
+}
+
+int main(void)
+{
+    _init();
+
+    _run("gnrc_ipv6_fwd", _fwd_frame);
+    _run("gnrc_udp_echo", _echo_frame);
+
+    return 0;
+}
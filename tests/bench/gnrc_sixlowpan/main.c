@@ -0,0 +1,330 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the GNRC 6LoWPAN data path
+ *
+ * A `netdev_test` IEEE 802.15.4 device is used to measure:
+ *
+ * - `gnrc_sixlowpan_iphc_compress`: sending a small UDP datagram to a
+ *   link-local neighbor until the IPHC compressed frame is handed to the device
+ * - `gnrc_sixlowpan_iphc_decompress`: injecting that frame (with the MAC
+ *   addresses swapped) until the UDP datagram is delivered to the application
+ * - `gnrc_sixlowpan_frag`: sending a datagram that needs fragmentation until
+ *   the last fragment is handed to the device
+ * - `gnrc_sixlowpan_reass`: injecting those fragments until the reassembled
+ *   datagram is delivered to the application
+ *
+ * The frames to inject are captured from the send path during
+ * initialization, so they always match what the stack itself produces.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/udp.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define PORT                (61616U)
+#define IPHC_PAYLOAD_LEN    (32U)
+#define FRAG_PAYLOAD_LEN    (400U)
+#define MAX_PDU_SIZE        (102U)
+#define FRAMES_MAX          (10U)
+#define MSG_QUEUE_SIZE      (8U)
+
+typedef struct {
+    size_t len;
+    uint8_t data[IEEE802154_FRAME_LEN_MAX];
+} _frame_t;
+
+typedef struct {
+    size_t payload_len;
+    unsigned frames;
+} _tx_case_t;
+
+typedef struct {
+    _frame_t *frames;
+    unsigned num;
+} _rx_case_t;
+
+static const uint8_t _own_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26, 0x01, 0x02 };
+static const uint8_t _nbr_addr[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, 0xaa, 0xbb };
+/* derived from _nbr_addr, so IPHC can elide it */
+static const ipv6_addr_t _nbr_link_local = { .u8 = {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x55, 0x44, 0x33, 0x22, 0x11, 0x00, 0xaa, 0xbb,
+    } };
+
+static netdev_test_t _netdev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+
+static uint8_t _payload[FRAG_PAYLOAD_LEN];
+static _frame_t _iphc_frame;
+static _frame_t _frag_frames[FRAMES_MAX];
+static unsigned _frag_num;
+
+static _frame_t *_capture;
+static unsigned _capture_max;
+static unsigned _captured;
+static unsigned _tx_pending;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static const _frame_t *_rx_frame;
+static mutex_t _recvd = MUTEX_INIT_LOCKED;
+static uint16_t _tag;
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+
+    if (_captured < _capture_max) {
+        _frame_t *frame = &_capture[_captured++];
+        ssize_t res = iolist_to_buffer(iolist, frame->data, sizeof(frame->data));
+        expect(res > 0);
+        frame->len = res;
+    }
+    if ((_tx_pending > 0) && (--_tx_pending == 0)) {
+        mutex_unlock(&_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+
+    if (buf == NULL) {
+        return _rx_frame->len;
+    }
+    if (len < (int)_rx_frame->len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _rx_frame->data, _rx_frame->len);
+    mutex_unlock(&_recvd);
+    return _rx_frame->len;
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = MAX_PDU_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_own_addr));
+    memcpy(value, _own_addr, sizeof(_own_addr));
+    return sizeof(_own_addr);
+}
+
+static void _send(size_t payload_len)
+{
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, payload_len, GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, &_nbr_link_local);
+    expect(pkt != NULL);
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
+/* turns a captured frame into one sent by the neighbor to us */
+static void _make_rx(_frame_t *frame)
+{
+    uint8_t mhr[IEEE802154_MAX_HDR_LEN];
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t pan;
+    size_t mhr_len = ieee802154_get_frame_hdr_len(frame->data);
+
+    expect(ieee802154_get_dst(frame->data, dst, &pan) == sizeof(dst));
+    expect(ieee802154_set_frame_hdr(mhr, _nbr_addr, sizeof(_nbr_addr),
+                                    _own_addr, sizeof(_own_addr), pan, pan,
+                                    frame->data[0] & ~IEEE802154_FCF_ACK_REQ,
+                                    frame->data[2]) == mhr_len);
+    memcpy(frame->data, mhr, mhr_len);
+}
+
+static unsigned _capture_tx(size_t payload_len, _frame_t *frames, unsigned max)
+{
+    _capture = frames;
+    _capture_max = max;
+    _captured = 0;
+    _send(payload_len);
+    /* all GNRC threads have a higher priority, this is only a safety net */
+    ztimer_sleep(ZTIMER_USEC, 10 * US_PER_MS);
+    _capture_max = 0;
+
+    for (unsigned i = 0; i < _captured; i++) {
+        _make_rx(&frames[i]);
+    }
+    return _captured;
+}
+
+static void _tx(void *arg)
+{
+    const _tx_case_t *tx = arg;
+
+    _tx_pending = tx->frames;
+    _send(tx->payload_len);
+    mutex_lock(&_sent);
+}
+
+static void _rx(void *arg)
+{
+    const _rx_case_t *rx = arg;
+    msg_t msg;
+
+    _tag++;
+    for (unsigned i = 0; i < rx->num; i++) {
+        _frame_t *frame = &rx->frames[i];
+        sixlowpan_frag_t *frag = (sixlowpan_frag_t *)
+                                 &frame->data[ieee802154_get_frame_hdr_len(frame->data)];
+
+        /* use a fresh tag, so the fragments are not mistaken for duplicates */
+        if (sixlowpan_frag_is(frag)) {
+            frag->tag = byteorder_htons(_tag);
+        }
+        _rx_frame = frame;
+        netdev_trigger_event_isr(&_netdev.netdev.netdev);
+        mutex_lock(&_recvd);
+    }
+
+    do {
+        msg_receive(&msg);
+    } while (msg.type != GNRC_NETAPI_MSG_TYPE_RCV);
+    gnrc_pktbuf_release(msg.content.ptr);
+}
+
+static void _run(const char *name, void (*func)(void *), void *arg)
+{
+    const benchmark_case_t bench = {
+        .name = name,
+        .func = func,
+        .arg = arg,
+    };
+    benchmark_stats_t stats;
+
+    expect(benchmark_run(&bench, &stats) == 0);
+    benchmark_print_json(name, &stats);
+    benchmark_print_rate_json(name, &stats);
+}
+
+static void _init(void)
+{
+    static gnrc_netreg_entry_t udp_reg;
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    for (unsigned i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i;
+    }
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_send_cb(&_netdev, _netdev_send);
+    netdev_test_set_recv_cb(&_netdev, _netdev_recv);
+    netdev_test_set_isr_cb(&_netdev, _netdev_isr);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS_LONG, _get_address_long);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "bench_wpan",
+                                        &_netdev.netdev.netdev) == 0);
+    gnrc_ipv6_nib_init();
+    gnrc_ipv6_nib_init_iface(&_netif);
+    gnrc_ipv6_nib_iface_up(&_netif);
+
+    /* skip DAD for the link-local address */
+    expect(!ipv6_addr_is_unspecified(&_netif.ipv6.addrs[0]));
+    _netif.ipv6.addrs_flags[0] &= ~GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_MASK;
+    _netif.ipv6.addrs_flags[0] |= GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+
+    gnrc_netreg_entry_init_pid(&udp_reg, PORT, thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp_reg);
+
+    expect(_capture_tx(IPHC_PAYLOAD_LEN, &_iphc_frame, 1) == 1);
+    _frag_num = _capture_tx(FRAG_PAYLOAD_LEN, _frag_frames, FRAMES_MAX);
+    expect((_frag_num > 1) && (_frag_num < FRAMES_MAX));
+}
+
+int main(void)
+{
+    _init();
+
+    _tx_case_t iphc_tx = { .payload_len = IPHC_PAYLOAD_LEN, .frames = 1 };
+    _rx_case_t iphc_rx = { .frames = &_iphc_frame, .num = 1 };
+    _tx_case_t frag_tx = { .payload_len = FRAG_PAYLOAD_LEN, .frames = _frag_num };
+    _rx_case_t frag_rx = { .frames = _frag_frames, .num = _frag_num };
+
+    _run("gnrc_sixlowpan_iphc_compress", _tx, &iphc_tx);
+    _run("gnrc_sixlowpan_iphc_decompress", _rx, &iphc_rx);
+    _run("gnrc_sixlowpan_frag", _tx, &frag_tx);
+    _run("gnrc_sixlowpan_reass", _rx, &frag_rx);
+
+    return 0;
+}
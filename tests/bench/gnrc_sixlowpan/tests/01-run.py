@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def expect_case(child, name):
+    child.expect(r'{"bench":"' + name + r'","iterations":\d+,"runs":\d+,'
+                 r'"unit":"ns","min":\d+,"median":\d+,"p99":\d+,"max":\d+,'
+                 r'"mean":\d+,"stddev":\d+}\r\n')
+    child.expect(r'{"bench":"' + name + r'","per_sec":\d+(,"cycles":\d+)?}\r\n')
+
+
+def testfunc(child):
+    expect_case(child, "gnrc_sixlowpan_iphc_compress")
+    expect_case(child, "gnrc_sixlowpan_iphc_decompress")
+    expect_case(child, "gnrc_sixlowpan_frag")
+    expect_case(child, "gnrc_sixlowpan_reass")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of a GNRC TCP bulk transfer
+ *
+ * A client and a server thread are connected via the IPv6 loopback address,
+ * so the whole TCP and IPv6 data path is exercised without any device. Every
+ * benchmark iteration sends one full-sized segment and completes once the
+ * server has received it, so per-call numbers are per-segment numbers.
+ *
+ * @}
+ */
+
+#include "benchmark.h"
+#include "mutex.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define PORT                (5001U)
+#define SEGMENT_LEN         (CONFIG_GNRC_TCP_MSS)
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_tcp_tcb_t _client;
+static mutex_t _received = MUTEX_INIT_LOCKED;
+static uint8_t _tx_buf[SEGMENT_LEN];
+
+static void *_server_thread(void *arg)
+{
+    static uint8_t rx_buf[SEGMENT_LEN];
+    static gnrc_tcp_tcb_t tcb;
+    static gnrc_tcp_tcb_queue_t queue = GNRC_TCP_TCB_QUEUE_INIT;
+    gnrc_tcp_tcb_t *conn;
+    gnrc_tcp_ep_t local;
+    size_t pending = SEGMENT_LEN;
+
+    (void)arg;
+    gnrc_tcp_tcb_init(&tcb);
+    expect(gnrc_tcp_ep_from_str(&local, "[::]:5001") == 0);
+    expect(gnrc_tcp_listen(&queue, &tcb, 1, &local) == 0);
+    expect(gnrc_tcp_accept(&queue, &conn, GNRC_TCP_NO_TIMEOUT) == 0);
+
+    ssize_t res;
+    while ((res = gnrc_tcp_recv(conn, rx_buf, pending, GNRC_TCP_NO_TIMEOUT)) > 0) {
+        pending -= res;
+        if (pending == 0) {
+            pending = SEGMENT_LEN;
+            mutex_unlock(&_received);
+        }
+    }
+    /* connection closed by the client */
+    gnrc_tcp_close(conn);
+    gnrc_tcp_stop_listen(&queue);
+
+    return NULL;
+}
+
+static void _send_segment(void *arg)
+{
+    (void)arg;
+
+    for (size_t sent = 0; sent < SEGMENT_LEN;) {
+        ssize_t res = gnrc_tcp_send(&_client, _tx_buf + sent,
+                                    SEGMENT_LEN - sent, GNRC_TCP_NO_TIMEOUT);
+        expect(res > 0);
+        sent += res;
+    }
+    mutex_lock(&_received);
+}
+
+int main(void)
+{
+    const benchmark_case_t bench = {
+        .name = "gnrc_tcp_bulk",
+        .func = _send_segment,
+    };
+    benchmark_stats_t stats;
+    gnrc_tcp_ep_t remote;
+
+    for (unsigned i = 0; i < sizeof(_tx_buf); i++) {
+        _tx_buf[i] = i;
+    }
+
+    /* the server has a higher priority, so it is listening once this returns */
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN - 1, 0, _server_thread, NULL,
+                  "tcp_server");
+
+    gnrc_tcp_tcb_init(&_client);
+    expect(gnrc_tcp_ep_from_str(&remote, "[::1]:5001") == 0);
+    expect(gnrc_tcp_open(&_client, &remote, 0) == 0);
+
+    expect(benchmark_run(&bench, &stats) == 0);
+    benchmark_print_json(bench.name, &stats);
+    benchmark_print_rate_json(bench.name, &stats);
+
+    gnrc_tcp_close(&_client);
+
+    return 0;
+}
@@ -15,27 +15,14 @@
  * @}
  */
 
-#include <stdint.h>
-#include <stdatomic.h>
 #include <stdio.h>
-#include "macros/units.h"
-#include "thread.h"
-#include "clk.h"
 
+#include "benchmark.h"
 #include "msg.h"
-#include "xtimer.h"
-
-#ifndef TEST_DURATION_US
-#define TEST_DURATION_US    (1000000U)
-#endif
+#include "thread.h"
 
 static char _stack[THREAD_STACKSIZE_MAIN];
-
-static void _timer_callback(void *_flag)
-{
-    atomic_flag *flag = _flag;
-    atomic_flag_clear(flag);
-}
+static kernel_pid_t _other;
 
 static void *_second_thread(void *arg)
 {
@@ -49,39 +36,27 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
-int main(void)
+static void _msg_send(void *arg)
 {
-    puts("main starting");
-
-    kernel_pid_t other = thread_create(_stack,
-                                       sizeof(_stack),
-                                       (THREAD_PRIORITY_MAIN - 1),
-                                       0,
-                                       _second_thread,
-                                       NULL,
-                                       "second_thread");
-
-    atomic_flag flag = ATOMIC_FLAG_INIT;
-    uint32_t n = 0;
+    (void)arg;
 
-    xtimer_t timer = {
-        .callback = _timer_callback,
-        .arg = &flag,
-    };
+    msg_t test;
+    msg_send(&test, _other);
+}
 
-    atomic_flag_test_and_set(&flag);
-    xtimer_set(&timer, TEST_DURATION_US);
+BENCHMARK_CASE(msg_pingpong, .func = _msg_send);
 
-    while (atomic_flag_test_and_set(&flag)) {
-        msg_t test;
-        msg_send(&test, other);
-        n++;
-    }
+int main(void)
+{
+    puts("main starting");
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _other = thread_create(_stack,
+                           sizeof(_stack),
+                           (THREAD_PRIORITY_MAIN - 1),
+                           0,
+                           _second_thread,
+                           NULL,
+                           "second_thread");
 
-    return 0;
+    return benchmark_run_all();
 }
@@ -12,7 +12,9 @@ from testrunner import run
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r'{"bench":"msg_pingpong","iterations":\d+,"runs":\d+,"unit":"ns",'
+                 r'"min":\d+,"median":\d+,"p99":\d+,"max":\d+,"mean":\d+,'
+                 r'"stddev":\d+}')
 
 
 if __name__ == "__main__":
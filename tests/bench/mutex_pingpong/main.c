@@ -17,41 +17,45 @@
 
 #include <stdio.h>
 
-#include "macros/units.h"
-#include "clk.h"
+#include "benchmark.h"
 #include "mutex.h"
 #include "thread.h"
-#include "xtimer.h"
 
-#ifndef TEST_DURATION
-#define TEST_DURATION       (1000000U)
-#endif
-
-volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
 
-static void _timer_callback(void*arg)
+static void *_second_thread(void *arg)
 {
     (void)arg;
 
-    _flag = 1;
+    while (1) {
+        mutex_lock(&_mutex);
+    }
+
+    return NULL;
 }
 
-static void *_second_thread(void *arg)
+static void _setup(void *arg)
 {
     (void)arg;
 
-    while(1) {
-        mutex_lock(&_mutex);
-    }
+    /* lock the mutex, then yield to second_thread */
+    mutex_lock(&_mutex);
+    thread_yield_higher();
+}
 
-    return NULL;
+static void _mutex_unlock(void *arg)
+{
+    (void)arg;
+
+    mutex_unlock(&_mutex);
 }
 
+BENCHMARK_CASE(mutex_pingpong, .setup = _setup, .func = _mutex_unlock);
+
 int main(void)
 {
-    printf("main starting\n");
+    puts("main starting");
 
     thread_create(_stack,
                   sizeof(_stack),
@@ -61,25 +65,5 @@ int main(void)
                   NULL,
                   "second_thread");
 
-    /* lock the mutex, then yield to second_thread */
-    mutex_lock(&_mutex);
-    thread_yield_higher();
-
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
-
-    xtimer_set(&timer, TEST_DURATION);
-    while(!_flag) {
-        mutex_unlock(&_mutex);
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
-
-    return 0;
+    return benchmark_run_all();
 }
@@ -19,10 +19,10 @@
 #include <string.h>
 
 #include "base64.h"
+#include "benchmark.h"
 #include "compiler_hints.h"
 #include "fmt.h"
 #include "macros/utils.h"
-#include "xtimer.h"
 
 static char buf[128];
 
@@ -37,8 +37,27 @@ static const char base64[128] =
 "VGhpcyBpcyBhbiBleHRyZW1lbHksIGVub3Jtb3VzbHksIGdyZWF0bHksIGltbWVuc2VseSwgdHJl"
 "bWVuZG91c2x5LCByZW1hcmthYmx5IGxlbmd0aHkgc2VudGVuY2Uh";
 
+static void _encode(void *arg)
+{
+    (void)arg;
+
+    size_t size = sizeof(buf);
+    base64_encode(input, sizeof(input), buf, &size);
+}
+
+static void _decode(void *arg)
+{
+    (void)arg;
+
+    size_t size = sizeof(buf);
+    base64_decode(base64, sizeof(base64), buf, &size);
+}
+
+/* 96 bytes of input, 128 bytes in base64 */
+BENCHMARK_CASE(base64_encode, .func = _encode);
+BENCHMARK_CASE(base64_decode, .func = _decode);
+
 int main(void) {
-    uint32_t start, stop;
     size_t size;
 
     /* We don't want check return value in the benchmark loop, so we just do
@@ -75,26 +94,5 @@ int main(void) {
         print_str("OK\n");
     }
 
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_encode(input, sizeof(input), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Encoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
-
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_decode(base64, sizeof(base64), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
-    return 0;
+    return benchmark_run_all();
 }
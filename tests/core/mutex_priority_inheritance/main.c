@@ -0,0 +1,233 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for transitive and nested priority
+ *              inheritance of mutexes and its interaction with
+ *              sched_change_priority()
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "sched.h"
+#include "thread.h"
+
+#define PRIO_H      (THREAD_PRIORITY_MAIN - 5)
+#define PRIO_X_HIGH (THREAD_PRIORITY_MAIN - 4)
+#define PRIO_M      (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_X_LOW  (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_L      (THREAD_PRIORITY_MAIN - 1)
+
+static mutex_t mtx_a = MUTEX_INIT;
+static mutex_t mtx_b = MUTEX_INIT;
+
+static char stack_l[THREAD_STACKSIZE_DEFAULT];
+static char stack_m[THREAD_STACKSIZE_DEFAULT];
+static char stack_h[THREAD_STACKSIZE_DEFAULT];
+static char stack_x[THREAD_STACKSIZE_DEFAULT];
+
+static char run_order[16];
+static size_t run_order_pos;
+static bool failed;
+
+static void record(char c)
+{
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = c;
+    irq_restore(irq_state);
+}
+
+static void check_prio(const char *who, uint8_t expected)
+{
+    uint8_t prio = thread_get_active()->priority;
+    if (prio != expected) {
+        printf("%s: priority is %u, expected %u\n", who, (unsigned)prio,
+               (unsigned)expected);
+        failed = true;
+    }
+}
+
+static void start(char *stack, uint8_t prio, thread_task_func_t func,
+                  const char *name)
+{
+    thread_create(stack, THREAD_STACKSIZE_DEFAULT, prio, 0, func, NULL, name);
+}
+
+static void *x_handler(void *arg)
+{
+    (void)arg;
+    record('X');
+    return NULL;
+}
+
+/*
+ * Transitive: L holds A, M holds B and waits for A, H waits for B. L must run
+ * with the priority of H, so X (between H and M) must not preempt L.
+ */
+
+static void *transitive_h(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_b);
+    record('H');
+    mutex_unlock(&mtx_b);
+    return NULL;
+}
+
+static void *transitive_m(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_b);
+    mutex_lock(&mtx_a);
+    record('M');
+    check_prio("transitive M holding A and B", PRIO_H);
+    mutex_unlock(&mtx_a);
+    mutex_unlock(&mtx_b);
+    check_prio("transitive M after unlocking", PRIO_M);
+    return NULL;
+}
+
+static void *transitive_l(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_a);
+    start(stack_m, PRIO_M, transitive_m, "M");
+    check_prio("transitive L with M waiting", PRIO_M);
+    start(stack_h, PRIO_H, transitive_h, "H");
+    check_prio("transitive L with H waiting on M", PRIO_H);
+    start(stack_x, PRIO_X_HIGH, x_handler, "X");
+    record('L');
+    mutex_unlock(&mtx_a);
+    check_prio("transitive L after unlocking", PRIO_L);
+    record('l');
+    return NULL;
+}
+
+/*
+ * Nested: L holds A and B, M waits for A, H waits for B. After releasing B,
+ * L must keep the priority of M, so X (between M and L) must not preempt L.
+ */
+
+static void *nested_h(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_b);
+    record('H');
+    mutex_unlock(&mtx_b);
+    return NULL;
+}
+
+static void *nested_m(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_a);
+    record('M');
+    mutex_unlock(&mtx_a);
+    return NULL;
+}
+
+static void *nested_l(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_a);
+    mutex_lock(&mtx_b);
+    start(stack_m, PRIO_M, nested_m, "M");
+    start(stack_h, PRIO_H, nested_h, "H");
+    check_prio("nested L with M and H waiting", PRIO_H);
+    start(stack_x, PRIO_X_LOW, x_handler, "X");
+    record('L');
+    mutex_unlock(&mtx_b);
+    check_prio("nested L after unlocking B", PRIO_M);
+    record('l');
+    mutex_unlock(&mtx_a);
+    check_prio("nested L after unlocking A", PRIO_L);
+    return NULL;
+}
+
+/*
+ * Base priority: L locks a mutex on its stack that is never unlocked (like
+ * ztimer_sleep() does) and changes its own priority. Neither an uncontended
+ * lock/unlock nor a boost by H may make L lose the priority it set itself.
+ */
+
+static void *base_h(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_a);
+    record('H');
+    mutex_unlock(&mtx_a);
+    return NULL;
+}
+
+static void lock_on_stack(void)
+{
+    mutex_t mutex = MUTEX_INIT;
+    mutex_lock(&mutex);
+}
+
+static void clobber_stack(void)
+{
+    volatile uint8_t garbage[64];
+    for (unsigned i = 0; i < sizeof(garbage); i++) {
+        garbage[i] = 0xa5;
+    }
+}
+
+static void *base_l(void *arg)
+{
+    (void)arg;
+    lock_on_stack();
+    clobber_stack();
+    sched_change_priority(thread_get_active(), PRIO_X_LOW);
+    mutex_lock(&mtx_a);
+    mutex_unlock(&mtx_a);
+    check_prio("base L after uncontended unlock", PRIO_X_LOW);
+    mutex_lock(&mtx_a);
+    start(stack_h, PRIO_H, base_h, "H");
+    check_prio("base L with H waiting", PRIO_H);
+    sched_change_priority(thread_get_active(), PRIO_L);
+    check_prio("base L with H waiting after nice", PRIO_H);
+    record('L');
+    mutex_unlock(&mtx_a);
+    check_prio("base L after unlocking", PRIO_L);
+    record('l');
+    return NULL;
+}
+
+static void run(const char *name, thread_task_func_t func, const char *expected)
+{
+    memset(run_order, 0, sizeof(run_order));
+    run_order_pos = 0;
+
+    /* all threads have a higher priority than main, so they are done when
+     * thread_create() returns */
+    start(stack_l, PRIO_L, func, "L");
+
+    printf("%s: run order %s\n", name, run_order);
+    if (strcmp(run_order, expected)) {
+        printf("%s: expected %s\n", name, expected);
+        failed = true;
+    }
+}
+
+int main(void)
+{
+    run("transitive", transitive_l, "LMHXl");
+    run("nested", nested_l, "LHlMX");
+    run("base", base_l, "LHl");
+
+    puts(failed ? "TEST FAILED" : "TEST PASSED");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("transitive: run order LMHXl")
+    child.expect_exact("nested: run order LHlMX")
+    child.expect_exact("base: run order LHl")
+    child.expect(r"TEST ([A-Z]+)\r\n")
+    assert child.match.group(1) == "PASSED"
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
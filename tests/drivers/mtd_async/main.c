@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for asynchronous MTD access
+ *
+ * Erase, program and read requests are submitted to all devices at once.
+ * The emulated MTD is served by the blocking adapter, the native MTD (if
+ * present) by its own asynchronous implementation.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "event.h"
+#include "mtd_async.h"
+#include "mtd_emulated.h"
+#include "test_utils/expect.h"
+
+#define SECTOR      (1U)
+#define OFFSET      (16U)
+#define BUF_SIZE    (1024U)
+
+typedef struct {
+    mtd_dev_t *mtd;
+    const char *name;
+    mtd_async_req_t erase;
+    mtd_async_req_t write;
+    mtd_async_req_t read;
+    uint8_t rx[BUF_SIZE];
+    uint32_t len;
+    char order[4];
+    unsigned done;
+} test_dev_t;
+
+MTD_EMULATED_DEV(0, 16, 4, 64);
+
+static test_dev_t _devs[] = {
+    { .mtd = &mtd_emulated_dev0.base, .name = "emulated" },
+#ifdef MODULE_MTD_NATIVE
+    { .name = "native" },
+#endif
+};
+
+static event_queue_t _queue;
+static uint8_t _tx[BUF_SIZE];
+static unsigned _pending;
+
+static void _record(test_dev_t *dev, char c, int res)
+{
+    dev->order[dev->done++] = c;
+    _pending--;
+    if (res != 0) {
+        printf("%s: request '%c' failed: %d\n", dev->name, c, res);
+    }
+}
+
+#define HANDLER(op, c)                                                      \
+    static void _ ## op ## _done(event_t *event)                            \
+    {                                                                       \
+        mtd_async_req_t *req = container_of(event, mtd_async_req_t, event); \
+        for (unsigned i = 0; i < ARRAY_SIZE(_devs); i++) {                  \
+            if (&_devs[i].op == req) {                                      \
+                _record(&_devs[i], c, mtd_async_result(req));               \
+            }                                                               \
+        }                                                                   \
+    }
+
+HANDLER(erase, 'e')
+HANDLER(write, 'w')
+HANDLER(read, 'r')
+
+int main(void)
+{
+    bool failed = false;
+
+    for (unsigned i = 0; i < sizeof(_tx); i++) {
+        _tx[i] = i;
+    }
+
+    event_queue_init(&_queue);
+#ifdef MODULE_MTD_NATIVE
+    _devs[1].mtd = MTD_0;
+#endif
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_devs); i++) {
+        test_dev_t *dev = &_devs[i];
+        uint32_t page = SECTOR * dev->mtd->pages_per_sector;
+
+        expect(mtd_init(dev->mtd) == 0);
+
+        /* cross a page boundary */
+        dev->len = dev->mtd->page_size + dev->mtd->page_size / 2;
+        expect(OFFSET + dev->len <= BUF_SIZE);
+
+        mtd_async_req_init(&dev->erase, &_queue, _erase_done);
+        mtd_async_req_init(&dev->write, &_queue, _write_done);
+        mtd_async_req_init(&dev->read, &_queue, _read_done);
+
+        expect(mtd_async_erase_sector(&dev->erase, dev->mtd, SECTOR, 1) == 0);
+        expect(mtd_async_write_page_raw(&dev->write, dev->mtd, _tx, page,
+                                         OFFSET, dev->len) == 0);
+        expect(mtd_async_read_page(&dev->read, dev->mtd, dev->rx, page,
+                                   OFFSET, dev->len) == 0);
+        _pending += 3;
+    }
+
+    /* requests outside of the device are rejected right away */
+    mtd_async_req_t invalid;
+    mtd_async_req_init(&invalid, &_queue, NULL);
+    expect(mtd_async_erase_sector(&invalid, _devs[0].mtd,
+                                  _devs[0].mtd->sector_count, 1) == -EOVERFLOW);
+
+    while (_pending) {
+        event_t *event = event_wait(&_queue);
+        event->handler(event);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_devs); i++) {
+        test_dev_t *dev = &_devs[i];
+        bool match = memcmp(dev->rx, _tx, dev->len) == 0;
+
+        printf("%s: order %s, data %s\n", dev->name, dev->order,
+               match ? "ok" : "mismatch");
+        if (!match || strcmp(dev->order, "ewr")) {
+            failed = true;
+        }
+    }
+
+    puts(failed ? "TEST FAILED" : "TEST PASSED");
+    return 0;
+}
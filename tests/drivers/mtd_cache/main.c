@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the MTD write-back sector cache
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+
+#define SECTOR_COUNT        8
+#define PAGES_PER_SECTOR    4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGES_PER_SECTOR * PAGE_SIZE)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGES_PER_SECTOR, PAGE_SIZE);
+
+MTD_CACHE_DEV(cache, 2, SECTOR_SIZE);
+
+/* the emulated driver with erases counted */
+static mtd_desc_t counting_driver;
+static unsigned erases;
+
+static bool failed;
+
+static int _count_erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    erases += count;
+    return _mtd_emulated_driver.erase_sector(dev, sector, count);
+}
+
+static const uint8_t *backing(uint32_t sector)
+{
+    return mtd_emulated_dev0.memory + sector * SECTOR_SIZE;
+}
+
+static void check(const char *what, bool ok)
+{
+    if (!ok) {
+        printf("%s: failed\n", what);
+        failed = true;
+    }
+}
+
+static bool sector_is(uint32_t sector, uint8_t val)
+{
+    uint8_t buf[SECTOR_SIZE];
+
+    if (mtd_read_page(&cache.mtd, buf, sector * PAGES_PER_SECTOR, 0,
+                      sizeof(buf))) {
+        return false;
+    }
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        if (buf[i] != val) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void fill(uint32_t sector, uint8_t val)
+{
+    uint8_t buf[SECTOR_SIZE / 8];
+
+    memset(buf, val, sizeof(buf));
+    /* many small writes, each of them would cost an erase without the cache */
+    for (unsigned i = 0; i < SECTOR_SIZE / sizeof(buf); i++) {
+        mtd_write_page_raw(&cache.mtd, buf, sector * PAGES_PER_SECTOR,
+                           i * sizeof(buf), sizeof(buf));
+    }
+}
+
+static void test_coalesce(void)
+{
+    fill(0, 0x11);
+
+    check("coalesce: no write back before flush", erases == 0);
+    check("coalesce: backing device untouched", backing(0)[0] == 0xff);
+    check("coalesce: read from cache", sector_is(0, 0x11));
+
+    check("coalesce: flush", mtd_flush(&cache.mtd) == 0);
+    check("coalesce: single erase", erases == 1);
+    check("coalesce: backing device written",
+          !memcmp(backing(0), backing(0) + 1, SECTOR_SIZE - 1) &&
+          backing(0)[0] == 0x11);
+
+    mtd_cache_stats_t stats;
+    mtd_cache_get_stats(&cache, &stats);
+    check("coalesce: erases saved",
+          stats.erases_saved == SECTOR_SIZE / (SECTOR_SIZE / 8) - 1);
+
+    /* nothing left to write back */
+    mtd_flush(&cache.mtd);
+    check("coalesce: second flush", erases == 1);
+
+    puts("coalesce: ok");
+}
+
+static void test_evict(void)
+{
+    erases = 0;
+    fill(1, 0x22);
+    fill(2, 0x33);
+    /* make sector 1 the most recently used one */
+    check("evict: read 1", sector_is(1, 0x22));
+    fill(3, 0x44);
+
+    check("evict: least recently used written back", backing(2)[0] == 0x33);
+    check("evict: most recently used kept", backing(1)[0] == 0xff);
+    check("evict: one erase", erases == 1);
+    check("evict: read evicted sector", sector_is(2, 0x33));
+
+    mtd_flush(&cache.mtd);
+    check("evict: flushed", (backing(1)[0] == 0x22) && (backing(3)[0] == 0x44));
+
+    puts("evict: ok");
+}
+
+static void test_erase(void)
+{
+    erases = 0;
+    /* erase before program, as littlefs does it */
+    mtd_erase_sector(&cache.mtd, 1, 1);
+    check("erase: reads as erased", sector_is(1, 0xff));
+    fill(1, 0x55);
+    mtd_flush(&cache.mtd);
+
+    check("erase: one erase", erases == 1);
+    check("erase: written", backing(1)[SECTOR_SIZE - 1] == 0x55);
+
+    puts("erase: ok");
+}
+
+static void test_power_down(void)
+{
+    erases = 0;
+    fill(4, 0x66);
+    check("power down: power", mtd_power(&cache.mtd, MTD_POWER_DOWN) == 0);
+    check("power down: written", backing(4)[0] == 0x66);
+    check("power down: one erase", erases == 1);
+
+    puts("power down: ok");
+}
+
+int main(void)
+{
+    counting_driver = _mtd_emulated_driver;
+    counting_driver.erase_sector = _count_erase_sector;
+    mtd_emulated_dev0.base.driver = &counting_driver;
+
+    cache.parent = &mtd_emulated_dev0.base;
+    if (mtd_init(&cache.mtd)) {
+        puts("init failed");
+        return 1;
+    }
+
+    test_coalesce();
+    test_evict();
+    test_erase();
+    test_power_down();
+
+    mtd_cache_print_stats(&cache);
+
+    puts(failed ? "TEST FAILED" : "TEST PASSED");
+    return 0;
+}
@@ -78,10 +78,34 @@ static const gnrc_netif_ops_t default_ops = {
     .msg_handler = NULL,
 };
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+static void _index_clear(gnrc_netif_t *netif)
+{
+    /* the addresses are wiped in _set_up() behind the back of the index */
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
+        if (!ipv6_addr_is_unspecified(&netif->ipv6.addrs[i])) {
+            gnrc_netif_ipv6_index_remove(netif, &netif->ipv6.addrs[i]);
+        }
+    }
+    for (unsigned i = 0; i < GNRC_NETIF_IPV6_GROUPS_NUMOF; i++) {
+        if (!ipv6_addr_is_unspecified(&netif->ipv6.groups[i])) {
+            gnrc_netif_ipv6_index_remove(netif, &netif->ipv6.groups[i]);
+        }
+    }
+}
+#endif
+
 static void _set_up(void)
 {
     msg_t msg;
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+    _index_clear(&ethernet_netif);
+    _index_clear(&ieee802154_netif);
+    for (unsigned i = 0; i < DEFAULT_DEVS_NUMOF; i++) {
+        _index_clear(&netifs[i]);
+    }
+#endif
     /* reset ethernet groups */
     memset(ethernet_groups_set, 0, sizeof(ethernet_groups_set));
     memset(ethernet_netif.ipv6.addrs_flags, 0,
@@ -560,6 +584,54 @@ static void test_get_by_ipv6_addr__success(void)
     TEST_ASSERT(&netifs[0] == gnrc_netif_get_by_ipv6_addr(&addr));
 }
 
+static void test_get_by_ipv6_addr__removed(void)
+{
+    static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_LL };
+
+    test_ipv6_addr_add__success();
+    gnrc_netif_ipv6_addr_remove_internal(&netifs[0], &addr);
+    TEST_ASSERT_NULL(gnrc_netif_get_by_ipv6_addr(&addr));
+}
+
+static void test_get_by_ipv6_addr__group(void)
+{
+    TEST_ASSERT(0 <= gnrc_netif_ipv6_group_join_internal(&netifs[0],
+                &ipv6_addr_all_nodes_link_local));
+    TEST_ASSERT(&netifs[0] ==
+                gnrc_netif_get_by_ipv6_addr(&ipv6_addr_all_nodes_link_local));
+    gnrc_netif_ipv6_group_leave_internal(&netifs[0],
+                                         &ipv6_addr_all_nodes_link_local);
+    TEST_ASSERT_NULL(gnrc_netif_get_by_ipv6_addr(&ipv6_addr_all_nodes_link_local));
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+static void test_get_by_ipv6_addr__index_overflow(void)
+{
+    /* one more than the index holds, as one entry always stays free */
+    static ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_INDEX_SIZE];
+    gnrc_netif_t *netif;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(addrs); i++) {
+        ipv6_addr_from_str(&addrs[i], "2001:db8::");
+        addrs[i].u8[15] = i;
+        gnrc_netif_ipv6_index_add(&netifs[0], &addrs[i]);
+    }
+    TEST_ASSERT(!gnrc_netif_ipv6_index_lookup(&addrs[0], &netif));
+
+    /* the index is complete again, once the address that did not fit is
+     * removed */
+    gnrc_netif_ipv6_index_remove(&netifs[0], &addrs[ARRAY_SIZE(addrs) - 1]);
+    TEST_ASSERT(gnrc_netif_ipv6_index_lookup(&addrs[0], &netif));
+    TEST_ASSERT(&netifs[0] == netif);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(addrs) - 1; i++) {
+        gnrc_netif_ipv6_index_remove(&netifs[0], &addrs[i]);
+    }
+    TEST_ASSERT(gnrc_netif_ipv6_index_lookup(&addrs[0], &netif));
+    TEST_ASSERT_NULL(netif);
+}
+#endif
+
 static void test_get_by_prefix__empty(void)
 {
     static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_G };
@@ -1729,6 +1801,11 @@ static Test *embunit_tests_gnrc_netif(void)
             new_TestFixture(test_get_by_ipv6_addr__empty),
             new_TestFixture(test_get_by_ipv6_addr__unspecified_addr),
             new_TestFixture(test_get_by_ipv6_addr__success),
+            new_TestFixture(test_get_by_ipv6_addr__removed),
+            new_TestFixture(test_get_by_ipv6_addr__group),
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_INDEX)
+            new_TestFixture(test_get_by_ipv6_addr__index_overflow),
+#endif
             new_TestFixture(test_get_by_prefix__empty),
             new_TestFixture(test_get_by_prefix__unspecified_addr),
             new_TestFixture(test_get_by_prefix__success18),
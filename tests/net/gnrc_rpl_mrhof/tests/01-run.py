@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Benjamin Valentin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import subprocess
+import time
+import sys
+
+from subprocess import Popen
+from riotctrl_shell.gnrc import GNRCICMPv6Echo
+from riotctrl_shell.netif import Ifconfig
+from riotctrl.ctrl import RIOTCtrlBoardFactory
+from riotctrl_ctrl import native
+from riotctrl_shell.netif import IfconfigListParser
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(os.path.join(os.path.dirname(__file__), "../../../")))
+ZEP_DISPATCH_PATH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+PARSERS = {
+    "ifconfig": IfconfigListParser(),
+}
+# MRHOF (RFC 6719)
+OCP_MRHOF = 1
+
+
+class RIOTCtrlAppFactory(RIOTCtrlBoardFactory):
+
+    def __init__(self, board='native'):
+        super().__init__(board_cls={
+            board: native.NativeRIOTCtrl,
+        })
+        self.board = board
+        self.ctrl_list = list()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        for ctrl in self.ctrl_list:
+            ctrl.stop_term()
+
+    def get_shell(self, application_directory='.', env=None):
+        if env is None:
+            env = {'BOARD': self.board}
+        # retrieve a RIOTCtrl Object
+        ctrl = super().get_ctrl(
+            env=env,
+            application_directory=application_directory
+        )
+        # append ctrl to list
+        self.ctrl_list.append(ctrl)
+        # start terminal
+        ctrl.start_term()
+        # return ctrl with started terminal
+        return Shell(ctrl)
+
+    def get_shells(self, num=1):
+        terms = []
+        for i in range(num):
+            terms.append(self.get_shell())
+        return terms
+
+
+class Shell(Ifconfig, GNRCICMPv6Echo):
+    pass
+
+
+def first_netif_and_addr_by_scope(ifconfig_out, scope):
+    netifs = PARSERS["ifconfig"].parse(ifconfig_out)
+    key = next(iter(netifs))
+    netif = netifs[key]
+    return (
+        key,
+        [addr["addr"] for addr in netif["ipv6_addrs"] if addr["scope"] == scope][0],
+    )
+
+
+def link_local_addr(ifconfig_out):
+    return first_netif_and_addr_by_scope(ifconfig_out, "link")
+
+
+def rpl_instance(rpl_out):
+    ocp = int(re.search(r"instance \[\d+ \| Iface: \d+ \| mop: \d+ \| ocp: (\d+)",
+                        rpl_out).group(1))
+    parents = re.findall(r"parent \[addr: (\S+) \| rank: \d+\]", rpl_out)
+    return ocp, parents
+
+
+def test_parent_follows_link_quality(factory, zep_dispatch):
+
+    # topology with 4 nodes, D reaches the root over B or C with the same
+    # number of hops, but the link to B loses most frames
+    #   A
+    #  / \
+    # B   C
+    #  .  |
+    #   . |
+    #     D
+    topology = ("A B\n"
+                "A C\n"
+                "B D 0.3\n"
+                "C D\n")
+    zep_dispatch.stdin.write(topology.encode())
+    zep_dispatch.stdin.close()
+
+    # create native instances
+    nodes = factory.get_shells(4)
+    A, B, C, D = nodes
+
+    # add prefix to root node
+    A.cmd("nib prefix add 5 2001:db8::/32")
+    A.cmd("ifconfig 5 add 2001:db8::1/32")
+    A.cmd("rpl root 0 2001:db8::1")
+
+    # wait for the creation of the DODAG
+    time.sleep(10)
+
+    netif, b_addr = link_local_addr(B.ifconfig_list())
+    _, c_addr = link_local_addr(C.ifconfig_list())
+
+    # send unicast frames to both candidate parents, so the ETX of both links
+    # is measured
+    for addr in (b_addr, c_addr):
+        D.ping6("{}%{}".format(addr, netif), count=20, interval=100)
+
+    # let the neighbors send DIOs, this reevaluates the parents
+    D.cmd("rpl send dis")
+    time.sleep(3)
+
+    ocp, parents = rpl_instance(D.cmd("rpl"))
+    assert ocp == OCP_MRHOF
+    # preferred parent comes first
+    assert parents[0] == c_addr
+
+    # terminate nodes
+    for n in nodes:
+        n.stop_term()
+
+
+def run_test(func, factory):
+    with Popen([ZEP_DISPATCH_PATH, '-t', '-', '127.0.0.1', '17754'], stdin=subprocess.PIPE) as zep_dispatch:
+        try:
+            func(factory, zep_dispatch)
+        finally:
+            zep_dispatch.terminate()
+
+
+if __name__ == "__main__":
+    board = os.environ.get('BOARD', 'native')
+    if board not in ['native', 'native32', 'native64']:
+        print('\x1b[1;31mThis test requires a native board.\x1b[0m\n',
+              file=sys.stderr)
+        sys.exit(1)
+    with RIOTCtrlAppFactory(board) as factory:
+        run_test(test_parent_follows_link_quality, factory)
@@ -31,6 +31,7 @@
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
 #include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/frag/sfr/path.h"
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/netdev_test.h"
 #ifdef MODULE_OD
@@ -337,6 +338,9 @@ static void _set_up(void)
     _last_sent_frame = xtimer_now_usec() - CONFIG_GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
     gnrc_sixlowpan_frag_rb_reset();
     gnrc_sixlowpan_frag_vrb_reset();
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR_PATH)
+    gnrc_sixlowpan_frag_sfr_path_reset();
+#endif
     gnrc_pktbuf_init();
     memset(_mock_netif->ipv6.addrs, 0, sizeof(_mock_netif->ipv6.addrs));
     memset(_mock_netif->ipv6.addrs_flags, 0,
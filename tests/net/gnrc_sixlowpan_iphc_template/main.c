@@ -0,0 +1,325 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the IPHC header templates against full compression
+ *
+ * UDP datagrams are handed to 6LoWPAN and the frames a `netdev_test`
+ * IEEE 802.15.4 device is asked to send are captured. Every frame built from
+ * a template has to match the frame full compression yields for the same
+ * datagram byte for byte, also after the compression contexts changed.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+
+#define PORT                (61616U)
+#define PAYLOAD_LEN         (16U)
+#define MAX_PDU_SIZE        (102U)
+#define CTX_ID              (0U)
+/* context changed to drop all templates, its prefix matches no address */
+#define CTX_ID_SCRATCH      (GNRC_SIXLOWPAN_CTX_SIZE - 1)
+
+typedef struct {
+    size_t len;
+    uint8_t data[IEEE802154_FRAME_LEN_MAX];
+} _frame_t;
+
+static const uint8_t _own_addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26, 0x01, 0x02 };
+static const uint8_t _nbr_addr[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, 0xaa, 0xbb };
+/* the IIDs are derived from the link-layer addresses, so IPHC can elide them
+ * if a context covers the prefix */
+static const ipv6_addr_t _own_global = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0xcc, 0xab, 0xfe, 0xad, 0xf7, 0x26, 0x01, 0x02,
+    } };
+static const ipv6_addr_t _nbr_global = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x55, 0x44, 0x33, 0x22, 0x11, 0x00, 0xaa, 0xbb,
+    } };
+static const ipv6_addr_t _ctx_prefix = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8,
+    } };
+static const ipv6_addr_t _scratch_prefix = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0xff, 0xff,
+    } };
+
+static netdev_test_t _netdev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _payload[PAYLOAD_LEN];
+static _frame_t *_capture;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+
+    if (_capture != NULL) {
+        ssize_t res = iolist_to_buffer(iolist, _capture->data,
+                                       sizeof(_capture->data));
+        expect(res > 0);
+        _capture->len = res;
+        _capture = NULL;
+        mutex_unlock(&_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = MAX_PDU_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_own_addr));
+    memcpy(value, _own_addr, sizeof(_own_addr));
+    return sizeof(_own_addr);
+}
+
+/* hands a UDP datagram with the given checksum to 6LoWPAN and captures the
+ * 6LoWPAN part of the resulting frame */
+static void _compress(_frame_t *frame, uint16_t checksum)
+{
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+    _frame_t captured;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    TEST_ASSERT_NOT_NULL(pkt);
+    ((udp_hdr_t *)pkt->data)->length = byteorder_htons(gnrc_pkt_len(pkt));
+    ((udp_hdr_t *)pkt->data)->checksum = byteorder_htons(checksum);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_own_global, &_nbr_global);
+    TEST_ASSERT_NOT_NULL(pkt);
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->len = byteorder_htons(gnrc_pkt_len(pkt->next));
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, _nbr_addr, sizeof(_nbr_addr));
+    TEST_ASSERT_NOT_NULL(netif_hdr);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+
+    _capture = &captured;
+    TEST_ASSERT(gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+    mutex_lock(&_sent);
+
+    /* the MAC header differs in the sequence number */
+    size_t mhr_len = ieee802154_get_frame_hdr_len(captured.data);
+    TEST_ASSERT(mhr_len > 0);
+    TEST_ASSERT(captured.len > mhr_len);
+    frame->len = captured.len - mhr_len;
+    memcpy(frame->data, &captured.data[mhr_len], frame->len);
+}
+
+/* compresses a datagram without templates */
+static void _compress_full(_frame_t *frame, uint16_t checksum)
+{
+    unsigned hits;
+
+    /* a change of the contexts invalidates all templates */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(CTX_ID_SCRATCH,
+                                                   &_scratch_prefix, 32, 1,
+                                                   true));
+    gnrc_sixlowpan_ctx_remove(CTX_ID_SCRATCH);
+
+    hits = gnrc_sixlowpan_iphc_template_hits();
+    _compress(frame, checksum);
+    TEST_ASSERT_EQUAL_INT(hits, gnrc_sixlowpan_iphc_template_hits());
+}
+
+/* compresses a datagram, expecting the headers to come from a template */
+static void _compress_template(_frame_t *frame, uint16_t checksum)
+{
+    unsigned hits = gnrc_sixlowpan_iphc_template_hits();
+
+    _compress(frame, checksum);
+    TEST_ASSERT_EQUAL_INT(hits + 1, gnrc_sixlowpan_iphc_template_hits());
+}
+
+static bool _frame_equal(const _frame_t *a, const _frame_t *b)
+{
+    return (a->len == b->len) && (memcmp(a->data, b->data, a->len) == 0);
+}
+
+static void _add_ctx(bool comp)
+{
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(CTX_ID, &_ctx_prefix, 64,
+                                                   60, comp));
+}
+
+static void set_up(void)
+{
+    gnrc_sixlowpan_ctx_remove(CTX_ID);
+    gnrc_sixlowpan_ctx_remove(CTX_ID_SCRATCH);
+}
+
+static void test_iphc_template__stateless(void)
+{
+    _frame_t full, template;
+
+    _compress_full(&full, 0x1234);
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&full, &template));
+}
+
+static void test_iphc_template__checksum(void)
+{
+    _frame_t full, template;
+
+    _add_ctx(true);
+    _compress_full(&full, 0x1234);
+    /* only the checksum differs from the datagram the template is built
+     * from */
+    _compress_template(&template, 0xabcd);
+    _compress_full(&full, 0xabcd);
+    TEST_ASSERT(_frame_equal(&full, &template));
+}
+
+static void test_iphc_template__ctx_added(void)
+{
+    _frame_t stateless, full, template;
+
+    _compress_full(&stateless, 0x1234);
+    _compress_template(&template, 0x1234);
+
+    _add_ctx(true);
+    _compress(&full, 0x1234);
+    TEST_ASSERT(full.len < stateless.len);
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&full, &template));
+}
+
+static void test_iphc_template__ctx_changed(void)
+{
+    _frame_t stateless, full, template;
+
+    _compress_full(&stateless, 0x1234);
+    _add_ctx(true);
+    _compress_full(&full, 0x1234);
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&full, &template));
+
+    /* withdrawn from compression, the template using it is stale */
+    _add_ctx(false);
+    _compress(&full, 0x1234);
+    TEST_ASSERT(_frame_equal(&stateless, &full));
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&stateless, &template));
+}
+
+static void test_iphc_template__ctx_removed(void)
+{
+    _frame_t stateless, full, template;
+
+    _compress_full(&stateless, 0x1234);
+    _add_ctx(true);
+    _compress_full(&full, 0x1234);
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&full, &template));
+
+    gnrc_sixlowpan_ctx_remove(CTX_ID);
+    _compress(&full, 0x1234);
+    TEST_ASSERT(_frame_equal(&stateless, &full));
+    _compress_template(&template, 0x1234);
+    TEST_ASSERT(_frame_equal(&stateless, &template));
+}
+
+static Test *tests_iphc_template(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_iphc_template__stateless),
+        new_TestFixture(test_iphc_template__checksum),
+        new_TestFixture(test_iphc_template__ctx_added),
+        new_TestFixture(test_iphc_template__ctx_changed),
+        new_TestFixture(test_iphc_template__ctx_removed),
+    };
+
+    EMB_UNIT_TESTCALLER(iphc_template_tests, set_up, NULL, fixtures);
+
+    return (Test *)&iphc_template_tests;
+}
+
+static void _init(void)
+{
+    for (unsigned i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i;
+    }
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_send_cb(&_netdev, _netdev_send);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS_LONG, _get_address_long);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "test_wpan",
+                                        &_netdev.netdev.netdev) == 0);
+}
+
+int main(void)
+{
+    _init();
+
+    TESTS_START();
+    TESTS_RUN(tests_iphc_template());
+    TESTS_END();
+
+    return 0;
+}
@@ -341,6 +341,36 @@ static void tests_littlefs_statvfs(void)
     TEST_ASSERT(stat1.f_bavail > stat2.f_bavail);
 }
 
+static void tests_littlefs_maintain(void)
+{
+    const char buf[] = "TESTSTRING";
+    littlefs2_stats_t stats1;
+    littlefs2_stats_t stats2;
+    int res;
+
+    /* erase all unused blocks ahead of time */
+    while ((res = vfs_maintain("/test-littlefs/")) == 1) {}
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    littlefs2_get_stats(&littlefs_desc, &stats1);
+    TEST_ASSERT(stats1.background_erases > 0);
+
+    int fd = vfs_open("/test-littlefs/test.txt", O_CREAT | O_RDWR, 0);
+    TEST_ASSERT(fd >= 0);
+
+    for (int i = 0; i < 128; ++i) {
+        res = vfs_write(fd, buf, sizeof(buf));
+        TEST_ASSERT(res == sizeof(buf));
+    }
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    /* the new blocks of the file were not erased again */
+    littlefs2_get_stats(&littlefs_desc, &stats2);
+    TEST_ASSERT(stats2.erases_saved > stats1.erases_saved);
+}
+
 Test *tests_littlefs(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -352,6 +382,7 @@ Test *tests_littlefs(void)
         new_TestFixture(tests_littlefs_readdir),
         new_TestFixture(tests_littlefs_rename),
         new_TestFixture(tests_littlefs_statvfs),
+        new_TestFixture(tests_littlefs_maintain),
     };
 
     EMB_UNIT_TESTCALLER(littlefs_tests, test_littlefs_setup, test_littlefs_teardown, fixtures);
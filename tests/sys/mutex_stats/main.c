@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex contention statistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "mutex_stats.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WAIT_US     (2000U)
+
+static mutex_t mtx = MUTEX_INIT;
+static char stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *waiter(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx);
+    mutex_unlock(&mtx);
+    return NULL;
+}
+
+int main(void)
+{
+    mutex_stats_t stats[CONFIG_MUTEX_STATS_NUMOF];
+    const mutex_stats_t *entry = NULL;
+
+    mutex_lock(&mtx);
+    /* the waiter has a higher priority and blocks on the mutex right away */
+    thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  waiter, NULL, "waiter");
+    ztimer_sleep(ZTIMER_USEC, WAIT_US);
+    mutex_unlock(&mtx);
+
+    mutex_stats_print();
+
+    size_t n = mutex_stats_get(stats, CONFIG_MUTEX_STATS_NUMOF);
+    for (size_t i = 0; i < n; i++) {
+        if (stats[i].mutex == &mtx) {
+            entry = &stats[i];
+        }
+    }
+
+    expect(entry != NULL);
+    expect(entry->acquisitions == 2);
+    expect(entry->contended == 1);
+    expect(entry->wait_max >= WAIT_US);
+    expect(entry->hold_max >= WAIT_US);
+    expect(!entry->locked);
+
+    puts("TEST PASSED");
+    return 0;
+}
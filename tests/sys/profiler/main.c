@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler test application
+ *
+ * Burns CPU in two functions with a 3:1 ratio of runtime and dumps the
+ * samples. Feed the output to `dist/tools/profiler/profiler.py` to see them
+ * show up in the flat profile.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "profiler.h"
+
+#define ITERATIONS  (1000000LU)
+
+static volatile uint32_t _sink;
+
+static void __attribute__((noinline)) hot_function(void)
+{
+    for (unsigned long i = 0; i < 3 * ITERATIONS; i++) {
+        _sink = _sink * 1103515245 + 12345;
+    }
+}
+
+static void __attribute__((noinline)) cold_function(void)
+{
+    for (unsigned long i = 0; i < ITERATIONS; i++) {
+        _sink = _sink * 1103515245 + 12345;
+    }
+}
+
+int main(void)
+{
+    if (profiler_start() != 0) {
+        puts("FAILED to start profiler");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < 10; i++) {
+        hot_function();
+        cold_function();
+    }
+
+    profiler_stop();
+    profiler_dump();
+
+    puts(profiler_total() > 0 ? "SUCCESS" : "FAILED: no samples taken");
+
+    return 0;
+}
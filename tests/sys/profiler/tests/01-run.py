@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import subprocess
+import sys
+from testrunner import run
+
+EM_ARM = 40
+
+
+def function_ranges(names):
+    elffile = os.environ["ELFFILE"]
+    with open(elffile, "rb") as f:
+        header = f.read(20)
+    byteorder = "little" if header[5] == 1 else "big"
+    # Thumb function symbols have the LSB set, PCs never do
+    mask = ~1 if int.from_bytes(header[18:20], byteorder) == EM_ARM else ~0
+    out = subprocess.check_output([os.environ.get("NM", "nm"), "--defined-only",
+                                   "-S", elffile], universal_newlines=True)
+    ranges = {}
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3] in names:
+            start = int(fields[0], 16) & mask
+            ranges[fields[3]] = range(start, start + int(fields[1], 16))
+    return ranges
+
+
+def testfunc(child):
+    ranges = function_ranges(("hot_function", "cold_function"))
+    counts = {name: 0 for name in ranges}
+
+    child.expect(r"profiler: rate=\d+ total=(\d+) dropped=(\d+)\r\n")
+    total = int(child.match.group(1))
+    dropped = int(child.match.group(2))
+    child.expect_exact("profiler: thread ")
+    for _ in range(total - dropped):
+        child.expect(r"profiler: sample \d+ 0x([0-9a-f]+)\r\n")
+        pc = int(child.match.group(1), 16)
+        for name, pcs in ranges.items():
+            if pc in pcs:
+                counts[name] += 1
+    child.expect_exact("profiler: end")
+    child.expect_exact("SUCCESS")
+
+    # hot_function runs three times as long as cold_function
+    print("hot_function: {hot_function}, cold_function: {cold_function}"
+          .format(**counts))
+    assert counts["hot_function"] > 2 * counts["cold_function"]
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
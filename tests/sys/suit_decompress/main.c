@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup    tests
+ * @{
+ *
+ * @file
+ * @brief      Tests for SUIT compressed payloads
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "container.h"
+#include "suit/transport/decompress.h"
+#include "embUnit.h"
+
+static const char _image[] =
+    "RIOT - The friendly Operating System for the Internet of Things. "
+    "RIOT runs on the friendly things of the Internet, the friendly RIOT. "
+    "0000000000000000000000000000000000000000!\n";
+
+/* _image as heatshrink stream with 8 window and 4 lookahead bits, it ends
+ * with an overlapping back-reference */
+static const uint8_t _compressed[] = {
+    0xa9, 0x52, 0x69, 0xf5, 0x49, 0x04, 0xb6, 0x41, 0x54, 0xb4, 0x59, 0x64,
+    0x16, 0x6b, 0x95, 0xa6, 0xcb, 0x6e, 0xb2, 0x5b, 0x2f, 0x32, 0x0a, 0x7d,
+    0xc2, 0xcb, 0x72, 0xb0, 0xdd, 0x2d, 0x36, 0xeb, 0x3c, 0x82, 0xa7, 0x79,
+    0xb9, 0xdd, 0x2c, 0xb6, 0xd9, 0x05, 0x9a, 0xdf, 0x72, 0x90, 0x5d, 0x04,
+    0x25, 0x49, 0xb7, 0x5d, 0x2c, 0xb7, 0x2b, 0x75, 0x96, 0xe9, 0x20, 0xb7,
+    0xd9, 0x86, 0x24, 0x20, 0x2b, 0x9c, 0xba, 0x40, 0x40, 0x4b, 0x95, 0xd6,
+    0xdd, 0x73, 0x90, 0x5b, 0xed, 0xc2, 0x44, 0x23, 0x45, 0xd0, 0x42, 0x82,
+    0xb3, 0x1d, 0xdc, 0xb0, 0x49, 0xa3, 0xe3, 0x97, 0x48, 0x26, 0x00, 0x0f,
+    0x00, 0x78, 0x01, 0xa4, 0x30, 0xa0,
+};
+
+static suit_decompress_t _decompress;
+static uint8_t _block[48];
+static uint8_t _target[sizeof(_image)];
+static size_t _target_len;
+static size_t _image_size;
+static bool _finished;
+
+/* collects the expanded image and checks its size like the storage helper of
+ * the worker does with the size parameter of the manifest */
+static int _sink(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+
+    if ((offset != _target_len) || (len > _image_size - offset)) {
+        return -EOVERFLOW;
+    }
+    memcpy(&_target[offset], buf, len);
+    _target_len += len;
+    if (!more && (_target_len != _image_size)) {
+        return -EINVAL;
+    }
+    _finished = !more;
+    return 0;
+}
+
+static int _feed(size_t len, size_t block_size)
+{
+    for (size_t offset = 0; offset < len; offset += block_size) {
+        size_t block_len = len - offset;
+        if (block_len > block_size) {
+            block_len = block_size;
+        }
+        /* the fetch callbacks get a mutable block buffer */
+        memcpy(_block, &_compressed[offset], block_len);
+        int res = suit_decompress_apply(&_decompress, offset, _block,
+                                        block_len, offset + block_len < len);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static void set_up(void)
+{
+    memset(_target, 0, sizeof(_target));
+    _target_len = 0;
+    _image_size = sizeof(_image) - 1;
+    _finished = false;
+    suit_decompress_init(&_decompress, _sink, NULL);
+}
+
+static void _check_target(void)
+{
+    TEST_ASSERT(_finished);
+    TEST_ASSERT_EQUAL_INT(sizeof(_image) - 1, _target_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_image, _target, sizeof(_image) - 1));
+    TEST_ASSERT_EQUAL_INT(sizeof(_compressed), _decompress.received);
+}
+
+static void test_suit_decompress_whole(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _feed(sizeof(_compressed), sizeof(_block)));
+    _check_target();
+}
+
+static void test_suit_decompress_blocks(void)
+{
+    /* around the size of the input buffer of the decoder */
+    static const size_t block_sizes[] = { 1, 5, 31, 32, 33 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(block_sizes); i++) {
+        set_up();
+        TEST_ASSERT_EQUAL_INT(0, _feed(sizeof(_compressed), block_sizes[i]));
+        _check_target();
+    }
+}
+
+static void test_suit_decompress_truncated(void)
+{
+    TEST_ASSERT(_feed(sizeof(_compressed) - 4, sizeof(_block)) < 0);
+    TEST_ASSERT(!_finished);
+}
+
+static void test_suit_decompress_overflow(void)
+{
+    _image_size = sizeof(_image) - 2;
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, _feed(sizeof(_compressed),
+                                            sizeof(_block)));
+    TEST_ASSERT(!_finished);
+}
+
+Test *tests_suit_decompress(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_decompress_whole),
+        new_TestFixture(test_suit_decompress_blocks),
+        new_TestFixture(test_suit_decompress_truncated),
+        new_TestFixture(test_suit_decompress_overflow),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_decompress_tests, set_up, NULL, fixtures);
+
+    return (Test *)&suit_decompress_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_decompress());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup    tests
+ * @{
+ *
+ * @file
+ * @brief      Tests for SUIT delta payloads
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "container.h"
+#include "suit/transport/delta.h"
+#include "embUnit.h"
+
+/* Generated using open-vcdiff:
+ * $ echo "Hello world! I hope you are doing well ..." >source.bin
+ * $ echo "Hello universe! I hope you are doing well ..." >target.bin
+ * $ vcdiff delta -interleaved -dictionary source.bin <target.bin >delta.bin */
+#include "blob/source.bin.h"
+#include "blob/target.bin.h"
+#include "blob/delta.bin.h"
+
+/* adds "Hello" and copies it again from the target window, which starts
+ * right after the 43 bytes of source.bin */
+static const uint8_t _target_copy_delta[] = {
+    0xd6, 0xc3, 0xc4, 0x53, 0x00,   /* header, interleaved format */
+    0x01, 0x2b, 0x00,               /* window copies from the source */
+    0x0d, 0x0a, 0x00,               /* 13 bytes of delta, 10 bytes target */
+    0x00, 0x08, 0x00,               /* data, instructions, addresses */
+    0x06, 'H', 'e', 'l', 'l', 'o',  /* ADD 5 */
+    0x15, 0x2b,                     /* COPY 5 from target offset 0 */
+};
+
+static suit_delta_t _delta;
+static uint8_t _block[16];
+static uint8_t _target[64];
+static size_t _target_len;
+static bool _finished;
+
+/* collects the reconstructed image like the storage helper of the worker */
+static int _sink(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+
+    if ((offset != _target_len) || (len > sizeof(_target) - offset)) {
+        return -EINVAL;
+    }
+    memcpy(&_target[offset], buf, len);
+    _target_len += len;
+    _finished = !more;
+    return 0;
+}
+
+static int _feed(const uint8_t *delta, size_t delta_len, size_t block_size)
+{
+    for (size_t offset = 0; offset < delta_len; offset += block_size) {
+        size_t len = delta_len - offset;
+        if (len > block_size) {
+            len = block_size;
+        }
+        /* the fetch callbacks get a mutable block buffer */
+        memcpy(_block, &delta[offset], len);
+        int res = suit_delta_apply(&_delta, offset, _block, len,
+                                   offset + len < delta_len);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static void set_up(void)
+{
+    memset(_target, 0, sizeof(_target));
+    _target_len = 0;
+    _finished = false;
+    suit_delta_init(&_delta, source_bin, source_bin_len, _sink, NULL);
+}
+
+static void _check_target(void)
+{
+    TEST_ASSERT(_finished);
+    TEST_ASSERT_EQUAL_INT(target_bin_len, _target_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(target_bin, _target, target_bin_len));
+}
+
+static void test_suit_delta_whole(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _feed(delta_bin, delta_bin_len, delta_bin_len));
+    _check_target();
+}
+
+static void test_suit_delta_blocks(void)
+{
+    static const size_t block_sizes[] = { 1, 3, 7, sizeof(_block) };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(block_sizes); i++) {
+        set_up();
+        TEST_ASSERT_EQUAL_INT(0, _feed(delta_bin, delta_bin_len,
+                                       block_sizes[i]));
+        _check_target();
+    }
+}
+
+static void test_suit_delta_short_source(void)
+{
+    /* the delta copies from beyond the end of the source image */
+    suit_delta_init(&_delta, source_bin, source_bin_len / 2, _sink, NULL);
+    TEST_ASSERT(_feed(delta_bin, delta_bin_len, sizeof(_block)) < 0);
+    TEST_ASSERT(!_finished);
+}
+
+static void test_suit_delta_target_copy(void)
+{
+    TEST_ASSERT(_feed(_target_copy_delta, sizeof(_target_copy_delta),
+                      sizeof(_block)) < 0);
+    TEST_ASSERT(!_finished);
+}
+
+Test *tests_suit_delta(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_delta_whole),
+        new_TestFixture(test_suit_delta_blocks),
+        new_TestFixture(test_suit_delta_short_source),
+        new_TestFixture(test_suit_delta_target_copy),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_delta_tests, set_up, NULL, fixtures);
+
+    return (Test *)&suit_delta_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_delta());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup    tests
+ * @{
+ *
+ * @file
+ * @brief      Tests for the SUIT pipelined payload storage
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/transport/pipeline.h"
+#include "embUnit.h"
+
+#define BLOCK_SIZE      (16U)
+#define PAYLOAD_SIZE    (3 * BLOCK_SIZE)
+
+static suit_manifest_t _manifest;
+static suit_storage_t *_storage;
+static uint8_t _payload[PAYLOAD_SIZE];
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(_payload); i++) {
+        _payload[i] = i;
+    }
+    _storage = suit_storage_find_by_id(".ram.0");
+    TEST_ASSERT_NOT_NULL(_storage);
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_erase(_storage));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK,
+                          suit_storage_set_active_location(_storage, ".ram.0"));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK,
+                          suit_storage_start(_storage, &_manifest,
+                                             sizeof(_payload)));
+    TEST_ASSERT_EQUAL_INT(0, suit_pipeline_start(&_manifest, _storage));
+}
+
+static void test_suit_pipeline_in_order(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    const uint8_t *stored;
+    size_t stored_len;
+
+    for (size_t offset = 0; offset < sizeof(_payload); offset += BLOCK_SIZE) {
+        TEST_ASSERT_EQUAL_INT(0, suit_pipeline_put(offset, &_payload[offset],
+                                                   BLOCK_SIZE,
+                                                   offset + BLOCK_SIZE <
+                                                   sizeof(_payload)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, suit_pipeline_finish(digest));
+
+    sha256(_payload, sizeof(_payload), expected);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digest, sizeof(digest)));
+    suit_storage_read_ptr(_storage, &stored, &stored_len);
+    TEST_ASSERT_EQUAL_INT(sizeof(_payload), stored_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_payload, stored, sizeof(_payload)));
+}
+
+static void test_suit_pipeline_out_of_order(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    TEST_ASSERT_EQUAL_INT(0, suit_pipeline_put(0, _payload, BLOCK_SIZE, true));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          suit_pipeline_put(2 * BLOCK_SIZE,
+                                            &_payload[2 * BLOCK_SIZE],
+                                            BLOCK_SIZE, false));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, suit_pipeline_finish(digest));
+}
+
+static void test_suit_pipeline_repeated(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    TEST_ASSERT_EQUAL_INT(0, suit_pipeline_put(0, _payload, BLOCK_SIZE, true));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          suit_pipeline_put(0, _payload, BLOCK_SIZE, true));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, suit_pipeline_finish(digest));
+}
+
+static void test_suit_pipeline_short_block(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    /* the offset of the next block is advanced by the block size, not by
+     * what was actually received */
+    TEST_ASSERT_EQUAL_INT(0, suit_pipeline_put(0, _payload, BLOCK_SIZE / 2,
+                                               true));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          suit_pipeline_put(BLOCK_SIZE, &_payload[BLOCK_SIZE],
+                                            BLOCK_SIZE, true));
+    /* rejected even if the following block happens to fit again */
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          suit_pipeline_put(BLOCK_SIZE / 2,
+                                            &_payload[BLOCK_SIZE / 2],
+                                            BLOCK_SIZE, false));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, suit_pipeline_finish(digest));
+}
+
+static void test_suit_pipeline_restart(void)
+{
+    /* a rejected block does not affect the next payload */
+    test_suit_pipeline_short_block();
+    set_up();
+    test_suit_pipeline_in_order();
+}
+
+Test *tests_suit_pipeline(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_pipeline_in_order),
+        new_TestFixture(test_suit_pipeline_out_of_order),
+        new_TestFixture(test_suit_pipeline_repeated),
+        new_TestFixture(test_suit_pipeline_short_block),
+        new_TestFixture(test_suit_pipeline_restart),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_pipeline_tests, set_up, NULL, fixtures);
+
+    return (Test *)&suit_pipeline_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_pipeline());
+    TESTS_END();
+    return 0;
+}
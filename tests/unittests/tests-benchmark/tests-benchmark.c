@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include <errno.h>
+
+#include "embUnit.h"
+#include "tests-benchmark.h"
+
+#include "benchmark.h"
+#include "container.h"
+
+static void test_benchmark_stats_single(void)
+{
+    uint32_t samples[] = { 42 };
+    benchmark_stats_t stats;
+
+    benchmark_stats_compute(samples, ARRAY_SIZE(samples), &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.runs);
+    TEST_ASSERT_EQUAL_INT(42, stats.min);
+    TEST_ASSERT_EQUAL_INT(42, stats.median);
+    TEST_ASSERT_EQUAL_INT(42, stats.p99);
+    TEST_ASSERT_EQUAL_INT(42, stats.max);
+    TEST_ASSERT_EQUAL_INT(42, stats.mean);
+    TEST_ASSERT_EQUAL_INT(0, stats.stddev);
+}
+
+static void test_benchmark_stats_even(void)
+{
+    /* unsorted on purpose */
+    uint32_t samples[] = { 40, 10, 30, 20 };
+    benchmark_stats_t stats;
+
+    benchmark_stats_compute(samples, ARRAY_SIZE(samples), &stats);
+    TEST_ASSERT_EQUAL_INT(10, samples[0]);
+    TEST_ASSERT_EQUAL_INT(40, samples[3]);
+    TEST_ASSERT_EQUAL_INT(10, stats.min);
+    TEST_ASSERT_EQUAL_INT(25, stats.median);
+    TEST_ASSERT_EQUAL_INT(40, stats.p99);
+    TEST_ASSERT_EQUAL_INT(40, stats.max);
+    TEST_ASSERT_EQUAL_INT(25, stats.mean);
+    /* sample variance is 166 */
+    TEST_ASSERT_EQUAL_INT(12, stats.stddev);
+}
+
+static void test_benchmark_stats_percentile(void)
+{
+    uint32_t samples[200];
+    benchmark_stats_t stats;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(samples); i++) {
+        samples[i] = ARRAY_SIZE(samples) - i;
+    }
+
+    benchmark_stats_compute(samples, ARRAY_SIZE(samples), &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.min);
+    TEST_ASSERT_EQUAL_INT(100, stats.median);
+    TEST_ASSERT_EQUAL_INT(198, stats.p99);
+    TEST_ASSERT_EQUAL_INT(200, stats.max);
+}
+
+static unsigned _setup_calls;
+static unsigned _func_calls;
+static unsigned _teardown_calls;
+
+static void _setup(void *arg)
+{
+    (void)arg;
+    _setup_calls++;
+}
+
+static void _func(void *arg)
+{
+    (void)arg;
+    _func_calls++;
+}
+
+static void _teardown(void *arg)
+{
+    (void)arg;
+    _teardown_calls++;
+}
+
+static void test_benchmark_run(void)
+{
+    const benchmark_case_t bench = {
+        .name = "count",
+        .setup = _setup,
+        .func = _func,
+        .teardown = _teardown,
+        .iterations = 10,
+        .runs = 5,
+        .warmup = 2,
+    };
+    benchmark_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(0, benchmark_run(&bench, &stats));
+    TEST_ASSERT_EQUAL_INT(1, _setup_calls);
+    TEST_ASSERT_EQUAL_INT(70, _func_calls);
+    TEST_ASSERT_EQUAL_INT(1, _teardown_calls);
+    TEST_ASSERT_EQUAL_INT(5, stats.runs);
+    TEST_ASSERT_EQUAL_INT(10, stats.iterations);
+}
+
+static void test_benchmark_run_warmup(void)
+{
+    const benchmark_case_t dflt = {
+        .func = _func,
+        .iterations = 10,
+        .runs = 5,
+        .warmup = BENCHMARK_DEFAULT,
+    };
+    const benchmark_case_t none = {
+        .func = _func,
+        .iterations = 10,
+        .runs = 5,
+        .warmup = BENCHMARK_NO_WARMUP,
+    };
+    benchmark_stats_t stats;
+    unsigned calls;
+
+    calls = _func_calls;
+    TEST_ASSERT_EQUAL_INT(0, benchmark_run(&dflt, &stats));
+    TEST_ASSERT_EQUAL_INT((5 + CONFIG_BENCHMARK_WARMUP_DEFAULT) * 10,
+                          _func_calls - calls);
+
+    calls = _func_calls;
+    TEST_ASSERT_EQUAL_INT(0, benchmark_run(&none, &stats));
+    TEST_ASSERT_EQUAL_INT(5 * 10, _func_calls - calls);
+    TEST_ASSERT_EQUAL_INT(5, stats.runs);
+}
+
+static void test_benchmark_run_invalid(void)
+{
+    const benchmark_case_t no_func = { .name = "no_func" };
+    const benchmark_case_t too_many = {
+        .name = "too_many",
+        .func = _func,
+        .runs = CONFIG_BENCHMARK_RUNS_MAX + 1,
+    };
+    benchmark_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, benchmark_run(&no_func, &stats));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, benchmark_run(&too_many, &stats));
+}
+
+static Test *tests_benchmark_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_benchmark_stats_single),
+        new_TestFixture(test_benchmark_stats_even),
+        new_TestFixture(test_benchmark_stats_percentile),
+        new_TestFixture(test_benchmark_run),
+        new_TestFixture(test_benchmark_run_warmup),
+        new_TestFixture(test_benchmark_run_invalid),
+    };
+
+    EMB_UNIT_TESTCALLER(benchmark_tests, NULL, NULL, fixtures);
+
+    return (Test *)&benchmark_tests;
+}
+
+void tests_benchmark(void)
+{
+    TESTS_RUN(tests_benchmark_tests());
+}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/ipv6/flow_cache.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+
+#include "tests-gnrc_ipv6_flow_cache.h"
+
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define L2ADDR              { 0x90, 0xd5, 0x8e, 0x8c, 0x92, 0x43, 0x73, 0x5c }
+#define IFACE               (6)
+
+static const ipv6_addr_t _dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                           { .u64 = 0x1 } } };
+static const ipv6_addr_t _nbr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                           { .u64 = 0x2 } } };
+static gnrc_netif_t _netif;
+
+static void _fill_nce(gnrc_ipv6_nib_nc_t *nce, uint16_t nud_state)
+{
+    static const uint8_t l2addr[] = L2ADDR;
+
+    memset(nce, 0, sizeof(*nce));
+    nce->ipv6 = _nbr;
+    memcpy(nce->l2addr, l2addr, sizeof(l2addr));
+    nce->l2addr_len = sizeof(l2addr);
+    nce->info = nud_state | (IFACE << GNRC_IPV6_NIB_NC_INFO_IFACE_POS);
+}
+
+static void set_up(void)
+{
+    gnrc_ipv6_nib_init();
+    /* invalidates the entries of the previous test */
+    gnrc_ipv6_nib_changed();
+}
+
+static void test_flow_cache_get__empty(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+}
+
+static void test_flow_cache_add_get(void)
+{
+    gnrc_ipv6_nib_nc_t in, out;
+
+    _fill_nce(&in, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &in);
+    TEST_ASSERT(gnrc_ipv6_flow_cache_get(&_dst, NULL, &out));
+    TEST_ASSERT(ipv6_addr_equal(&_nbr, &out.ipv6));
+    TEST_ASSERT_EQUAL_INT(in.l2addr_len, out.l2addr_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in.l2addr, out.l2addr, in.l2addr_len));
+    TEST_ASSERT_EQUAL_INT(IFACE, gnrc_ipv6_nib_nc_get_iface(&out));
+
+    /* the interface given by the sender is part of the key */
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, &_netif, &out));
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_nbr, NULL, &out));
+}
+
+static void test_flow_cache_add__stale(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)) {
+        return;
+    }
+    _fill_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE);
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &nce);
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+}
+
+static void test_flow_cache_add__outdated(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t gen = gnrc_ipv6_nib_generation();
+
+    /* the NIB changed while the next hop was resolved */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_nbr, IFACE, NULL, 0));
+    _fill_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gen, &nce);
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+}
+
+static void test_flow_cache_invalidate__nc(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _fill_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &nce);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_nbr, IFACE, NULL, 0));
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &nce);
+    gnrc_ipv6_nib_nc_del(&_nbr, IFACE);
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+}
+
+static void test_flow_cache_invalidate__ft(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _fill_nce(&nce, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE);
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &nce);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&_dst, IPV6_ADDR_BIT_LEN,
+                                                  &_nbr, IFACE, 0));
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+
+    gnrc_ipv6_flow_cache_add(&_dst, NULL, gnrc_ipv6_nib_generation(), &nce);
+    gnrc_ipv6_nib_ft_del(&_dst, IPV6_ADDR_BIT_LEN);
+    TEST_ASSERT(!gnrc_ipv6_flow_cache_get(&_dst, NULL, &nce));
+}
+
+Test *tests_gnrc_ipv6_flow_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_flow_cache_get__empty),
+        new_TestFixture(test_flow_cache_add_get),
+        new_TestFixture(test_flow_cache_add__stale),
+        new_TestFixture(test_flow_cache_add__outdated),
+        new_TestFixture(test_flow_cache_invalidate__nc),
+        new_TestFixture(test_flow_cache_invalidate__ft),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_ipv6_flow_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_ipv6_flow_cache_tests;
+}
+
+void tests_gnrc_ipv6_flow_cache(void)
+{
+    TESTS_RUN(tests_gnrc_ipv6_flow_cache_tests());
+}
+/** @} */
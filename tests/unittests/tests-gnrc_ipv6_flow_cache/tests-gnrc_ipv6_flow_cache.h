@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup unittests
+ * @{
+ *
+ * @file
+ * @brief   Unittests for the `gnrc_ipv6_flow_cache` module
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_gnrc_ipv6_flow_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,397 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/rpl/dao_table.h"
+#include "net/gnrc/rpl/dodag.h"
+
+#include "tests-gnrc_rpl_dao_table.h"
+
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define LINK_LOCAL_PREFIX   { 0xfe, 0x80, 0, 0, 0, 0, 0, 0 }
+#define IFACE               (6)
+#define LTIME               (CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC * 2)
+
+static void _target(ipv6_addr_t *addr, uint8_t iid)
+{
+    static const ipv6_addr_t prefix = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    *addr = prefix;
+    addr->u8[15] = iid;
+}
+
+static void _next_hop(ipv6_addr_t *addr, uint8_t iid)
+{
+    static const ipv6_addr_t prefix = { .u64 = { { .u8 = LINK_LOCAL_PREFIX } } };
+
+    *addr = prefix;
+    addr->u8[15] = iid;
+}
+
+static int _add(uint8_t target_iid, uint8_t next_hop_iid, uint32_t ltime)
+{
+    ipv6_addr_t target, next_hop;
+
+    _target(&target, target_iid);
+    _next_hop(&next_hop, next_hop_iid);
+    return gnrc_rpl_dao_table_add(&target, IPV6_ADDR_BIT_LEN, &next_hop,
+                                  IFACE, ltime);
+}
+
+/* returns the IID of the next hop of the route to target, 0 if there is no
+ * route or it is over another interface */
+static uint8_t _route(uint8_t target_iid, uint8_t *len)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t target;
+
+    _target(&target, target_iid);
+    if (!gnrc_rpl_dao_table_get_route(&target, 0, &fte) ||
+        (fte.iface != IFACE)) {
+        return 0;
+    }
+    if (len != NULL) {
+        *len = fte.dst_len;
+    }
+    return fte.next_hop.u8[15];
+}
+
+static unsigned _routes(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+    unsigned count = 0;
+
+    while (gnrc_rpl_dao_table_iter(&state, &fte)) {
+        count++;
+    }
+    return count;
+}
+
+static void set_up(void)
+{
+    gnrc_rpl_dao_table_flush(0);
+}
+
+static void test_dao_table_get_route__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0, _routes());
+}
+
+static void test_dao_table_add_get(void)
+{
+    uint8_t len;
+
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, &len));
+    TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, len);
+    TEST_ASSERT_EQUAL_INT(0, _route(0x20, NULL));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+}
+
+static void test_dao_table_get_route__longest_match(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t target, next_hop;
+
+    /* route to the /64 of the target over another child */
+    _target(&target, 0);
+    _next_hop(&next_hop, 0x2);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_dao_table_add(&target, 64, &next_hop,
+                                                    IFACE, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0x2, _route(0x20, NULL));
+
+    /* routes shorter than min_len are left to the NIB */
+    _target(&target, 0x20);
+    TEST_ASSERT(!gnrc_rpl_dao_table_get_route(&target, 65, &fte));
+    TEST_ASSERT(gnrc_rpl_dao_table_get_route(&target, 64, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+}
+
+static void test_dao_table_add__refresh(void)
+{
+    uint32_t gen;
+
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    gen = gnrc_ipv6_nib_generation();
+    /* only the lifetime changes, routing decisions stay valid */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(gen, gnrc_ipv6_nib_generation());
+    /* the target moved to another child */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x2, LTIME));
+    TEST_ASSERT(gen != gnrc_ipv6_nib_generation());
+    TEST_ASSERT_EQUAL_INT(0x2, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+}
+
+static void test_dao_table_add__no_path(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, 0));
+    TEST_ASSERT_EQUAL_INT(0, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0, _routes());
+}
+
+static void test_dao_table_add__aggregate(void)
+{
+    gnrc_rpl_dao_table_stats_t stats;
+    uint8_t len;
+
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x11, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x11, &len));
+    TEST_ASSERT_EQUAL_INT(127, len);
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+
+    TEST_ASSERT_EQUAL_INT(0, _add(0x12, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x13, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x12, &len));
+    TEST_ASSERT_EQUAL_INT(126, len);
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+    /* refreshing a target of the merged route keeps it merged */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+
+    /* other next hop, no merge */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x14, 0x2, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x15, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(3, _routes());
+
+    gnrc_rpl_dao_table_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF, stats.numof);
+    TEST_ASSERT_EQUAL_INT(3, stats.used);
+    TEST_ASSERT_EQUAL_INT(1, stats.aggregated);
+    TEST_ASSERT_EQUAL_INT(2, stats.next_hops);
+    TEST_ASSERT(stats.size > 0);
+}
+
+static void test_dao_table_del__split(void)
+{
+    for (uint8_t iid = 0x10; iid < 0x14; iid++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(iid, 0x1, LTIME));
+    }
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+
+    ipv6_addr_t target;
+
+    _target(&target, 0x11);
+    gnrc_rpl_dao_table_del(&target, IPV6_ADDR_BIT_LEN);
+    /* ::10/128 and ::12/127 are left */
+    TEST_ASSERT_EQUAL_INT(2, _routes());
+    TEST_ASSERT_EQUAL_INT(0, _route(0x11, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x12, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x13, NULL));
+}
+
+static void test_dao_table_add__split(void)
+{
+    uint8_t len;
+
+    for (uint8_t iid = 0x10; iid < 0x14; iid++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(iid, 0x1, LTIME));
+    }
+    /* one target of the merged route moved to another child */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x13, 0x2, LTIME));
+    TEST_ASSERT_EQUAL_INT(3, _routes());
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, &len));
+    TEST_ASSERT_EQUAL_INT(127, len);
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x12, &len));
+    TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, len);
+    TEST_ASSERT_EQUAL_INT(0x2, _route(0x13, NULL));
+}
+
+static void test_dao_table_tick__expire(void)
+{
+    /* longer than a turn of the wheel */
+    const unsigned ticks = CONFIG_GNRC_RPL_DAO_TABLE_WHEEL_SIZE * 2 + 1;
+
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1,
+                                  ticks * CONFIG_GNRC_RPL_DAO_TABLE_TICK_SEC));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x1, 1));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(0, _route(0x20, NULL));
+    for (unsigned i = 1; i < ticks - 1; i++) {
+        TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    }
+    /* refresh right before the route expires */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(0, _route(0x10, NULL));
+}
+
+static void test_dao_table_tick__expire_merged(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x11, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    /* only one target is refreshed, the other one must expire in time */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(2, _routes());
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(0, _route(0x11, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_dao_table_tick());
+}
+
+static void test_dao_table_add__aggregate_same_expiry(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(0, _add(0x11, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(2, _routes());
+    /* both are refreshed in the same tick now */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+}
+
+static void test_dao_table_split__full(void)
+{
+    gnrc_rpl_dao_table_stats_t stats;
+    ipv6_addr_t target;
+    unsigned dropped;
+
+    /* the counter is not reset by flushing the table */
+    gnrc_rpl_dao_table_stats(&stats);
+    dropped = stats.dropped;
+    for (uint8_t iid = 0x10; iid < 0x14; iid++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(iid, 0x1, LTIME));
+    }
+    /* targets two apart are never merged */
+    for (unsigned i = 1; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(0x20 + (i * 2), 0x1, LTIME));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF, _routes());
+
+    /* no space to split off the refreshed target, the merged route stays */
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF,
+                          gnrc_rpl_dao_table_tick());
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x11, NULL));
+    gnrc_rpl_dao_table_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(dropped + 1, stats.dropped);
+
+    /* the route expiring first gives way to split off the removed target */
+    for (unsigned i = 2; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(0x20 + (i * 2), 0x1, LTIME));
+    }
+    _target(&target, 0x11);
+    gnrc_rpl_dao_table_del(&target, IPV6_ADDR_BIT_LEN);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF, _routes());
+    TEST_ASSERT_EQUAL_INT(0, _route(0x11, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x12, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x13, NULL));
+    TEST_ASSERT_EQUAL_INT(0, _route(0x22, NULL));
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x24, NULL));
+    gnrc_rpl_dao_table_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(dropped + 2, stats.dropped);
+}
+
+static void test_dao_table_add__full(void)
+{
+    gnrc_rpl_dao_table_stats_t stats;
+
+    /* targets two apart are never merged */
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(0x10 + (i * 2), 0x1, LTIME));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(0x01, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(0x01, 0x2, LTIME));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_RPL_DAO_TABLE_NUMOF, _routes());
+    /* the next hop of the failed route is not kept */
+    gnrc_rpl_dao_table_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.next_hops);
+
+    gnrc_rpl_dao_table_flush(0);
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_DAO_TABLE_NEXT_HOPS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _add(0x10 + (i * 2), 0x1 + i, LTIME));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(0x01, 0xff, LTIME));
+}
+
+static void test_dao_table_flush__iface(void)
+{
+    ipv6_addr_t target, next_hop;
+
+    _target(&target, 0x20);
+    _next_hop(&next_hop, 0x1);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_rpl_dao_table_add(&target, IPV6_ADDR_BIT_LEN,
+                                                    &next_hop, IFACE + 1,
+                                                    LTIME));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+    TEST_ASSERT_EQUAL_INT(2, _routes());
+    gnrc_rpl_dao_table_flush(IFACE);
+    TEST_ASSERT_EQUAL_INT(0, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(1, _routes());
+}
+
+static void test_dao_table_flush__dodag_remove(void)
+{
+    gnrc_rpl_instance_t *inst[2];
+    ipv6_addr_t dodag_id;
+
+    _target(&dodag_id, 0x1);
+    TEST_ASSERT(gnrc_rpl_instance_add(0, &inst[0]));
+    TEST_ASSERT(gnrc_rpl_dodag_init(inst[0], &dodag_id, IFACE));
+    TEST_ASSERT(gnrc_rpl_instance_add(1, &inst[1]));
+    TEST_ASSERT(gnrc_rpl_dodag_init(inst[1], &dodag_id, IFACE));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x10, 0x1, LTIME));
+
+    /* another DODAG on the interface may still use the route */
+    gnrc_rpl_instance_remove(inst[0]);
+    TEST_ASSERT_EQUAL_INT(0x1, _route(0x10, NULL));
+    gnrc_rpl_instance_remove(inst[1]);
+    TEST_ASSERT_EQUAL_INT(0, _route(0x10, NULL));
+    TEST_ASSERT_EQUAL_INT(0, _routes());
+}
+
+Test *tests_gnrc_rpl_dao_table_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dao_table_get_route__empty),
+        new_TestFixture(test_dao_table_add_get),
+        new_TestFixture(test_dao_table_get_route__longest_match),
+        new_TestFixture(test_dao_table_add__refresh),
+        new_TestFixture(test_dao_table_add__no_path),
+        new_TestFixture(test_dao_table_add__aggregate),
+        new_TestFixture(test_dao_table_del__split),
+        new_TestFixture(test_dao_table_add__split),
+        new_TestFixture(test_dao_table_tick__expire),
+        new_TestFixture(test_dao_table_tick__expire_merged),
+        new_TestFixture(test_dao_table_add__aggregate_same_expiry),
+        new_TestFixture(test_dao_table_split__full),
+        new_TestFixture(test_dao_table_add__full),
+        new_TestFixture(test_dao_table_flush__iface),
+        new_TestFixture(test_dao_table_flush__dodag_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_rpl_dao_table_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_rpl_dao_table_tests;
+}
+
+void tests_gnrc_rpl_dao_table(void)
+{
+    TESTS_RUN(tests_gnrc_rpl_dao_table_tests());
+}
+/** @} */
@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr/path.h"
+
+#include "tests-gnrc_sixlowpan_frag_sfr_path.h"
+
+static const uint8_t _addr_a[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a };
+static const uint8_t _addr_b[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0b };
+static const uint8_t _addr_c[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0c };
+static gnrc_netif_t _netif_a, _netif_b;
+
+static gnrc_sixlowpan_frag_sfr_path_t *_get(const gnrc_netif_t *netif,
+                                            const uint8_t *addr, bool create)
+{
+    return gnrc_sixlowpan_frag_sfr_path_get(netif, addr, sizeof(_addr_a),
+                                            create);
+}
+
+static void set_up(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_reset();
+}
+
+static void test_sfr_path_get__empty(void)
+{
+    TEST_ASSERT_NULL(_get(&_netif_a, _addr_a, false));
+}
+
+static void test_sfr_path_get__create(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get(&_netif_a, _addr_a, true);
+
+    TEST_ASSERT_NOT_NULL(path);
+    TEST_ASSERT(path->netif == &_netif_a);
+    TEST_ASSERT_EQUAL_INT(sizeof(_addr_a), path->l2addr_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_addr_a, path->l2addr, sizeof(_addr_a)));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS,
+                          path->rto);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_OPT_FRAG_SIZE,
+                          path->frag_size);
+    path->frag_size = 96;
+    path = _get(&_netif_a, _addr_a, false);
+    TEST_ASSERT_NOT_NULL(path);
+    TEST_ASSERT_EQUAL_INT(96, path->frag_size);
+    /* same address on another interface is another path */
+    TEST_ASSERT_NULL(_get(&_netif_b, _addr_a, false));
+}
+
+static void test_sfr_path_get__replace_lru(void)
+{
+    _get(&_netif_a, _addr_a, true)->frag_size = 80;
+    _get(&_netif_a, _addr_b, true)->frag_size = 96;
+    /* use A, so B is the least recently used */
+    TEST_ASSERT_NOT_NULL(_get(&_netif_a, _addr_a, false));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_OPT_FRAG_SIZE,
+                          _get(&_netif_a, _addr_c, true)->frag_size);
+    TEST_ASSERT_NULL(_get(&_netif_a, _addr_b, false));
+    TEST_ASSERT_EQUAL_INT(80, _get(&_netif_a, _addr_a, false)->frag_size);
+}
+
+static void test_sfr_path_rtt(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get(&_netif_a, _addr_a, true);
+
+    /* SRTT = 200, RTTVAR = 100 => RTO = 200 + 4 * 100 */
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 200);
+    TEST_ASSERT_EQUAL_INT(200 * 8, path->srtt);
+    TEST_ASSERT_EQUAL_INT(100 * 4, path->rttvar);
+    TEST_ASSERT_EQUAL_INT(600, path->rto);
+    /* SRTT = 200, RTTVAR = 3/4 * 100 => RTO = 200 + 4 * 75 */
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 200);
+    TEST_ASSERT_EQUAL_INT(200 * 8, path->srtt);
+    TEST_ASSERT_EQUAL_INT(75 * 4, path->rttvar);
+    TEST_ASSERT_EQUAL_INT(500, path->rto);
+    /* SRTT = 7/8 * 200 + 1/8 * 280, RTTVAR = 3/4 * 75 + 1/4 * 80
+     * => RTO = 210 + 4 * 76.25 */
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 280);
+    TEST_ASSERT_EQUAL_INT(210 * 8, path->srtt);
+    TEST_ASSERT_EQUAL_INT(305, path->rttvar);
+    TEST_ASSERT_EQUAL_INT(515, path->rto);
+}
+
+static void test_sfr_path_rtt__bounds(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get(&_netif_a, _addr_a, true);
+
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 10);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MIN_ARQ_TIMEOUT_MS,
+                          path->rto);
+    path = _get(&_netif_a, _addr_b, true);
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 900);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS,
+                          path->rto);
+}
+
+static void test_sfr_path_timeout(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get(&_netif_a, _addr_a, true);
+
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 100);
+    TEST_ASSERT_EQUAL_INT(300, path->rto);
+    gnrc_sixlowpan_frag_sfr_path_timeout(path);
+    TEST_ASSERT_EQUAL_INT(600, path->rto);
+    TEST_ASSERT_EQUAL_INT(96, path->frag_size);
+    gnrc_sixlowpan_frag_sfr_path_timeout(path);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS,
+                          path->rto);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MIN_FRAG_SIZE,
+                          path->frag_size);
+    /* a new sample replaces the backed off timeout */
+    gnrc_sixlowpan_frag_sfr_path_rtt(path, 100);
+    TEST_ASSERT(path->rto < CONFIG_GNRC_SIXLOWPAN_SFR_MAX_ARQ_TIMEOUT_MS);
+}
+
+static void test_sfr_path_ack(void)
+{
+    gnrc_sixlowpan_frag_sfr_path_t *path = _get(&_netif_a, _addr_a, true);
+
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 2);
+    TEST_ASSERT_EQUAL_INT(96, path->frag_size);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 1);
+    TEST_ASSERT_EQUAL_INT(80, path->frag_size);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 1);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MIN_FRAG_SIZE,
+                          path->frag_size);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 0);
+    TEST_ASSERT_EQUAL_INT(80, path->frag_size);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 0);
+    TEST_ASSERT_EQUAL_INT(96, path->frag_size);
+    /* a loss restarts counting the ACKs without losses */
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 0);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 1);
+    gnrc_sixlowpan_frag_sfr_path_ack(path, 0);
+    TEST_ASSERT_EQUAL_INT(80, path->frag_size);
+    for (unsigned i = 0; i < 8; i++) {
+        gnrc_sixlowpan_frag_sfr_path_ack(path, 0);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_SIXLOWPAN_SFR_MAX_FRAG_SIZE,
+                          path->frag_size);
+}
+
+Test *tests_gnrc_sixlowpan_frag_sfr_path_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sfr_path_get__empty),
+        new_TestFixture(test_sfr_path_get__create),
+        new_TestFixture(test_sfr_path_get__replace_lru),
+        new_TestFixture(test_sfr_path_rtt),
+        new_TestFixture(test_sfr_path_rtt__bounds),
+        new_TestFixture(test_sfr_path_timeout),
+        new_TestFixture(test_sfr_path_ack),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_sixlowpan_frag_sfr_path_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_sixlowpan_frag_sfr_path_tests;
+}
+
+void tests_gnrc_sixlowpan_frag_sfr_path(void)
+{
+    TESTS_RUN(tests_gnrc_sixlowpan_frag_sfr_path_tests());
+}
+/** @} */
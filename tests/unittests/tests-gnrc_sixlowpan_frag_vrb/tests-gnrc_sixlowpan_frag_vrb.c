@@ -120,6 +120,39 @@ static void test_vrb_add__full(void)
                                                  base.tag));
 }
 
+static void test_vrb_add__full_rm(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *res;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&base,
+                                                         &_dummy_netif,
+                                                         _out_dst,
+                                                         sizeof(_out_dst)));
+        base.src[TEST_SRC_LEN - 1]++;
+    }
+    /* removing an entry makes room for another one */
+    TEST_ASSERT_NOT_NULL((res = gnrc_sixlowpan_frag_vrb_get(_base.src,
+                                                            _base.src_len,
+                                                            _base.tag)));
+    gnrc_sixlowpan_frag_vrb_rm(res);
+    TEST_ASSERT_NOT_NULL((res = gnrc_sixlowpan_frag_vrb_add(&base,
+                                                            &_dummy_netif,
+                                                            _out_dst,
+                                                            sizeof(_out_dst))));
+    TEST_ASSERT(res == gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                   base.tag));
+    /* all others are still found */
+    base = _base;
+    for (unsigned i = 1; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        base.src[TEST_SRC_LEN - 1]++;
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(base.src,
+                                                         base.src_len,
+                                                         base.tag));
+    }
+}
+
 static void test_vrb_get__empty(void)
 {
     TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
@@ -140,6 +173,44 @@ static void test_vrb_get__after_add(void)
     TEST_ASSERT(res1 == res2);
 }
 
+static void test_vrb_reverse(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *res1, *res2;
+
+    TEST_ASSERT_NOT_NULL((res1 = gnrc_sixlowpan_frag_vrb_add(&base,
+                                                             &_dummy_netif,
+                                                             _out_dst,
+                                                             sizeof(_out_dst))));
+    base.tag++;
+    TEST_ASSERT_NOT_NULL((res2 = gnrc_sixlowpan_frag_vrb_add(&base,
+                                                             &_dummy_netif,
+                                                             _out_dst,
+                                                             sizeof(_out_dst))));
+    TEST_ASSERT(res1->out_tag != res2->out_tag);
+    TEST_ASSERT(res1 == gnrc_sixlowpan_frag_vrb_reverse(&_dummy_netif,
+                                                        _out_dst,
+                                                        sizeof(_out_dst),
+                                                        res1->out_tag));
+    TEST_ASSERT(res2 == gnrc_sixlowpan_frag_vrb_reverse(&_dummy_netif,
+                                                        _out_dst,
+                                                        sizeof(_out_dst),
+                                                        res2->out_tag));
+    /* SFR restricts the outgoing tag to 8 bits after adding */
+    res1->out_tag &= UINT8_MAX;
+    TEST_ASSERT(res1 == gnrc_sixlowpan_frag_vrb_reverse(&_dummy_netif,
+                                                        _out_dst,
+                                                        sizeof(_out_dst),
+                                                        res1->out_tag));
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_reverse(NULL, _out_dst,
+                                                     sizeof(_out_dst),
+                                                     res1->out_tag));
+    gnrc_sixlowpan_frag_vrb_rm(res1);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_reverse(&_dummy_netif, _out_dst,
+                                                     sizeof(_out_dst),
+                                                     res1->out_tag));
+}
+
 static void test_vrb_rm(void)
 {
     gnrc_sixlowpan_frag_vrb_t *res;
@@ -168,16 +239,50 @@ static void test_vrb_gc(void)
                                                  base.tag));
 }
 
+static void test_vrb_gc__not_timed_out(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *res;
+
+    base.arrival = xtimer_now_usec();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&base, &_dummy_netif,
+                                                     _out_dst,
+                                                     sizeof(_out_dst)));
+    base.tag++;
+    base.arrival -= CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US / 2;
+    TEST_ASSERT_NOT_NULL((res = gnrc_sixlowpan_frag_vrb_add(&base,
+                                                            &_dummy_netif,
+                                                            _out_dst,
+                                                            sizeof(_out_dst))));
+    gnrc_sixlowpan_frag_vrb_gc();
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
+                                                     _base.tag));
+    TEST_ASSERT(res == gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                   base.tag));
+    /* moving the arrival back lets the entry time out */
+    gnrc_sixlowpan_frag_vrb_set_arrival(
+        res, xtimer_now_usec() - CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US - 1000
+    );
+    gnrc_sixlowpan_frag_vrb_gc();
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                 base.tag));
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_base.src, _base.src_len,
+                                                     _base.tag));
+}
+
 static Test *tests_gnrc_sixlowpan_frag_vrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_vrb_add__success),
         new_TestFixture(test_vrb_add__duplicate),
         new_TestFixture(test_vrb_add__full),
+        new_TestFixture(test_vrb_add__full_rm),
         new_TestFixture(test_vrb_get__empty),
         new_TestFixture(test_vrb_get__after_add),
+        new_TestFixture(test_vrb_reverse),
         new_TestFixture(test_vrb_rm),
         new_TestFixture(test_vrb_gc),
+        new_TestFixture(test_vrb_gc__not_timed_out),
     };
 
     EMB_UNIT_TESTCALLER(vrb_tests, set_up, NULL, fixtures);
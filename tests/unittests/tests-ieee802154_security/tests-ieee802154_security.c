@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/ieee802154.h"
+#include "net/ieee802154_security.h"
+
+#include "tests-ieee802154_security.h"
+
+#define HDR_LEN     (11U)
+#define PAYLOAD_LEN (42U)
+
+static const uint8_t _src_addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a };
+static const uint8_t _other_addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0b };
+static ieee802154_sec_context_t _ctx, _ref;
+
+typedef struct {
+    uint8_t data[IEEE802154_FRAME_LEN_MAX];
+    uint8_t hdr_len;
+    uint8_t mic_len;
+} _frame_t;
+
+static void set_up(void)
+{
+    ieee802154_sec_init(&_ctx);
+    ieee802154_sec_init(&_ref);
+}
+
+static int _encrypt(ieee802154_sec_context_t *ctx, _frame_t *frame)
+{
+    /* leave room for the largest auxiliary header with implicit key mode */
+    uint8_t *payload = &frame->data[HDR_LEN + 5];
+
+    memset(frame, 0, sizeof(*frame));
+    frame->data[0] = IEEE802154_FCF_TYPE_DATA | IEEE802154_FCF_SECURITY_EN;
+    for (unsigned i = 1; i < HDR_LEN; i++) {
+        frame->data[i] = i;
+    }
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        payload[i] = 0xa0 + i;
+    }
+    frame->hdr_len = HDR_LEN;
+    return ieee802154_sec_encrypt_frame(ctx, frame->data, &frame->hdr_len,
+                                        payload, PAYLOAD_LEN,
+                                        &payload[PAYLOAD_LEN], &frame->mic_len,
+                                        _src_addr);
+}
+
+static void _assert_same_as_ref(void)
+{
+    static _frame_t frame, ref;
+
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_OK, _encrypt(&_ctx, &frame));
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_OK, _encrypt(&_ref, &ref));
+    TEST_ASSERT_EQUAL_INT(ref.hdr_len, frame.hdr_len);
+    TEST_ASSERT_EQUAL_INT(ref.mic_len, frame.mic_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ref.data, frame.data, sizeof(ref.data)));
+}
+
+static void test_sec_precompute__enc_mic(void)
+{
+    ieee802154_sec_precompute(&_ctx, _src_addr);
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_KEYSTREAM_BLOCKS, _ctx.keystream.numof);
+    _assert_same_as_ref();
+    /* the frame counter of the next frame differs */
+    _assert_same_as_ref();
+}
+
+static void test_sec_precompute__mic(void)
+{
+    _ctx.security_level = IEEE802154_SEC_SCF_SECLEVEL_MIC64;
+    _ref.security_level = IEEE802154_SEC_SCF_SECLEVEL_MIC64;
+    ieee802154_sec_precompute(&_ctx, _src_addr);
+    TEST_ASSERT_EQUAL_INT(1, _ctx.keystream.numof);
+    _assert_same_as_ref();
+}
+
+static void test_sec_precompute__none(void)
+{
+    _ctx.security_level = IEEE802154_SEC_SCF_SECLEVEL_NONE;
+    ieee802154_sec_precompute(&_ctx, _src_addr);
+    TEST_ASSERT_EQUAL_INT(0, _ctx.keystream.numof);
+}
+
+static void test_sec_precompute__stale(void)
+{
+    /* keystream for another nonce must not be used */
+    ieee802154_sec_precompute(&_ctx, _other_addr);
+    _assert_same_as_ref();
+    ieee802154_sec_precompute(&_ctx, _src_addr);
+    _ctx.frame_counter++;
+    _ref.frame_counter++;
+    _assert_same_as_ref();
+}
+
+static void test_sec_precompute__decrypt(void)
+{
+    static _frame_t frame;
+    uint8_t *payload, *mic;
+    uint16_t payload_len;
+    uint8_t hdr_len = HDR_LEN, mic_len;
+
+    ieee802154_sec_precompute(&_ctx, _src_addr);
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_OK, _encrypt(&_ctx, &frame));
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_OK,
+                          ieee802154_sec_decrypt_frame(&_ref,
+                                                       frame.hdr_len + PAYLOAD_LEN +
+                                                       frame.mic_len,
+                                                       frame.data, &hdr_len,
+                                                       &payload, &payload_len,
+                                                       &mic, &mic_len,
+                                                       _src_addr));
+    TEST_ASSERT_EQUAL_INT(PAYLOAD_LEN, payload_len);
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        TEST_ASSERT_EQUAL_INT(0xa0 + i, payload[i]);
+    }
+}
+
+Test *tests_ieee802154_security_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sec_precompute__enc_mic),
+        new_TestFixture(test_sec_precompute__mic),
+        new_TestFixture(test_sec_precompute__none),
+        new_TestFixture(test_sec_precompute__stale),
+        new_TestFixture(test_sec_precompute__decrypt),
+    };
+
+    EMB_UNIT_TESTCALLER(ieee802154_security_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ieee802154_security_tests;
+}
+
+void tests_ieee802154_security(void)
+{
+    TESTS_RUN(tests_ieee802154_security_tests());
+}
+/** @} */
@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/ieee802154.h"
+#include "net/ieee802154/tsch.h"
+
+#include "tests-ieee802154_tsch.h"
+
+#define PANID       (0x23)
+#define ASN         (0x0102030405ULL)
+
+static const eui64_t _src_addr = {
+    .uint8 = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a }
+};
+static const uint8_t _dst_addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0b };
+static ieee802154_tsch_t _tsch;
+
+void ieee802154_tsch_bh_request(ieee802154_tsch_t *tsch)
+{
+    (void)tsch;
+}
+
+static void set_up(void)
+{
+    memset(&_tsch, 0, sizeof(_tsch));
+    ieee802154_tsch_schedule_minimal(&_tsch);
+}
+
+static int _send(const uint8_t *dst, size_t dst_len)
+{
+    uint8_t psdu[IEEE802154_MAX_HDR_LEN + 4];
+    le_uint16_t pan = byteorder_htols(PANID);
+    size_t len = ieee802154_set_frame_hdr(psdu, _src_addr.uint8, sizeof(_src_addr),
+                                          dst, dst_len, pan, pan,
+                                          IEEE802154_FCF_TYPE_DATA |
+                                          IEEE802154_FCF_ACK_REQ, 0);
+    iolist_t iolist = {
+        .iol_base = psdu,
+        .iol_len = len + 4,
+        .iol_next = NULL,
+    };
+
+    memset(&psdu[len], 0xab, 4);
+    return ieee802154_tsch_send(&_tsch, &iolist);
+}
+
+static void test_tsch_eb__roundtrip(void)
+{
+    uint8_t eb[IEEE802154_TSCH_EB_LEN];
+    uint64_t asn;
+    uint8_t join_metric;
+
+    TEST_ASSERT_EQUAL_INT(IEEE802154_TSCH_EB_LEN,
+                          ieee802154_tsch_eb_write(eb, &_src_addr, PANID, 7, ASN, 3));
+    TEST_ASSERT_EQUAL_INT(IEEE802154_FCF_TYPE_BEACON, eb[0] & IEEE802154_FCF_TYPE_MASK);
+    TEST_ASSERT_EQUAL_INT(IEEE802154_FCF_VERS_V2, eb[1] & IEEE802154_FCF_VERS_MASK);
+    TEST_ASSERT(eb[1] & IEEE802154_FCF_IE_PRESENT);
+    TEST_ASSERT_EQUAL_INT(7, ieee802154_get_seq(eb));
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_eb_parse(eb, sizeof(eb), &asn, &join_metric));
+    TEST_ASSERT(asn == ASN);
+    TEST_ASSERT_EQUAL_INT(3, join_metric);
+}
+
+static void test_tsch_eb__invalid(void)
+{
+    uint8_t eb[IEEE802154_TSCH_EB_LEN];
+    uint64_t asn;
+    uint8_t join_metric;
+
+    ieee802154_tsch_eb_write(eb, &_src_addr, PANID, 7, ASN, 3);
+    /* sync IE truncated */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_eb_parse(eb, sizeof(eb) - 1,
+                                                            &asn, &join_metric));
+    /* no IEs */
+    eb[1] &= ~IEEE802154_FCF_IE_PRESENT;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_eb_parse(eb, sizeof(eb),
+                                                            &asn, &join_metric));
+    /* legacy beacon */
+    eb[1] = (eb[1] & ~IEEE802154_FCF_VERS_MASK) | IEEE802154_FCF_VERS_V1 |
+            IEEE802154_FCF_IE_PRESENT;
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_eb_parse(eb, sizeof(eb),
+                                                            &asn, &join_metric));
+}
+
+static void test_tsch_channel(void)
+{
+    TEST_ASSERT_EQUAL_INT(16, ieee802154_tsch_channel(0, 0));
+    TEST_ASSERT_EQUAL_INT(17, ieee802154_tsch_channel(1, 0));
+    TEST_ASSERT_EQUAL_INT(18, ieee802154_tsch_channel(0, 3));
+    TEST_ASSERT_EQUAL_INT(21, ieee802154_tsch_channel(15, 0));
+    TEST_ASSERT_EQUAL_INT(16, ieee802154_tsch_channel(16, 0));
+    TEST_ASSERT_EQUAL_INT(17, ieee802154_tsch_channel(ASN << 4, 1));
+}
+
+static void test_tsch_slotframe_add(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EEXIST, ieee802154_tsch_slotframe_add(&_tsch, 0, 7));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_slotframe_add(&_tsch, 1, 0));
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          ieee802154_tsch_slotframe_add(&_tsch,
+                                                        CONFIG_IEEE802154_TSCH_SLOTFRAME_NUMOF,
+                                                        7));
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_slotframe_add(&_tsch, 1, 7));
+    TEST_ASSERT_EQUAL_INT(7, _tsch.slotframes[1]);
+}
+
+static void test_tsch_cell_add(void)
+{
+    ieee802154_tsch_cell_t cell = {
+        .slot_offset = 7,
+        .options = IEEE802154_TSCH_LINK_TX,
+        .slotframe = 1,
+        .addr_len = sizeof(_dst_addr),
+    };
+
+    memcpy(cell.addr, _dst_addr, sizeof(_dst_addr));
+    /* no such slotframe */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_cell_add(&_tsch, &cell));
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_slotframe_add(&_tsch, 1, 7));
+    /* slot offset out of the slotframe */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, ieee802154_tsch_cell_add(&_tsch, &cell));
+    /* the minimal cell is already there */
+    for (unsigned i = 1; i < CONFIG_IEEE802154_TSCH_CELL_NUMOF; i++) {
+        cell.slot_offset = i - 1;
+        TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_cell_add(&_tsch, &cell));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, ieee802154_tsch_cell_add(&_tsch, &cell));
+    ieee802154_tsch_cell_remove(&_tsch, 1, 0);
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_cell_add(&_tsch, &cell));
+    ieee802154_tsch_slotframe_remove(&_tsch, 1);
+    TEST_ASSERT_EQUAL_INT(0, _tsch.slotframes[1]);
+    for (unsigned i = 1; i < CONFIG_IEEE802154_TSCH_CELL_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(IEEE802154_TSCH_NONE, _tsch.cells[i].slotframe);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _tsch.cells[0].slotframe);
+}
+
+static void test_tsch_send__not_joined(void)
+{
+    TEST_ASSERT_EQUAL_INT(-ENETDOWN, _send(ieee802154_addr_bcast,
+                                           sizeof(ieee802154_addr_bcast)));
+}
+
+static void test_tsch_send__queue(void)
+{
+    _tsch.state = IEEE802154_TSCH_STATE_JOINED;
+    TEST_ASSERT(_send(ieee802154_addr_bcast, sizeof(ieee802154_addr_bcast)) > 0);
+    TEST_ASSERT_EQUAL_INT(0, _tsch.queue[0].addr_len);
+    TEST_ASSERT(_send(_dst_addr, sizeof(_dst_addr)) > 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(_dst_addr), _tsch.queue[1].addr_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_dst_addr, _tsch.queue[1].addr, sizeof(_dst_addr)));
+    TEST_ASSERT((int16_t)(_tsch.queue[1].order - _tsch.queue[0].order) > 0);
+    for (unsigned i = 2; i < CONFIG_IEEE802154_TSCH_QUEUE_SIZE; i++) {
+        TEST_ASSERT(_send(_dst_addr, sizeof(_dst_addr)) > 0);
+    }
+    TEST_ASSERT_EQUAL_INT(-EBUSY, _send(_dst_addr, sizeof(_dst_addr)));
+}
+
+static void test_tsch_read_frame__empty(void)
+{
+    uint8_t buf[IEEE802154_FRAME_LEN_MAX];
+
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_get_frame_length(&_tsch));
+    TEST_ASSERT_EQUAL_INT(0, ieee802154_tsch_read_frame(&_tsch, buf, sizeof(buf), NULL));
+}
+
+Test *tests_ieee802154_tsch_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_tsch_eb__roundtrip),
+        new_TestFixture(test_tsch_eb__invalid),
+        new_TestFixture(test_tsch_channel),
+        new_TestFixture(test_tsch_slotframe_add),
+        new_TestFixture(test_tsch_cell_add),
+        new_TestFixture(test_tsch_send__not_joined),
+        new_TestFixture(test_tsch_send__queue),
+        new_TestFixture(test_tsch_read_frame__empty),
+    };
+
+    EMB_UNIT_TESTCALLER(ieee802154_tsch_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ieee802154_tsch_tests;
+}
+
+void tests_ieee802154_tsch(void)
+{
+    TESTS_RUN(tests_ieee802154_tsch_tests());
+}
+/** @} */
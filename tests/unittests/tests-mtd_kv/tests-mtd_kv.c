@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "mtd.h"
+#include "mtd_emulated.h"
+#include "mtd_kv.h"
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+#include "event/thread.h"
+#endif
+
+#include "tests-mtd_kv.h"
+
+#define SECTOR_COUNT    4
+#define PAGE_PER_SECTOR 4
+#define PAGE_SIZE       64
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+#define dev (&mtd_emulated_dev0.base)
+
+static mtd_kv_t kv;
+
+static int remount(void)
+{
+#if IS_USED(MODULE_MTD_KV_BACKGROUND_GC)
+    event_cancel(EVENT_PRIO_LOWEST, &kv.gc_event);
+#endif
+    return mtd_kv_init(&kv, dev);
+}
+
+static void set_up(void)
+{
+    mtd_init(dev);
+    mtd_erase_sector(dev, 0, SECTOR_COUNT);
+    TEST_ASSERT_EQUAL_INT(0, remount());
+}
+
+static void test_mtd_kv_set_get(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "empty", NULL, 0));
+
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, mtd_kv_get(&kv, "foo", buf, 3));
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_get(&kv, "empty", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "fo", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, mtd_kv_set(&kv, "", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(-EFBIG, mtd_kv_set(&kv, "big", buf,
+                                             PAGE_PER_SECTOR * PAGE_SIZE));
+}
+
+static void test_mtd_kv_overwrite_delete(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "quux", 5));
+    TEST_ASSERT_EQUAL_INT(5, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("quux", buf);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "foo"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_delete(&kv, "foo"));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+}
+
+static void test_mtd_kv_remount(void)
+{
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "baz", "1", 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "baz", "2", 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "gone", "x", 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "gone"));
+
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+    TEST_ASSERT_EQUAL_INT(2, mtd_kv_get(&kv, "baz", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("2", buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "gone", buf, sizeof(buf)));
+
+    /* writing continues after the last record */
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "baz", "3", 2));
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(2, mtd_kv_get(&kv, "baz", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("3", buf);
+}
+
+static void test_mtd_kv_compaction(void)
+{
+    char buf[16];
+    char value[16];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "const", "fixed", 6));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "gone", "x", 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "gone"));
+
+    /* many times the capacity of the device */
+    for (unsigned i = 0; i < 500; i++) {
+        int len = snprintf(value, sizeof(value), "value %u", i) + 1;
+        TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, (i & 1) ? "odd" : "even",
+                                            value, len));
+    }
+
+    TEST_ASSERT_EQUAL_INT(6, mtd_kv_get(&kv, "const", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("fixed", buf);
+    TEST_ASSERT_EQUAL_INT(10, mtd_kv_get(&kv, "odd", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("value 499", buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "gone", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(6, mtd_kv_get(&kv, "const", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("fixed", buf);
+    TEST_ASSERT_EQUAL_INT(10, mtd_kv_get(&kv, "even", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("value 498", buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "gone", buf, sizeof(buf)));
+}
+
+static void test_mtd_kv_full(void)
+{
+    char value[64];
+    char key[8];
+    int res = 0;
+
+    memset(value, 'x', sizeof(value));
+    for (unsigned i = 0; res == 0; i++) {
+        snprintf(key, sizeof(key), "k%u", i);
+        res = mtd_kv_set(&kv, key, value, sizeof(value));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, res);
+
+    /* deleting frees the space again after compaction */
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "k0"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "k1"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_delete(&kv, "k2"));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "new", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_INT(sizeof(value), mtd_kv_get(&kv, "k3", NULL, 0));
+}
+
+static void test_mtd_kv_torn_record(void)
+{
+    static const uint8_t torn[] = { 3, 0, 4, 0, 0x12, 0x34, 'f', 'o', 'o', 'X' };
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+
+    /* an update of foo interrupted by a power failure */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, torn, 0, kv.pos,
+                                                sizeof(torn)));
+
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("bar", buf);
+
+    /* the damaged sector is not written to again */
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "baz", 4));
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_STRING("baz", buf);
+}
+
+static void test_mtd_kv_format(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_format(&kv));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "foo", NULL, 0));
+    TEST_ASSERT_EQUAL_INT(0, remount());
+    TEST_ASSERT_EQUAL_INT(-ENOENT, mtd_kv_get(&kv, "foo", NULL, 0));
+}
+
+static int _read_fail(mtd_dev_t *mtd, void *dest, uint32_t addr,
+                      uint32_t count)
+{
+    (void)mtd;
+    (void)dest;
+    (void)addr;
+    (void)count;
+    return -EIO;
+}
+
+static const mtd_desc_t _broken_driver = {
+    .read = _read_fail,
+};
+
+static void test_mtd_kv_read_error(void)
+{
+    mtd_dev_t broken = *dev;
+    char buf[16];
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_kv_set(&kv, "foo", "bar", 4));
+
+    /* the index is still in RAM, but the device fails to read the record */
+    broken.driver = &_broken_driver;
+    kv.mtd = &broken;
+    TEST_ASSERT_EQUAL_INT(-EIO, mtd_kv_get(&kv, "foo", NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-EIO, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+    kv.mtd = dev;
+    TEST_ASSERT_EQUAL_INT(4, mtd_kv_get(&kv, "foo", buf, sizeof(buf)));
+}
+
+Test *tests_mtd_kv_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_kv_set_get),
+        new_TestFixture(test_mtd_kv_overwrite_delete),
+        new_TestFixture(test_mtd_kv_remount),
+        new_TestFixture(test_mtd_kv_compaction),
+        new_TestFixture(test_mtd_kv_full),
+        new_TestFixture(test_mtd_kv_torn_record),
+        new_TestFixture(test_mtd_kv_format),
+        new_TestFixture(test_mtd_kv_read_error),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_kv_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_kv_tests;
+}
+
+void tests_mtd_kv(void)
+{
+    TESTS_RUN(tests_mtd_kv_tests());
+}
+/** @} */
@@ -153,6 +153,43 @@ static void test_sixlowpan_ctx_lookup_addr__other_addr_other_prefix(void)
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
 }
 
+static void test_sixlowpan_ctx_lookup_addr__longest_prefix(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_t *ctx;
+
+    /* context with a shorter prefix covering DEFAULT_TEST_PREFIX and a lower
+     * ID */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(DEFAULT_TEST_ID - 1, &addr,
+                                                   DEFAULT_TEST_PREFIX_LEN - 15,
+                                                   TEST_UINT16, true));
+    /* add context DEFAULT_TEST_PREFIX to DEFAULT_TEST_ID */
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | DEFAULT_TEST_ID, ctx->flags_id);
+
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT_NOT_NULL((ctx = gnrc_sixlowpan_ctx_lookup_addr(&addr)));
+    TEST_ASSERT_EQUAL_INT(GNRC_SIXLOWPAN_CTX_FLAGS_COMP | (DEFAULT_TEST_ID - 1),
+                          ctx->flags_id);
+}
+
+static void test_sixlowpan_ctx_lookup_memo(void)
+{
+    ipv6_addr_t addr = DEFAULT_TEST_PREFIX;
+    gnrc_sixlowpan_ctx_memo_t memo = { 0 };
+
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_memo(&memo, &addr));
+    /* add context DEFAULT_TEST_PREFIX to DEFAULT_TEST_ID */
+    test_sixlowpan_ctx_update__success();
+    TEST_ASSERT(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID) ==
+                gnrc_sixlowpan_ctx_lookup_memo(&memo, &addr));
+    TEST_ASSERT(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID) ==
+                gnrc_sixlowpan_ctx_lookup_memo(&memo, &addr));
+    gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_memo(&memo, &addr));
+}
+
 static void test_sixlowpan_ctx_lookup_id__empty(void)
 {
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID));
@@ -190,6 +227,9 @@ static void test_sixlowpan_ctx_remove(void)
     gnrc_sixlowpan_ctx_remove(DEFAULT_TEST_ID);
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id(DEFAULT_TEST_ID));
     TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_addr(&addr));
+    /* removing an unused context does nothing */
+    gnrc_sixlowpan_ctx_remove(OTHER_TEST_ID);
+    TEST_ASSERT_NULL(gnrc_sixlowpan_ctx_lookup_id(OTHER_TEST_ID));
 }
 
 Test *tests_sixlowpan_ctx_tests(void)
@@ -204,6 +244,8 @@ Test *tests_sixlowpan_ctx_tests(void)
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__same_addr),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__other_addr_same_prefix),
         new_TestFixture(test_sixlowpan_ctx_lookup_addr__other_addr_other_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_addr__longest_prefix),
+        new_TestFixture(test_sixlowpan_ctx_lookup_memo),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__empty),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__wrong_id),
         new_TestFixture(test_sixlowpan_ctx_lookup_id__success),
@@ -0,0 +1,283 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for read-ahead and write-behind buffering of file
+ *              descriptors
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+
+#include "tests-vfs.h"
+
+#define MOCK_FILE_SIZE  (3 * CONFIG_VFS_BUFFER_SIZE)
+
+static uint8_t _mock_data[MOCK_FILE_SIZE];
+static size_t _mock_size;
+static off_t _mock_pos;
+static unsigned _mock_read_calls;
+static unsigned _mock_write_calls;
+static unsigned _mock_fsync_calls;
+
+static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    (void)filp;
+    _mock_read_calls++;
+    if ((size_t)_mock_pos >= _mock_size) {
+        return 0;
+    }
+    nbytes = MIN(nbytes, _mock_size - _mock_pos);
+    memcpy(dest, &_mock_data[_mock_pos], nbytes);
+    _mock_pos += nbytes;
+    return nbytes;
+}
+
+static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    (void)filp;
+    _mock_write_calls++;
+    nbytes = MIN(nbytes, sizeof(_mock_data) - _mock_pos);
+    memcpy(&_mock_data[_mock_pos], src, nbytes);
+    _mock_pos += nbytes;
+    _mock_size = MAX(_mock_size, (size_t)_mock_pos);
+    return nbytes;
+}
+
+static off_t _mock_lseek(vfs_file_t *filp, off_t off, int whence)
+{
+    (void)filp;
+    switch (whence) {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        off += _mock_pos;
+        break;
+    case SEEK_END:
+        off += _mock_size;
+        break;
+    default:
+        return -EINVAL;
+    }
+    if (off < 0) {
+        return -EINVAL;
+    }
+    _mock_pos = off;
+    return off;
+}
+
+static int _mock_fsync(vfs_file_t *filp)
+{
+    (void)filp;
+    _mock_fsync_calls++;
+    return 0;
+}
+
+static const vfs_file_ops_t _mock_ops = {
+    .read = _mock_read,
+    .write = _mock_write,
+    .lseek = _mock_lseek,
+    .fsync = _mock_fsync,
+};
+
+static int _fd = -1;
+
+static void setUp(void)
+{
+    for (unsigned i = 0; i < sizeof(_mock_data); i++) {
+        _mock_data[i] = i;
+    }
+    _mock_size = sizeof(_mock_data);
+    _mock_pos = 0;
+    _mock_read_calls = 0;
+    _mock_write_calls = 0;
+    _mock_fsync_calls = 0;
+
+    _fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_mock_ops, NULL);
+    TEST_ASSERT(_fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(_fd, VFS_F_SETBUF, 1));
+}
+
+static void tearDown(void)
+{
+    if (_fd >= 0) {
+        vfs_close(_fd);
+        _fd = -1;
+    }
+}
+
+static void test_vfs_buffered__getbuf(void)
+{
+    TEST_ASSERT_EQUAL_INT(1, vfs_fcntl(_fd, VFS_F_GETBUF, 0));
+    TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(_fd, VFS_F_SETBUF, 0));
+    TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(_fd, VFS_F_GETBUF, 0));
+}
+
+static void test_vfs_buffered__write_behind(void)
+{
+    _mock_size = 0;
+
+    for (unsigned i = 0; i < 100; i++) {
+        uint8_t c = 100 - i;
+        TEST_ASSERT_EQUAL_INT(1, vfs_write(_fd, &c, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, _mock_size);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_fsync(_fd));
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(1, _mock_fsync_calls);
+    TEST_ASSERT_EQUAL_INT(100, _mock_size);
+    TEST_ASSERT_EQUAL_INT(100, _mock_data[0]);
+    TEST_ASSERT_EQUAL_INT(1, _mock_data[99]);
+}
+
+static void test_vfs_buffered__write_full(void)
+{
+    uint8_t buf[CONFIG_VFS_BUFFER_SIZE / 2 + 1] = { 0 };
+
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_write(_fd, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, _mock_write_calls);
+    /* does not fit into the buffer any more */
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_write(_fd, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), _mock_pos);
+
+    /* large writes bypass the buffer */
+    uint8_t large[CONFIG_VFS_BUFFER_SIZE] = { 0 };
+    TEST_ASSERT_EQUAL_INT(sizeof(large), vfs_write(_fd, large, sizeof(large)));
+    TEST_ASSERT_EQUAL_INT(3, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(2 * sizeof(buf) + sizeof(large), _mock_pos);
+}
+
+static void test_vfs_buffered__close(void)
+{
+    uint8_t c = 0xaa;
+
+    TEST_ASSERT_EQUAL_INT(1, vfs_write(_fd, &c, 1));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(_fd));
+    _fd = -1;
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0xaa, _mock_data[0]);
+}
+
+static void test_vfs_buffered__read_ahead(void)
+{
+    for (unsigned i = 0; i < MOCK_FILE_SIZE; i++) {
+        uint8_t c;
+        TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, &c, 1));
+        TEST_ASSERT_EQUAL_INT((uint8_t)i, c);
+    }
+    uint8_t c;
+    TEST_ASSERT_EQUAL_INT(0, vfs_read(_fd, &c, 1));
+
+    /* the first read is passed through, after that the buffer is filled */
+    TEST_ASSERT(_mock_read_calls <= 2 + MOCK_FILE_SIZE / CONFIG_VFS_BUFFER_SIZE + 1);
+}
+
+static void test_vfs_buffered__read_seek(void)
+{
+    uint8_t buf[10];
+
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(9, vfs_read(_fd, buf, 9));
+    TEST_ASSERT_EQUAL_INT(9, buf[8]);
+    /* more than requested was read from the file system */
+    TEST_ASSERT(_mock_pos > 10);
+    TEST_ASSERT_EQUAL_INT(10, vfs_lseek(_fd, 0, SEEK_CUR));
+    TEST_ASSERT_EQUAL_INT(10, _mock_pos);
+
+    /* reads after seeking are not read ahead */
+    unsigned calls = _mock_read_calls;
+    TEST_ASSERT_EQUAL_INT(100, vfs_lseek(_fd, 100, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(100, buf[0]);
+    TEST_ASSERT_EQUAL_INT(101, _mock_pos);
+    TEST_ASSERT_EQUAL_INT(calls + 1, _mock_read_calls);
+}
+
+static void test_vfs_buffered__read_write(void)
+{
+    uint8_t buf[4];
+
+    /* fill the read buffer, then overwrite what comes next */
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(4, vfs_write(_fd, "abcd", 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_mock_data[2], "\x02\x03\x04\x05", 4));
+
+    /* reading flushes the write buffer first */
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(6, buf[0]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_mock_data[2], "abcd", 4));
+
+    TEST_ASSERT_EQUAL_INT(2, vfs_lseek(_fd, 2, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(4, vfs_read(_fd, buf, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "abcd", 4));
+}
+
+static void test_vfs_buffered__readline(void)
+{
+    memcpy(_mock_data, "line one\nline two\n", 18);
+
+    char line[16];
+    TEST_ASSERT_EQUAL_INT(9, vfs_readline(_fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("line one", line);
+    TEST_ASSERT_EQUAL_INT(9, vfs_readline(_fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("line two", line);
+    TEST_ASSERT_EQUAL_INT(2, _mock_read_calls);
+}
+
+static void test_vfs_buffered__pool(void)
+{
+    int fds[CONFIG_VFS_BUFFER_NUMOF];
+
+    /* setUp() took one buffer already */
+    for (unsigned i = 1; i < CONFIG_VFS_BUFFER_NUMOF; i++) {
+        fds[i] = vfs_bind(VFS_ANY_FD, O_RDWR, &_mock_ops, NULL);
+        TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(fds[i], VFS_F_SETBUF, 1));
+    }
+    fds[0] = vfs_bind(VFS_ANY_FD, O_RDWR, &_mock_ops, NULL);
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, vfs_fcntl(fds[0], VFS_F_SETBUF, 1));
+
+    /* closing returns the buffer to the pool */
+    vfs_close(_fd);
+    _fd = -1;
+    TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(fds[0], VFS_F_SETBUF, 1));
+
+    for (unsigned i = 0; i < CONFIG_VFS_BUFFER_NUMOF; i++) {
+        vfs_close(fds[i]);
+    }
+}
+
+Test *tests_vfs_buffered_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_buffered__getbuf),
+        new_TestFixture(test_vfs_buffered__write_behind),
+        new_TestFixture(test_vfs_buffered__write_full),
+        new_TestFixture(test_vfs_buffered__close),
+        new_TestFixture(test_vfs_buffered__read_ahead),
+        new_TestFixture(test_vfs_buffered__read_seek),
+        new_TestFixture(test_vfs_buffered__read_write),
+        new_TestFixture(test_vfs_buffered__readline),
+        new_TestFixture(test_vfs_buffered__pool),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_buffered_tests, setUp, tearDown, fixtures);
+
+    return (Test *)&vfs_buffered_tests;
+}
+
+/** @} */
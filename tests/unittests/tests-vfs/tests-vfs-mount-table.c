@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the mount point lookup of the VFS
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+#include "fs/constfs.h"
+
+#include "tests-vfs.h"
+
+static const uint8_t data[32];
+
+/* the size of "/id" tells which mount a path was resolved to */
+#define CONSTFS(name, id, ...)                                          \
+    static const constfs_file_t name ## _files[] = {                    \
+        { .path = "/id", .data = data, .size = id },                    \
+        __VA_ARGS__                                                     \
+    };                                                                  \
+    static const constfs_t name ## _fs = {                              \
+        .files = name ## _files,                                        \
+        .nfiles = ARRAY_SIZE(name ## _files),                           \
+    }
+
+CONSTFS(a, 1, { .path = "/b", .data = data, .size = 10 },);
+CONSTFS(a_b, 2, { .path = "/c/id", .data = data, .size = 20 },
+                { .path = "", .data = data, .size = 21 },);
+CONSTFS(ab, 3);
+CONSTFS(a_b_c, 4);
+CONSTFS(z, 5);
+
+#define MOUNT(name, path)                                               \
+    static vfs_mount_t name ## _mount = {                               \
+        .mount_point = path,                                            \
+        .fs = &constfs_file_system,                                     \
+        .private_data = (void *)&name ## _fs,                           \
+    }
+
+MOUNT(a, "/a");
+MOUNT(a_b, "/a/b");
+MOUNT(ab, "/ab");
+MOUNT(a_b_c, "/a/b/c");
+MOUNT(z, "/z");
+
+static int _resolve(const char *path)
+{
+    struct stat st;
+    int res = vfs_stat(path, &st);
+    return (res < 0) ? res : (int)st.st_size;
+}
+
+static void tearDown(void)
+{
+    vfs_umount(&a_mount, true);
+    vfs_umount(&a_b_mount, true);
+    vfs_umount(&ab_mount, true);
+    vfs_umount(&a_b_c_mount, true);
+    vfs_umount(&z_mount, true);
+}
+
+static void test_vfs_mount_table__longest_match(void)
+{
+    /* mount the shorter ones last, so the order of mounting does not help */
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&ab_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_mount));
+
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+        TEST_ASSERT_EQUAL_INT(2, _resolve("/a/b/id"));
+        TEST_ASSERT_EQUAL_INT(3, _resolve("/ab/id"));
+        TEST_ASSERT_EQUAL_INT(20, _resolve("/a/b/c/id"));
+        TEST_ASSERT_EQUAL_INT(-ENOENT, _resolve("/b/id"));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&a_b_mount, false));
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _resolve("/a/b/id"));
+    TEST_ASSERT_EQUAL_INT(3, _resolve("/ab/id"));
+}
+
+static void test_vfs_mount_table__mount_below_resolved(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_mount));
+    TEST_ASSERT_EQUAL_INT(20, _resolve("/a/b/c/id"));
+    TEST_ASSERT_EQUAL_INT(20, _resolve("/a/b/c/id"));
+
+    /* paths resolved before must not stick to the old mount */
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_c_mount));
+    TEST_ASSERT_EQUAL_INT(4, _resolve("/a/b/c/id"));
+    TEST_ASSERT_EQUAL_INT(2, _resolve("/a/b/id"));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&a_b_c_mount, false));
+    TEST_ASSERT_EQUAL_INT(20, _resolve("/a/b/c/id"));
+}
+
+static void test_vfs_mount_table__mount_point(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_mount));
+    TEST_ASSERT_EQUAL_INT(10, _resolve("/a/b"));
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+
+    /* "/a/b" is in directory "/a", but is a mount point now */
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_mount));
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+    TEST_ASSERT_EQUAL_INT(21, _resolve("/a/b"));
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+    TEST_ASSERT_EQUAL_INT(21, _resolve("/a/b"));
+}
+
+static void test_vfs_mount_table__overflow(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&ab_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_b_c_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&z_mount));
+
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+    TEST_ASSERT_EQUAL_INT(2, _resolve("/a/b/id"));
+    TEST_ASSERT_EQUAL_INT(3, _resolve("/ab/id"));
+    TEST_ASSERT_EQUAL_INT(4, _resolve("/a/b/c/id"));
+    TEST_ASSERT_EQUAL_INT(5, _resolve("/z/id"));
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&z_mount, false));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _resolve("/z/id"));
+    TEST_ASSERT_EQUAL_INT(4, _resolve("/a/b/c/id"));
+}
+
+static void test_vfs_mount_table__busy(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&a_mount));
+
+    int fd = vfs_open("/a/id", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(-EBUSY, vfs_umount(&a_mount, false));
+    /* a failed unmount leaves the mount usable */
+    TEST_ASSERT_EQUAL_INT(1, _resolve("/a/id"));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&a_mount, false));
+}
+
+Test *tests_vfs_mount_table_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_mount_table__longest_match),
+        new_TestFixture(test_vfs_mount_table__mount_below_resolved),
+        new_TestFixture(test_vfs_mount_table__mount_point),
+        new_TestFixture(test_vfs_mount_table__overflow),
+        new_TestFixture(test_vfs_mount_table__busy),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_mount_table_tests, NULL, tearDown, fixtures);
+
+    return (Test *)&vfs_mount_table_tests;
+}
+
+/** @} */
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for reading files into iolist snips
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+#include "fs/constfs.h"
+
+#include "tests-vfs.h"
+
+static const char _data[] = "0123456789abcdef";
+
+static const constfs_file_t _files[] = {
+    { .path = "/data", .data = _data, .size = sizeof(_data) - 1 },
+};
+
+static const constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+static vfs_mount_t _mount = {
+    .mount_point = "/iolist",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&_fs,
+};
+
+/* a file system that can not map its data */
+static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    size_t size = sizeof(_data) - 1;
+    if ((size_t)filp->pos >= size) {
+        return 0;
+    }
+    nbytes = MIN(nbytes, size - filp->pos);
+    memcpy(dest, &_data[filp->pos], nbytes);
+    filp->pos += nbytes;
+    return nbytes;
+}
+
+static const vfs_file_ops_t _mock_ops = {
+    .read = _mock_read,
+};
+
+static int _fd = -1;
+
+static void setUp(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount));
+}
+
+static void tearDown(void)
+{
+    if (_fd >= 0) {
+        vfs_close(_fd);
+        _fd = -1;
+    }
+    vfs_umount(&_mount, false);
+}
+
+static void test_vfs_read_iolist__map(void)
+{
+    uint8_t buf[8];
+    iolist_t snip = { 0 };
+
+    _fd = vfs_open("/iolist/data", O_RDONLY, 0);
+    TEST_ASSERT(_fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(8, vfs_read_iolist(_fd, &snip, buf, sizeof(buf)));
+    /* referenced in place, not copied */
+    TEST_ASSERT(snip.iol_base == _data);
+    TEST_ASSERT_EQUAL_INT(8, snip.iol_len);
+    TEST_ASSERT_NULL(snip.iol_next);
+
+    TEST_ASSERT_EQUAL_INT(8, vfs_lseek(_fd, 0, SEEK_CUR));
+    TEST_ASSERT_EQUAL_INT(12, vfs_lseek(_fd, 12, SEEK_SET));
+    TEST_ASSERT_EQUAL_INT(4, vfs_read_iolist(_fd, &snip, buf, sizeof(buf)));
+    TEST_ASSERT(snip.iol_base == &_data[12]);
+    TEST_ASSERT_EQUAL_INT(4, snip.iol_len);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_read_iolist(_fd, &snip, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, snip.iol_len);
+}
+
+static void test_vfs_read_iolist__copy(void)
+{
+    uint8_t buf[8];
+    iolist_t snip = { 0 };
+
+    _fd = vfs_bind(VFS_ANY_FD, O_RDONLY, &_mock_ops, NULL);
+    TEST_ASSERT(_fd >= 0);
+
+    TEST_ASSERT_EQUAL_INT(8, vfs_read_iolist(_fd, &snip, buf, sizeof(buf)));
+    TEST_ASSERT(snip.iol_base == buf);
+    TEST_ASSERT_EQUAL_INT(8, snip.iol_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, _data, 8));
+}
+
+static void test_vfs_read_iolist__buffered(void)
+{
+    uint8_t buf[8];
+    iolist_t snip = { 0 };
+    char c;
+
+    _fd = vfs_open("/iolist/data", O_RDONLY, 0);
+    TEST_ASSERT(_fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_fcntl(_fd, VFS_F_SETBUF, 1));
+
+    /* the second read fills the buffer with the rest of the file */
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, &c, 1));
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, &c, 1));
+    TEST_ASSERT_EQUAL_INT('1', c);
+
+    TEST_ASSERT_EQUAL_INT(8, vfs_read_iolist(_fd, &snip, buf, sizeof(buf)));
+    TEST_ASSERT(snip.iol_base == &_data[2]);
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(_fd, &c, 1));
+    TEST_ASSERT_EQUAL_INT('a', c);
+}
+
+static void test_vfs_read_iolist__bad_fd(void)
+{
+    uint8_t buf[8];
+    iolist_t snip = { 0 };
+
+    TEST_ASSERT_EQUAL_INT(-EBADF, vfs_read_iolist(VFS_MAX_OPEN_FILES - 1, &snip,
+                                                  buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(-EFAULT, vfs_read_iolist(0, &snip, NULL, sizeof(buf)));
+}
+
+Test *tests_vfs_read_iolist_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_read_iolist__map),
+        new_TestFixture(test_vfs_read_iolist__copy),
+        new_TestFixture(test_vfs_read_iolist__buffered),
+        new_TestFixture(test_vfs_read_iolist__bad_fd),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_read_iolist_tests, setUp, tearDown, fixtures);
+
+    return (Test *)&vfs_read_iolist_tests;
+}
+
+/** @} */
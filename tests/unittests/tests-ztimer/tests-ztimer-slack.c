@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer timer slack
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+/**
+ * @brief   Simple callback for counting alarms
+ */
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+/**
+ * @brief   A timer with slack fires together with a later timer in its window
+ */
+static void test_ztimer_slack_coalesce(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count_a = 0;
+    uint32_t count_b = 0;
+    ztimer_t alarm_a = { .callback = cb_incr, .arg = &count_a, };
+    ztimer_t alarm_b = { .callback = cb_incr, .arg = &count_b, };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &alarm_a, 1000);
+    ztimer_set_with_slack(z, &alarm_b, 900, 200);
+
+    /* only a single target is programmed */
+    TEST_ASSERT_EQUAL_INT(1000, zmock.target);
+
+    ztimer_mock_advance(&zmock, 999);   /* now =  999 */
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    TEST_ASSERT_EQUAL_INT(0, count_b);
+    ztimer_mock_advance(&zmock, 1);     /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(1, count_a);
+    TEST_ASSERT_EQUAL_INT(1, count_b);
+}
+
+/**
+ * @brief   A timer fires on time if no other timer is within its window
+ */
+static void test_ztimer_slack_exact(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count_a = 0;
+    uint32_t count_b = 0;
+    ztimer_t alarm_a = { .callback = cb_incr, .arg = &count_a, };
+    ztimer_t alarm_b = { .callback = cb_incr, .arg = &count_b, };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &alarm_a, 1000);
+    ztimer_set_with_slack(z, &alarm_b, 900, 50);
+
+    ztimer_mock_advance(&zmock, 900);   /* now =  900 */
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    TEST_ASSERT_EQUAL_INT(1, count_b);
+    ztimer_mock_advance(&zmock, 100);   /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(1, count_a);
+}
+
+/**
+ * @brief   ztimer_set() never applies slack, whatever the timer was set with
+ *          before
+ */
+static void test_ztimer_slack_not_kept(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count_a = 0;
+    uint32_t count_b = 0;
+    ztimer_t alarm_a = { .callback = cb_incr, .arg = &count_a, };
+    ztimer_t alarm_b = { .callback = cb_incr, .arg = &count_b, };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &alarm_a, 1000);
+    ztimer_set_with_slack(z, &alarm_b, 900, 200);
+    ztimer_set(z, &alarm_b, 900);
+
+    ztimer_mock_advance(&zmock, 900);   /* now =  900 */
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    TEST_ASSERT_EQUAL_INT(1, count_b);
+    ztimer_mock_advance(&zmock, 100);   /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(1, count_a);
+}
+
+/**
+ * @brief   Testing the time until the next timer expires
+ */
+static void test_ztimer_time_to_next(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+
+    ztimer_mock_init(&zmock, 16);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_time_to_next(z));
+
+    ztimer_set(z, &alarm, 100000);
+    TEST_ASSERT_EQUAL_INT(100000, ztimer_time_to_next(z));
+    ztimer_mock_advance(&zmock, 40000);
+    TEST_ASSERT_EQUAL_INT(60000, ztimer_time_to_next(z));
+    ztimer_mock_advance(&zmock, 60000);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, ztimer_time_to_next(z));
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_coalesce),
+        new_TestFixture(test_ztimer_slack_exact),
+        new_TestFixture(test_ztimer_slack_not_kept),
+        new_TestFixture(test_ztimer_time_to_next),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */
@@ -19,11 +19,13 @@
 Test *tests_ztimer_mock_tests(void);
 Test *tests_ztimer_convert_muldiv64_tests(void);
 Test *tests_ztimer_ondemand_tests(void);
+Test *tests_ztimer_slack_tests(void);
 
 void tests_ztimer(void)
 {
     TESTS_RUN(tests_ztimer_mock_tests());
     TESTS_RUN(tests_ztimer_convert_muldiv64_tests());
     TESTS_RUN(tests_ztimer_ondemand_tests());
+    TESTS_RUN(tests_ztimer_slack_tests());
 }
 /** @} */